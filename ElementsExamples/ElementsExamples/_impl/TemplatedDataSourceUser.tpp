@@ -24,18 +24,20 @@
 
 #include <cstddef>  // for std::size_t
 
+#include "ElementsKernel/Summation.h"  // for CompensatedSum
+
 namespace Elements {
 namespace Examples {
 
 template <typename T>
 double TemplatedDataSourceUser::sumRecords(const T& data_source) {
-  double      sum            = 0.;
-  std::size_t records_number = data_source.countRecords();
+  CompensatedSum<double> sum;
+  std::size_t            records_number = data_source.countRecords();
   for (std::size_t index = 0; index < records_number; ++index) {
     sum += data_source.getRecordValue(index);
   }
 
-  return sum;
+  return sum.value();
 }
 
 }  // namespace Examples
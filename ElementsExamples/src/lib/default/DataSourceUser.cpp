@@ -23,6 +23,8 @@
 
 #include <cstdlib>  // for size_t
 
+#include "ElementsKernel/Summation.h"  // for CompensatedSum
+
 namespace Elements {
 namespace Examples {
 
@@ -30,14 +32,15 @@ double DataSourceUser::sumRecords(const DataSourceInterface& data_source) {
 
   using std::size_t;
 
-  double sum = 0.;
+  // compensated sum: the rounding errors do not build up with the number of records
+  CompensatedSum<double> sum;
 
   size_t records_number = data_source.countRecords();
   for (size_t index = 0; index < records_number; ++index) {
     sum += data_source.getRecordValue(index);
   }
 
-  return sum;
+  return sum.value();
 }
 
 }  // namespace Examples
@@ -40,6 +40,9 @@ public:
 
     auto log = Logging::getLogger("CCfits");
 
+    // the read of the FITS file overlaps with the rest of the initialization
+    auto prefetch = Auxiliary::prefetch({"ElementsExamples/phz_cat.fits"});
+
     string test_upper_string{"THATSTRING"};
     log.info() << "This is the test upper string: " << test_upper_string;
 
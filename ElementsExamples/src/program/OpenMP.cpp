@@ -18,6 +18,10 @@
  *
  */
 
+#ifdef _OPENMP
+#include <omp.h>  // for omp_set_num_threads, omp_get_max_threads
+#endif
+
 #include <complex>  // for complex
 #include <cstdio>   // for size_t
 #include <map>      // for map
@@ -25,7 +29,9 @@
 
 #include <boost/current_function.hpp>  // for BOOST_CURRENT_FUNCTION
 
+#include "ElementsKernel/Hardware.h"        // for recommendedThreadNumber, cpuTopology
 #include "ElementsKernel/ProgramHeaders.h"  // for including all Program/related headers
+#include "ElementsKernel/System.h"          // for isEnvSet
 
 using std::map;
 using std::size_t;
@@ -53,6 +59,19 @@ public:
     const complex begin   = center - span / 2.0;  //, end = center+span/2.0;
     const int     maxiter = 100000;
 
+    // one thread per physical core available to the process. The computation doesn't gain anything from the
+    // hardware threads. The OMP_NUM_THREADS environment variable keeps the precedence
+    int thread_number = 1;
+#ifdef _OPENMP
+    if (not System::isEnvSet("OMP_NUM_THREADS")) {
+      omp_set_num_threads(static_cast<int>(System::recommendedThreadNumber()));
+    }
+    // the number of threads actually used by the parallel loop
+    thread_number = omp_get_max_threads();
+#endif
+    log.info() << "Using " << thread_number << " threads on " << System::cpuTopology().core_number << " cores ("
+               << System::cpuTopology().model_name << ")";
+
 #pragma omp parallel for ordered schedule(dynamic)
     for (int pix = 0; pix < num_pixels; ++pix) {
 
@@ -34,11 +34,15 @@
 #ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_AUXILIARY_H_
 #define ELEMENTSKERNEL_ELEMENTSKERNEL_AUXILIARY_H_
 
+#include <map>     // for map
+#include <memory>  // for shared_ptr
 #include <string>  // for string
 #include <vector>  // for vector
 
-#include "ElementsKernel/Export.h"  // ELEMENTS_API
-#include "ElementsKernel/Path.h"    // for Path::Item
+#include "ElementsKernel/Export.h"        // ELEMENTS_API
+#include "ElementsKernel/MappedFile.h"    // for MappedFile
+#include "ElementsKernel/Path.h"          // for Path::Item
+#include "ElementsKernel/PathPrefetch.h"  // for Path::Prefetch
 
 namespace Elements {
 inline namespace Kernel {
@@ -58,6 +62,61 @@ ELEMENTS_API Path::Item getAuxiliaryPath(const T& file_name, bool raise_exceptio
 extern template ELEMENTS_API Path::Item getAuxiliaryPath(const Path::Item& file_name, bool raise_exception);
 extern template ELEMENTS_API Path::Item getAuxiliaryPath(const std::string& file_name, bool raise_exception);
 
+/**
+ * @brief retrieve the paths of several auxiliary files at once
+ * @ingroup ElementsKernel
+ * @details
+ *   Each location directory is listed only once for all the file names
+ *   (see Path::getPathsFromLocations).
+ * @param file_names
+ *   file names of the auxiliary files to be found.
+ * @param raise_exception
+ *   enable the raising of an exception if one of the files is not found
+ * @param parallel
+ *   list the location directories concurrently
+ * @return
+ *   map of each file name to its path
+ */
+ELEMENTS_API std::map<std::string, Path::Item> getAuxiliaryPaths(const std::vector<std::string>& file_names,
+                                                                 bool raise_exception = true,
+                                                                 bool parallel        = false);
+
+/**
+ * @brief start the asynchronous read of auxiliary files into the page cache
+ * @ingroup ElementsKernel
+ * @details
+ *   The files are resolved with getAuxiliaryPaths and read ahead by
+ *   background threads (see Path::Prefetch). A program can declare its
+ *   auxiliary files at startup and open them later without waiting for
+ *   a cold read.
+ * @param file_names
+ *   file names of the auxiliary files to be prefetched.
+ * @param raise_exception
+ *   enable the raising of an exception if one of the files is not found.
+ *   Otherwise the missing files are skipped.
+ * @return
+ *   the running prefetch. It has to be kept as long as the reads are
+ *   useful: its destruction stops them.
+ */
+[[gnu::warn_unused_result]] ELEMENTS_API Path::Prefetch
+prefetchAuxiliaryFiles(const std::vector<std::string>& file_names, bool raise_exception = true);
+
+/**
+ * @brief map a auxiliary file in memory
+ * @ingroup ElementsKernel
+ * @details
+ *   The file is resolved with getAuxiliaryPath and mapped read-only with
+ *   MappedFile::get: the mapping is shared with the other users of the
+ *   same file in the process, and its pages with the other processes.
+ * @param file_name
+ *   file name of the auxiliary file to be mapped.
+ * @return
+ *   the shared mapping. It is released with the last copy of the pointer.
+ * @throw Exception
+ *   if the file cannot be found or mapped
+ */
+ELEMENTS_API std::shared_ptr<const MappedFile> mapAuxiliaryFile(const Path::Item& file_name);
+
 ELEMENTS_API std::vector<Path::Item> getAuxiliaryLocations(bool exist_only = false);
 
 namespace Auxiliary {
@@ -85,6 +144,30 @@ ELEMENTS_API Path::Item getPath(const T& file_name, bool raise_exception = true)
 extern template ELEMENTS_API Path::Item getPath(const Path::Item& file_name, bool raise_exception);
 extern template ELEMENTS_API Path::Item getPath(const std::string& file_name, bool raise_exception);
 
+/**
+ * @brief alias for the getAuxiliaryPaths function
+ * @ingroup ElementsKernel
+ * @return same as getAuxiliaryPaths
+ */
+ELEMENTS_API std::map<std::string, Path::Item> getPaths(const std::vector<std::string>& file_names,
+                                                        bool raise_exception = true,
+                                                        bool parallel        = false);
+
+/**
+ * @brief alias for the prefetchAuxiliaryFiles function
+ * @ingroup ElementsKernel
+ * @return same as prefetchAuxiliaryFiles
+ */
+[[gnu::warn_unused_result]] ELEMENTS_API Path::Prefetch prefetch(const std::vector<std::string>& file_names,
+                                                                 bool raise_exception = true);
+
+/**
+ * @brief alias for the mapAuxiliaryFile function
+ * @ingroup ElementsKernel
+ * @return same as mapAuxiliaryFile
+ */
+ELEMENTS_API std::shared_ptr<const MappedFile> map(const Path::Item& file_name);
+
 /**
  * @brief alias for the getAuxiliaryLocations function
  * @ingroup ElementsKernel
@@ -0,0 +1,185 @@
+/**
+ * @file ElementsKernel/AuxiliaryCache.h
+ * @brief Node-local disk cache of the auxiliary files
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_AUXILIARYCACHE_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_AUXILIARYCACHE_H_
+
+#include <atomic>         // for atomic
+#include <chrono>         // for seconds, milliseconds
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint64_t
+#include <memory>         // for shared_ptr
+#include <mutex>          // for mutex
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <unordered_set>  // for unordered_set
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/Path.h"    // for Path::Item
+
+namespace Elements {
+inline namespace Kernel {
+
+/// name of the environment variable holding the directory of the local cache. The cache is disabled if unset.
+ELEMENTS_API extern const std::string AUX_CACHE_DIR_VARIABLE;
+
+/// name of the environment variable holding the maximum size of the local cache (e.g. "20 GiB")
+ELEMENTS_API extern const std::string AUX_CACHE_SIZE_VARIABLE;
+
+/// default maximum size of the local cache: 10 GiB
+constexpr std::uint64_t DEFAULT_AUX_CACHE_SIZE{std::uint64_t{10} << 30};
+
+/// default time during which a used entry of the local cache cannot be evicted
+constexpr std::chrono::seconds DEFAULT_AUX_CACHE_MIN_AGE{60};
+
+/**
+ * @class AuxiliaryCache
+ * @brief
+ *   Copy of the auxiliary files on a node-local disk, shared by all the
+ *   processes of the node
+ * @details
+ *   The first process requesting a file copies it into the cache
+ *   directory while holding an exclusive lock on the entry (flock). The
+ *   other processes wait for the copy and then get the local file: the
+ *   existing entries are checked and used under a shared lock, so that
+ *   they don't wait for each other. Each entry
+ *   is stored in its own sub-directory, named after a hash of the source
+ *   path, with the original file name and a small metadata file (source
+ *   path, size, modification time and CRC-32 of the content).
+ *
+ *   - an entry is copied again if the source file has changed
+ *   - the copy is checked against the checksum of the source content
+ *     before being published, and each process checks the checksum of
+ *     an entry once before its first use
+ *   - a process keeps the local copies it has handed out: a request of
+ *     an unchanged source (same size and modification time) only costs
+ *     a stat of the source, without any lock nor access to the entry,
+ *     as long as the entry was used less than half the minimum age ago
+ *   - an entry copied again replaces the local file atomically: the
+ *     processes which have already opened it keep reading the old
+ *     content
+ *   - when the total size exceeds the limit, the least recently used
+ *     entries are removed, with their lock files. The entries being
+ *     copied and the entries used less than a minimum age ago are never
+ *     removed: the path returned by get stays valid during that time. A
+ *     file removed by the eviction stays readable by the processes which
+ *     have already opened it. The cache can then exceed its limit for a
+ *     while.
+ *
+ *   Any failure of the cache (e.g. a full or read-only disk) is logged
+ *   and the source file is used instead. All the functions are
+ *   thread-safe.
+ */
+class ELEMENTS_API AuxiliaryCache {
+
+public:
+  struct Statistics {
+    /// number of requests served by an existing local copy
+    std::size_t hits;
+    /// number of files copied into the cache
+    std::size_t copies;
+    /// number of entries removed to respect the size limit
+    std::size_t evictions;
+    /// number of requests which fell back to the source file
+    std::size_t failures;
+  };
+
+  AuxiliaryCache(const Path::Item& directory, std::uint64_t max_size = DEFAULT_AUX_CACHE_SIZE,
+                 const std::chrono::milliseconds& min_age = DEFAULT_AUX_CACHE_MIN_AGE);
+
+  /**
+   * @brief get the cache configured by the environment
+   * @details
+   *   The cache is placed in the directory given by
+   *   AUX_CACHE_DIR_VARIABLE, with the size limit given by
+   *   AUX_CACHE_SIZE_VARIABLE. The instance is kept as long as the
+   *   variables don't change.
+   * @return the cache or nullptr if it is disabled
+   */
+  static std::shared_ptr<AuxiliaryCache> fromEnvironment();
+
+  /**
+   * @brief get the local copy of a file
+   * @param source_file
+   *   the file on the (network) storage
+   * @return the local copy, or the source file if it is not a regular
+   *   file, if it is larger than the cache or if the cache fails. The
+   *   local copy is not evicted during the minimum age: it has to be
+   *   opened within that time.
+   */
+  Path::Item get(const Path::Item& source_file);
+
+  const Path::Item& directory() const;
+
+  std::uint64_t maxSize() const;
+
+  /// @return the time during which a used entry cannot be evicted
+  std::chrono::milliseconds minAge() const;
+
+  /// @return the total size of the files currently in the cache directory
+  std::uint64_t size() const;
+
+  Statistics statistics() const;
+
+private:
+  void evict(const std::string& kept_key);
+
+  bool isVerified(const Path::Item& local_file, std::uint32_t checksum);
+
+  /// local file handed out for a source file
+  struct LocalCopy {
+    std::uint64_t                         size;
+    std::int64_t                          modification_time;
+    Path::Item                            local_file;
+    std::chrono::steady_clock::time_point use_time;
+  };
+
+  /// @return true if the local copy of the source is known and was used recently
+  bool findLocalCopy(const std::string& source, std::uint64_t size, std::int64_t modification_time,
+                     Path::Item& local_file);
+
+  void keepLocalCopy(const std::string& source, std::uint64_t size, std::int64_t modification_time,
+                     const Path::Item& local_file);
+
+  Path::Item                                 m_directory;
+  std::uint64_t                              m_max_size;
+  std::chrono::milliseconds                  m_min_age;
+  std::mutex                                 m_mutex;
+  std::unordered_set<std::string>            m_verified;
+  std::unordered_map<std::string, LocalCopy> m_local_copies;
+  std::atomic<std::size_t>                   m_hits;
+  std::atomic<std::size_t>                   m_copies;
+  std::atomic<std::size_t>                   m_evictions;
+  std::atomic<std::size_t>                   m_failures;
+};
+
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_AUXILIARYCACHE_H_
+
+/**@}*/
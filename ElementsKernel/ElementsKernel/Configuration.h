@@ -34,11 +34,14 @@
 #ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_CONFIGURATION_H_
 #define ELEMENTSKERNEL_ELEMENTSKERNEL_CONFIGURATION_H_
 
+#include <map>     // for map
+#include <memory>  // for shared_ptr
 #include <string>  // for string
 #include <vector>  // for vector
 
-#include "ElementsKernel/Export.h"  // ELEMENTS_API
-#include "ElementsKernel/Path.h"    // for Path::Item
+#include "ElementsKernel/Export.h"      // ELEMENTS_API
+#include "ElementsKernel/MappedFile.h"  // for MappedFile
+#include "ElementsKernel/Path.h"        // for Path::Item
 
 namespace Elements {
 inline namespace Kernel {
@@ -58,6 +61,41 @@ ELEMENTS_API Path::Item getConfigurationPath(const T& file_name, bool raise_exce
 extern template ELEMENTS_API Path::Item getConfigurationPath(const Path::Item& file_name, bool raise_exception);
 extern template ELEMENTS_API Path::Item getConfigurationPath(const std::string& file_name, bool raise_exception);
 
+/**
+ * @brief retrieve the paths of several configuration files at once
+ * @ingroup ElementsKernel
+ * @details
+ *   Each location directory is listed only once for all the file names
+ *   (see Path::getPathsFromLocations).
+ * @param file_names
+ *   file names of the configuration files to be found.
+ * @param raise_exception
+ *   enable the raising of an exception if one of the files is not found
+ * @param parallel
+ *   list the location directories concurrently
+ * @return
+ *   map of each file name to its path
+ */
+ELEMENTS_API std::map<std::string, Path::Item> getConfigurationPaths(const std::vector<std::string>& file_names,
+                                                                     bool raise_exception = true,
+                                                                     bool parallel        = false);
+
+/**
+ * @brief map a configuration file in memory
+ * @ingroup ElementsKernel
+ * @details
+ *   The file is resolved with getConfigurationPath and mapped read-only with
+ *   MappedFile::get: the mapping is shared with the other users of the
+ *   same file in the process, and its pages with the other processes.
+ * @param file_name
+ *   file name of the configuration file to be mapped.
+ * @return
+ *   the shared mapping. It is released with the last copy of the pointer.
+ * @throw Exception
+ *   if the file cannot be found or mapped
+ */
+ELEMENTS_API std::shared_ptr<const MappedFile> mapConfigurationFile(const Path::Item& file_name);
+
 ELEMENTS_API std::vector<Path::Item> getConfigurationLocations(bool exist_only = false);
 
 namespace Configuration {
@@ -85,6 +123,22 @@ ELEMENTS_API Path::Item getPath(const T& file_name, bool raise_exception = true)
 extern template ELEMENTS_API Path::Item getPath(const Path::Item& file_name, bool raise_exception);
 extern template ELEMENTS_API Path::Item getPath(const std::string& file_name, bool raise_exception);
 
+/**
+ * @brief alias for the getConfigurationPaths function
+ * @ingroup ElementsKernel
+ * @return same as getConfigurationPaths
+ */
+ELEMENTS_API std::map<std::string, Path::Item> getPaths(const std::vector<std::string>& file_names,
+                                                        bool raise_exception = true,
+                                                        bool parallel        = false);
+
+/**
+ * @brief alias for the mapConfigurationFile function
+ * @ingroup ElementsKernel
+ * @return same as mapConfigurationFile
+ */
+ELEMENTS_API std::shared_ptr<const MappedFile> map(const Path::Item& file_name);
+
 /**
  * @brief alias for the getConfigurationLocations function
  * @ingroup ElementsKernel
@@ -39,15 +39,36 @@ namespace Elements {
 
 /**
  * @brief Python dictionary-like Environment interface
+ * @details
+ *   In the process mode (default), the changes are written to the
+ *   process environment and they are undone by restore or at the
+ *   destruction, unless they are committed. The values to restore are
+ *   read from the process environment itself.
+ *
+ *   The values are read from the EnvironmentSnapshot: the changes done
+ *   with the raw ::setenv are only seen after
+ *   EnvironmentSnapshot::refresh(). System::setEnv and System::unSetEnv
+ *   update the snapshot.
+ *
+ *   In the overlay mode, the changes are only kept in memory on top of
+ *   the process environment, which is never modified. They are seen
+ *   through this instance only, which makes it cheap to hold a
+ *   different view per thread. They are passed to the child processes
+ *   with block() and they are written to the process environment by
+ *   commit().
  * @ingroup ElementsKernel
  */
 class ELEMENTS_API Environment {
 public:
   class Variable;
+  class Block;
+
+  enum Mode { process, overlay };
 
 public:
   /// default constructor
   explicit Environment(bool keep_same = true);
+  explicit Environment(Mode mode, bool keep_same = true);
   virtual ~Environment();
 
   Variable       operator[](const std::string&);
@@ -59,7 +80,12 @@ public:
   Environment&   prepend(const std::string&, const std::string&);
   std::string    get(const std::string& index, const std::string& default_value = "") const;
   static bool    hasKey(const std::string&);
-  void           commit();
+  /// same as hasKey, including the overlay changes
+  bool contains(const std::string&) const;
+  void commit();
+  Mode mode() const;
+  /// the complete environment, with the changes, for a child process
+  Block block() const;
 
   enum ShellType { sh, csh };
 
@@ -70,7 +96,13 @@ private:
    * @brief check that the variable is in the environment
    * @ingroup ElementsKernel
    */
-  static void checkOutOfRange(const std::string&);
+  void checkOutOfRange(const std::string&) const;
+
+  /// value of a variable in the overlay. It is unset if is_set is false
+  struct Override {
+    bool        is_set;
+    std::string value;
+  };
 
   /// old value for changed variables
   std::map<std::string, std::string> m_old_values;
@@ -79,6 +111,34 @@ private:
 
   /// variable added to the environment
   std::vector<std::string> m_added_variables;
+
+  Mode m_mode;
+
+  /// changes of the overlay mode
+  std::map<std::string, Override> m_overlay;
+};
+
+/**
+ * @brief null terminated "NAME=value" array, as expected by execve or posix_spawn
+ * @ingroup ElementsKernel
+ */
+class ELEMENTS_API Environment::Block {
+
+public:
+  explicit Block(std::vector<std::string> entries);
+  Block(const Block&) = delete;
+  Block& operator=(const Block&) = delete;
+  Block(Block&&)                 = default;
+  Block& operator=(Block&&) = default;
+
+  /// @return the array, valid during the lifetime of the block
+  char* const* envp() const;
+  /// @return the "NAME=value" entries
+  const std::vector<std::string>& entries() const;
+
+private:
+  std::vector<std::string> m_entries;
+  std::vector<char*>       m_pointers;
 };
 
 /**
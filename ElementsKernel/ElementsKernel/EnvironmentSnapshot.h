@@ -0,0 +1,125 @@
+/**
+ * @file ElementsKernel/EnvironmentSnapshot.h
+ * @brief Immutable and thread-safe copy of the process environment
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_ENVIRONMENTSNAPSHOT_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_ENVIRONMENTSNAPSHOT_H_
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <map>         // for map
+#include <string>      // for string
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+
+namespace Elements {
+
+/**
+ * @class EnvironmentSnapshot
+ * @brief
+ *   Hash indexed copy of the process environment
+ * @details
+ *   The snapshot is taken when the library is loaded and it is
+ *   immutable. The reads don't take any lock and don't call
+ *   ::getenv: they can run in any number of threads, even while the
+ *   environment is modified. It is the single view of the environment
+ *   in Elements: System::getEnv, the Environment class and
+ *   Path::getLocationsFromEnv read it. A new snapshot is published by
+ *   refresh and by the modifications done through System::setEnv and
+ *   System::unSetEnv (and thus the Environment class). The changes
+ *   done with the raw ::setenv or ::putenv (e.g. by a third-party
+ *   library or by Python through os.environ) are only seen after a
+ *   refresh.
+ *
+ *   The replaced snapshots are released once no reader is using
+ *   them anymore.
+ */
+class ELEMENTS_API EnvironmentSnapshot {
+
+public:
+  EnvironmentSnapshot() = delete;
+
+  /**
+   * @brief
+   *   get the value of a variable
+   * @param name
+   *   name of the variable
+   * @param value
+   *   receives the value. It is left untouched if the variable is not set
+   * @return true if the variable is set
+   */
+  static bool lookup(const std::string& name, std::string& value);
+
+  /// @return the value of the variable or the default value if it is not set
+  static std::string get(const std::string& name, const std::string& default_value = "");
+
+  /// @return true if the variable is set
+  static bool hasKey(const std::string& name);
+
+  /// @return the number of variables
+  static std::size_t size();
+
+  /// @return a copy of all the variables, sorted by name
+  static std::map<std::string, std::string> variables();
+
+  /// @return the number of snapshots published so far
+  static std::size_t generation();
+
+  /// take a new snapshot of the process environment
+  static void refresh();
+
+  /**
+   * @brief
+   *   modify the process environment and take a new snapshot
+   * @details
+   *   The modifications are serialized with each other and with the
+   *   refreshes.
+   * @param modification
+   *   function changing the environment (e.g. with ::setenv)
+   * @return the value returned by the modification
+   */
+  static int update(const std::function<int()>& modification);
+
+  /**
+   * @brief
+   *   modify a single variable of the process environment
+   * @details
+   *   Same as update, but only the given variable is read again: the
+   *   rest of the new snapshot is copied from the current one.
+   * @param name
+   *   name of the variable changed by the modification
+   * @param modification
+   *   function changing the variable (e.g. with ::setenv)
+   * @return the value returned by the modification
+   */
+  static int update(const std::string& name, const std::function<int()>& modification);
+};
+
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_ENVIRONMENTSNAPSHOT_H_
+
+/**@}*/
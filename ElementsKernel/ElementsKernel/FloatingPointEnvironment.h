@@ -0,0 +1,145 @@
+/**
+ * @file ElementsKernel/FloatingPointEnvironment.h
+ * @brief Control of the floating point environment: denormal flushing and exception traps
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_FLOATINGPOINTENVIRONMENT_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_FLOATINGPOINTENVIRONMENT_H_
+
+#include <cfenv>   // for fenv_t, FE_INVALID, FE_DIVBYZERO, FE_OVERFLOW
+#include <string>  // for string
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+
+namespace Elements {
+
+/// @return true if the flush-to-zero and denormals-are-zero modes are supported on this platform
+ELEMENTS_API bool hasDenormalControl() noexcept;
+
+/**
+ * @brief
+ *   flush the denormal results to zero (FTZ)
+ * @return the previous state
+ */
+ELEMENTS_API bool setFlushToZero(bool enable) noexcept;
+
+ELEMENTS_API bool isFlushToZero() noexcept;
+
+/**
+ * @brief
+ *   treat the denormal operands as zero (DAZ)
+ * @return the previous state
+ */
+ELEMENTS_API bool setDenormalsAreZero(bool enable) noexcept;
+
+ELEMENTS_API bool isDenormalsAreZero() noexcept;
+
+/**
+ * @brief
+ *   raise SIGFPE when one of the floating point exceptions occurs
+ * @param excepts
+ *   bitwise or of the FE_* macros of \<cfenv\>
+ * @return the previously enabled traps, or -1 if the traps are not supported
+ */
+ELEMENTS_API int enableFloatingPointTraps(int excepts) noexcept;
+
+ELEMENTS_API int disableFloatingPointTraps(int excepts) noexcept;
+
+/// @return the enabled traps, or -1 if the traps are not supported
+ELEMENTS_API int floatingPointTraps() noexcept;
+
+/**
+ * @class FloatingPointEnvironment
+ * @brief
+ *   Value describing the denormal handling and the enabled traps
+ * @details
+ *   The floating point environment is a per-thread state. On Linux a
+ *   new thread starts with a copy of the environment of the thread
+ *   which creates it: setting it in the main thread before starting
+ *   the workers is enough. A thread pool created earlier has to set it
+ *   in each worker, for example with a FloatingPointEnvironmentGuard.
+ */
+class ELEMENTS_API FloatingPointEnvironment {
+
+public:
+  explicit FloatingPointEnvironment(bool flush_to_zero = false, bool denormals_are_zero = false, int traps = 0);
+
+  /// @return the environment of the calling thread
+  static FloatingPointEnvironment current();
+
+  /**
+   * @brief
+   *   parse a comma separated list of modes
+   * @details
+   *   The modes are "ftz", "daz", "denormals" (ftz and daz),
+   *   "invalid", "divbyzero", "overflow", "underflow", "inexact",
+   *   "traps" (invalid, divbyzero and overflow) and "default".
+   * @throw Elements::Exception for an unknown mode
+   */
+  static FloatingPointEnvironment fromString(const std::string& modes);
+
+  /// set this environment for the calling thread
+  void apply() const;
+
+  bool flushToZero() const;
+
+  bool denormalsAreZero() const;
+
+  int traps() const;
+
+  /// @return a comma separated list of modes which can be read back by fromString
+  std::string toString() const;
+
+private:
+  bool m_flush_to_zero;
+  bool m_denormals_are_zero;
+  int  m_traps;
+};
+
+/**
+ * @class FloatingPointEnvironmentGuard
+ * @brief
+ *   Sets a floating point environment for the calling thread and
+ *   restores the previous one when it goes out of scope.
+ */
+class ELEMENTS_API FloatingPointEnvironmentGuard {
+
+public:
+  explicit FloatingPointEnvironmentGuard(const FloatingPointEnvironment& environment);
+
+  FloatingPointEnvironmentGuard(const FloatingPointEnvironmentGuard&) = delete;
+  FloatingPointEnvironmentGuard& operator=(const FloatingPointEnvironmentGuard&) = delete;
+
+  ~FloatingPointEnvironmentGuard();
+
+private:
+  std::fenv_t              m_saved_fenv;
+  FloatingPointEnvironment m_saved_environment;
+};
+
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_FLOATINGPOINTENVIRONMENT_H_
+
+/**@}*/
@@ -0,0 +1,126 @@
+/**
+ * @file ElementsKernel/Hardware.h
+ * @brief Processor topology and instruction set detection
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_HARDWARE_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_HARDWARE_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ElementsKernel/Export.h"      // ELEMENTS_API
+#include "ElementsKernel/SystemInfo.h"  // for SimdFeature
+
+namespace Elements {
+namespace System {
+
+enum class CacheType { Data, Instruction, Unified };
+
+/// a logical processor (hardware thread)
+struct ELEMENTS_API LogicalCpu {
+  std::size_t id;
+  std::size_t core_id;     ///< physical core, unique within the package
+  std::size_t package_id;  ///< socket
+  std::size_t numa_node;
+};
+
+/// a cache level, as seen from the first processor
+struct ELEMENTS_API CacheDescription {
+  unsigned    level;
+  CacheType   type;
+  std::size_t size;           ///< in bytes
+  std::size_t line_size;      ///< in bytes
+  std::size_t associativity;  ///< number of ways, 0 if unknown
+  std::size_t sharing_cpu_number;
+};
+
+struct ELEMENTS_API NumaNode {
+  std::size_t              id;
+  std::vector<std::size_t> cpus;
+  std::size_t              memory;  ///< in bytes, 0 if unknown
+};
+
+/**
+ * @class CpuTopology
+ * @brief
+ *   description of the processors of the host
+ * @details
+ *   The layout is read from /sys/devices/system and /proc/cpuinfo,
+ *   the instruction sets from cpuid on x86. The instruction sets are
+ *   only reported when the operating system saves the corresponding
+ *   registers (e.g. AVX needs the YMM state enabled in XCR0). When
+ *   /sys is not available, each online processor is described as a
+ *   core of a single package and NUMA node.
+ */
+struct ELEMENTS_API CpuTopology {
+  std::string                   vendor;
+  std::string                   model_name;
+  std::vector<LogicalCpu>       cpus;  ///< the online processors
+  std::vector<CacheDescription> caches;
+  std::vector<NumaNode>         numa_nodes;
+  std::size_t                   core_number;
+  std::size_t                   package_number;
+  std::uint32_t                 isa_features;  ///< combination of SimdFeature bits
+
+  std::size_t logicalCpuNumber() const;
+
+  std::size_t threadsPerCore() const;
+
+  bool hasFeatures(std::uint32_t features) const;
+
+  /// @return the data or unified cache of a level, nullptr if it is unknown
+  const CacheDescription* dataCache(unsigned level) const;
+};
+
+/**
+ * @brief
+ *   the description of the processors of the host
+ * @details
+ *   It is read once, at the first call, in a thread-safe way.
+ */
+ELEMENTS_API const CpuTopology& cpuTopology();
+
+/// @return the processors the calling thread is allowed to run on (affinity mask, e.g. restricted by taskset)
+ELEMENTS_API std::vector<std::size_t> availableCpus();
+
+/**
+ * @brief
+ *   number of threads for compute bound work
+ * @details
+ *   It is the number of physical cores among the available processors:
+ *   the hardware threads of a core share its execution units.
+ * @return at least 1
+ */
+ELEMENTS_API std::size_t recommendedThreadNumber();
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_HARDWARE_H_
+
+/**@}*/
@@ -0,0 +1,116 @@
+/**
+ * @file ElementsKernel/MappedFile.h
+ * @brief Shared read-only memory mapping of files
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_MAPPEDFILE_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_MAPPEDFILE_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int64_t, uint64_t
+#include <memory>   // for shared_ptr
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/Path.h"    // for Path::Item
+
+namespace Elements {
+inline namespace Kernel {
+
+/// size of the huge pages. The mappings of the larger files are aligned on it.
+constexpr std::size_t HUGE_PAGE_SIZE{2 * 1024 * 1024};
+
+/**
+ * @class MappedFile
+ * @brief
+ *   Read-only memory mapping of a whole file
+ * @details
+ *   The file is mapped as shared: all the processes of a node which
+ *   map the same file use the same physical pages of the page cache.
+ *   The mapping of a file larger than HUGE_PAGE_SIZE is aligned on the
+ *   huge page size and advised for transparent huge pages, where the
+ *   system supports it for files. The mapping is released by the
+ *   destructor.
+ *
+ *   The mappings returned by get are shared within the process: they
+ *   are reused as long as someone holds them and the file hasn't been
+ *   replaced or modified.
+ */
+class ELEMENTS_API MappedFile {
+
+public:
+  /**
+   * @brief map a file
+   * @throw Exception
+   *   if the file cannot be opened or mapped
+   */
+  explicit MappedFile(const Path::Item& file_name);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief get the shared mapping of a file
+   * @details
+   *   The files are identified by their device and inode: the
+   *   different paths of the same file give the same mapping.
+   *   Thread-safe.
+   * @throw Exception
+   *   if the file cannot be opened or mapped
+   */
+  static std::shared_ptr<const MappedFile> get(const Path::Item& file_name);
+
+  /// @return the number of mappings currently shared by get
+  static std::size_t registrySize();
+
+  const Path::Item& path() const;
+
+  /// @return the first byte of the file. nullptr for an empty file.
+  const char* data() const;
+
+  std::size_t size() const;
+
+  bool empty() const;
+
+  /// @return true if the transparent huge pages have been advised for the mapping
+  bool hugePages() const;
+
+private:
+  Path::Item    m_path;
+  void*         m_address;
+  std::size_t   m_size;
+  bool          m_huge_pages;
+  std::uint64_t m_device;
+  std::uint64_t m_inode;
+  std::int64_t  m_modification_time;
+};
+
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_MAPPEDFILE_H_
+
+/**@}*/
@@ -29,6 +29,7 @@
 
 // STL include files
 #include <dlfcn.h>
+#include <cstddef>  // for size_t
 #include <memory>
 #include <string>
 #include <vector>
@@ -57,6 +58,14 @@ private:
 
 enum class ModuleType { UNKNOWN, SHAREDLIB, EXECUTABLE };
 
+/// an executable or a shared library mapped in the process
+struct ELEMENTS_API LinkedModule {
+  std::string path;
+  const void* address;   ///< lowest address of the loaded segments
+  std::size_t size;      ///< extent of the loaded segments, in bytes
+  std::string build_id;  ///< GNU build ID in hexadecimal, empty if there is none
+};
+
 /// Get the name of the (executable/DLL) file without file-type
 ELEMENTS_API const std::string& moduleName();
 /// Get the full name of the (executable/DLL) file
@@ -74,6 +83,16 @@ ELEMENTS_API const std::string& exeName();
 /// Vector of names of linked modules
 ELEMENTS_API const std::vector<std::string> linkedModules();
 ELEMENTS_API std::vector<Path::Item> linkedModulePaths();
+/**
+ * @brief
+ *   the executable and the shared libraries of the process, in load order
+ * @details
+ *   The list comes from the dynamic loader (dl_iterate_phdr), without any
+ *   file access. It is cached and only rebuilt when a library has been
+ *   loaded or unloaded since the previous call. It is thread-safe. The
+ *   modules without a file, like the vDSO, are not listed.
+ */
+ELEMENTS_API std::vector<LinkedModule> linkedModuleEntries();
 /// Attach module handle
 ELEMENTS_API void setModuleHandle(ImageHandle handle);
 /// Get the full executable path
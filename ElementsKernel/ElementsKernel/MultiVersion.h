@@ -0,0 +1,108 @@
+/**
+ * @file ElementsKernel/MultiVersion.h
+ * @brief Selection of the best implementation of a function for the processor
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_MULTIVERSION_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_MULTIVERSION_H_
+
+#include <cstdint>           // for uint32_t
+#include <initializer_list>  // for initializer_list
+
+#include "ElementsKernel/Export.h"      // ELEMENTS_API
+#include "ElementsKernel/SystemInfo.h"  // for SimdFeature, simdFeatures
+
+namespace Elements {
+namespace System {
+
+template <typename Signature>
+class MultiVersion;
+
+/**
+ * @class MultiVersion
+ * @brief
+ *   function dispatched to the best of its implementations for the processor
+ * @details
+ *   The implementations are usually the same code compiled for several
+ *   instruction sets with the target attribute. The choice is done once,
+ *   at the construction: a MultiVersion at namespace scope is resolved
+ *   at the program startup and the calls only go through a function
+ *   pointer.
+ * @code
+ *   __attribute__((target("avx2,fma"))) double dotAvx2(const double* a, const double* b, size_t n);
+ *   double dotDefault(const double* a, const double* b, size_t n);
+ *
+ *   const MultiVersion<double(const double*, const double*, size_t)> dot{
+ *       {simdFeatures(SimdFeature::AVX2, SimdFeature::FMA), dotAvx2, "avx2"},
+ *       {0, dotDefault, "default"}};
+ * @endcode
+ */
+template <typename Result, typename... Arguments>
+class MultiVersion<Result(Arguments...)> {
+
+public:
+  using Function = Result (*)(Arguments...);
+
+  struct Version {
+    std::uint32_t required_features;  ///< combination of SimdFeature bits
+    Function      function;
+    const char*   name;
+  };
+
+  /**
+   * @brief
+   *   select the implementation for the processor of the host
+   * @param versions
+   *   the implementations, from the most to the least preferred. The
+   *   first one whose features are all supported is used
+   * @throws Exception
+   *   if none of them can be used. The last one should require nothing
+   */
+  MultiVersion(std::initializer_list<Version> versions);
+
+  /// select the implementation for the given features instead of the ones of the processor
+  MultiVersion(std::initializer_list<Version> versions, std::uint32_t available_features);
+
+  Result operator()(Arguments... arguments) const;
+
+  /// @return the selected implementation
+  const Version& selected() const;
+
+private:
+  static Version select(std::initializer_list<Version> versions, std::uint32_t available_features);
+
+  Version m_selected;
+};
+
+}  // namespace System
+}  // namespace Elements
+
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_MULTIVERSION_IMPL_
+#include "ElementsKernel/_impl/MultiVersion.tpp"
+#undef ELEMENTSKERNEL_ELEMENTSKERNEL_MULTIVERSION_IMPL_
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_MULTIVERSION_H_
+
+/**@}*/
@@ -35,11 +35,14 @@
 #ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PATH_H_
 #define ELEMENTSKERNEL_ELEMENTSKERNEL_PATH_H_
 
-#include <boost/filesystem.hpp>  // for boost::filesystem
-#include <map>                   // for map
-#include <string>                // for string
-#include <utility>               // for forward
-#include <vector>                // for vector
+#include <boost/filesystem.hpp>          // for boost::filesystem
+#include <boost/utility/string_view.hpp>  // for string_view
+#include <cstddef>                        // for size_t, ptrdiff_t
+#include <iterator>                       // for forward_iterator_tag
+#include <map>                            // for map
+#include <string>                         // for string
+#include <utility>                        // for forward
+#include <vector>                         // for vector
 
 #include "ElementsKernel/Export.h"  // ELEMENTS_API
 
@@ -92,7 +95,9 @@ ELEMENTS_API extern const std::map<Type, const bool> HAS_SUBLEVELS;
  * @details
  *    This function return the raw locations pointed by the environment
  *    variable. It doesn't add the internal locations which are not in
- *    the variable (like /usr/lib for the LD_LIBRARY_PATH environment variable)
+ *    the variable (like /usr/lib for the LD_LIBRARY_PATH environment variable).
+ *    The variable is read from the EnvironmentSnapshot: the changes done
+ *    with the raw ::setenv are only seen after EnvironmentSnapshot::refresh()
  * @param path_variable
  *    name of the environment variable
  * @param exist_only
@@ -120,6 +125,21 @@ ELEMENTS_API std::vector<Item> getLocationsFromEnv(const std::string& path_varia
  */
 ELEMENTS_API std::vector<Item> getLocations(const Type& path_type, bool exist_only = false);
 
+/**
+ * @brief check the existence of a file name in a location
+ * @ingroup ElementsKernel
+ * @details
+ *   A file name found or missing in the index of the location (see
+ *   Path::Index) is not checked on the filesystem. Otherwise the
+ *   filesystem is checked.
+ * @param file_name
+ *   file name to look for. Can be of the form "Some.txt" or "Place/Some.txt"
+ * @param location
+ *   the location to look into
+ * @return true if location/file_name exists
+ */
+ELEMENTS_API bool existsInLocation(const Item& file_name, const Item& location);
+
 /**
  * @brief retrieve path from a file name and a set of location to look into
  * @ingroup ElementsKernel
@@ -195,6 +215,43 @@ extern template ELEMENTS_API Item getPathFromEnvVariable<Item>(const Item& file_
 extern template ELEMENTS_API Item getPathFromEnvVariable<std::string>(const std::string& file_name,
                                                                       const std::string& path_variable);
 
+/**
+ * @brief retrieve the paths of several file names in a single pass over a set of locations
+ * @ingroup ElementsKernel
+ * @details
+ *   The lookups go through Path::LookupCache: each location directory is
+ *   listed only once for all the file names, instead of one filesystem
+ *   check per file name and per location. The result is the same as the
+ *   one of LookupCache::getPathFromLocations called for each file name.
+ * @param file_names
+ *   file names to look for. Can be of the form "Some.txt" or "Place/Some.txt"
+ * @param locations
+ *   vector of locations to look into
+ * @param parallel
+ *   list the location directories concurrently
+ * @return
+ *   map of each file name to its first match. The path is empty if the
+ *   file name is not found.
+ */
+ELEMENTS_API std::map<std::string, Item> getPathsFromLocations(const std::vector<std::string>& file_names,
+                                                               const std::vector<Item>&        locations,
+                                                               bool                            parallel = false);
+
+/**
+ * @brief retrieve the paths of several file names from an environment variable to look into
+ * @ingroup ElementsKernel
+ * @param file_names
+ *   file names to look for. Can be of the form "Some.txt" or "Place/Some.txt"
+ * @param path_variable
+ *   name of the environment variable
+ * @param parallel
+ *   list the location directories concurrently
+ * @return same as getPathsFromLocations
+ */
+ELEMENTS_API std::map<std::string, Item> getPathsFromEnvVariable(const std::vector<std::string>& file_names,
+                                                                 const std::string&              path_variable,
+                                                                 bool                            parallel = false);
+
 /**
  * @brief collate a vector of path into a string using PATH_SEP
  * @ingroup ElementsKernel
@@ -228,6 +285,62 @@ ELEMENTS_API auto join(Args&&... args) -> decltype(joinPath(std::forward<Args>(a
  */
 ELEMENTS_API std::vector<Item> splitPath(const std::string& path_string);
 
+/**
+ * @class PathTokenizer
+ * @brief forward range over the entries of a string separated by PATH_SEP
+ * @ingroup ElementsKernel
+ * @details
+ *   The entries are views into the original string and nothing is
+ *   allocated. The string must outlive the tokenizer. Like splitPath, an
+ *   empty string has a single empty entry.
+ */
+class ELEMENTS_API PathTokenizer {
+
+public:
+  class ELEMENTS_API const_iterator {
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = boost::string_view;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const boost::string_view*;
+    using reference         = const boost::string_view&;
+
+    const_iterator() = default;
+
+    const_iterator(boost::string_view path_string, std::size_t position);
+
+    reference operator*() const;
+
+    pointer operator->() const;
+
+    const_iterator& operator++();
+
+    const_iterator operator++(int);
+
+    bool operator==(const const_iterator& other) const;
+
+    bool operator!=(const const_iterator& other) const;
+
+  private:
+    boost::string_view m_path_string;
+    std::size_t        m_position{0};
+    boost::string_view m_entry;
+  };
+
+  explicit PathTokenizer(boost::string_view path_string);
+
+  const_iterator begin() const;
+
+  const_iterator end() const;
+
+  /// @return the number of entries
+  std::size_t size() const;
+
+private:
+  boost::string_view m_path_string;
+};
+
 /**
  * @brief alias for the splitPath function
  * @ingroup ElementsKernel
@@ -258,6 +371,99 @@ extern template ELEMENTS_API std::vector<Item> multiPathAppend(const std::vector
                                                                const std::vector<Item>&        suffixes);
 extern template ELEMENTS_API std::vector<Item> multiPathAppend(const std::vector<std::string>& initial_locations,
                                                                const std::vector<std::string>& suffixes);
+
+/**
+ * @class MultiPathRange
+ * @brief lazy range of each suffix joined to each initial location
+ * @ingroup ElementsKernel
+ * @details
+ *   The elements are the ones of multiPathAppend, in the same order, but
+ *   they are only built when the range is iterated. The range refers to
+ *   the vectors, which must outlive it: it cannot be built from
+ *   temporaries. The iterators return the elements by value: they are
+ *   input iterators.
+ */
+template <typename T, typename U>
+class MultiPathRange {
+
+public:
+  class const_iterator {
+
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = Item;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const Item*;
+    using reference         = Item;
+
+    const_iterator(const MultiPathRange& range, std::size_t position);
+
+    Item operator*() const;
+
+    const_iterator& operator++();
+
+    const_iterator operator++(int);
+
+    bool operator==(const const_iterator& other) const;
+
+    bool operator!=(const const_iterator& other) const;
+
+  private:
+    const MultiPathRange* m_range;
+    std::size_t           m_position;
+  };
+
+  MultiPathRange(const std::vector<T>& initial_locations, const std::vector<U>& suffixes);
+
+  MultiPathRange(std::vector<T>&& initial_locations, const std::vector<U>& suffixes) = delete;
+
+  MultiPathRange(const std::vector<T>& initial_locations, std::vector<U>&& suffixes) = delete;
+
+  MultiPathRange(std::vector<T>&& initial_locations, std::vector<U>&& suffixes) = delete;
+
+  const_iterator begin() const;
+
+  const_iterator end() const;
+
+  std::size_t size() const;
+
+  bool empty() const;
+
+private:
+  const std::vector<T>& m_initial_locations;
+  const std::vector<U>& m_suffixes;
+};
+
+/**
+ * @brief lazy equivalent of multiPathAppend
+ * @ingroup ElementsKernel
+ * @param initial_locations
+ *   list of initial locations.
+ * @param suffixes
+ *   list of suffixes
+ * @return range of each joined item
+ */
+template <typename T, typename U>
+MultiPathRange<T, U> multiPathRange(const std::vector<T>& initial_locations, const std::vector<U>& suffixes);
+
+// the range would refer to destroyed vectors
+template <typename T, typename U>
+MultiPathRange<T, U> multiPathRange(std::vector<T>&& initial_locations, const std::vector<U>& suffixes) = delete;
+template <typename T, typename U>
+MultiPathRange<T, U> multiPathRange(const std::vector<T>& initial_locations, std::vector<U>&& suffixes) = delete;
+template <typename T, typename U>
+MultiPathRange<T, U> multiPathRange(std::vector<T>&& initial_locations, std::vector<U>&& suffixes) = delete;
+
+/**
+ * @brief collate a MultiPathRange into a string using PATH_SEP
+ * @ingroup ElementsKernel
+ * @param path_range
+ *   range of path to be joined. No intermediate vector is built.
+ * @return collated string
+ */
+template <typename T, typename U>
+std::string joinPath(const MultiPathRange<T, U>& path_range);
+
 /**
  * @brief remove duplicated paths keeping the order
  * @ingroup ElementsKernel
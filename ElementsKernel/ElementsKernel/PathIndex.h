@@ -0,0 +1,192 @@
+/**
+ * @file ElementsKernel/PathIndex.h
+ * @brief Persistent sorted index of the files of an installed location
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PATHINDEX_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PATHINDEX_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t, uint8_t
+#include <memory>   // for shared_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/Path.h"    // for Path::Item
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+/**
+ * @brief name of the index file at the top of an indexed location
+ * @ingroup ElementsKernel
+ */
+ELEMENTS_API extern const std::string INDEX_FILE_NAME;
+
+/**
+ * @class Index
+ * @brief
+ *   Read-only memory mapped index of all the relative paths of a
+ *   directory tree
+ * @details
+ *   The index is written at the top of an installed share/auxdir or
+ *   share/conf location (cmake/scripts/createPathIndex.py) or with
+ *   Index::write. A lookup is then a binary search in memory instead of
+ *   a filesystem access. The directory links are recorded but not
+ *   followed: a path below one of them is reported as Lookup::unknown
+ *   and must be checked on the filesystem. A path reported as
+ *   Lookup::missing by a valid index is not looked up on the filesystem.
+ *
+ *   The file layout, in the native byte order, is:
+ *   - the 8 bytes magic string "ELPIDX01"
+ *   - the number N of entries (uint64)
+ *   - the size S of the string block (uint64)
+ *   - N + 1 offsets of the entries in the string block (uint64)
+ *   - N entry types (uint8), padded with zeros to a multiple of 8 bytes
+ *   - the string block: the sorted relative paths, separated by '\0'
+ *
+ *   An index which has been replaced, or which is older than its top
+ *   directory, is ignored. The sub-directories are not checked: the
+ *   index describes an installed tree and must be written again after
+ *   any change of the tree, as done by the installation.
+ */
+class ELEMENTS_API Index {
+
+public:
+  enum class EntryType : std::uint8_t { file = 0, directory = 1, linked_directory = 2 };
+
+  enum class Lookup { found, missing, unknown };
+
+  /**
+   * @brief map the index of a directory
+   * @param directory
+   *   the indexed directory (not the index file)
+   * @throw Exception
+   *   if the index file is missing or invalid
+   */
+  explicit Index(const Item& directory);
+
+  ~Index();
+
+  Index(const Index&) = delete;
+  Index& operator=(const Index&) = delete;
+
+  /**
+   * @brief get the shared index of a location
+   * @details
+   *   The result (including the absence of a valid index) is kept and
+   *   checked again at most once per DEFAULT_VALIDATION_PERIOD: an
+   *   outdated index is dropped and a new one is mapped. Thread-safe:
+   *   the filesystem is checked without holding the registry lock.
+   * @return the index or nullptr
+   */
+  static std::shared_ptr<const Index> get(const Item& directory);
+
+  /**
+   * @brief get the shared index of a location, like get(const Item&)
+   * @param system_calls
+   *   incremented by the number of stat calls done to check or load the
+   *   index. None is done while the kept result is recent. The mapping
+   *   of a new index file (open, fstat and mmap) is not counted.
+   */
+  static std::shared_ptr<const Index> get(const Item& directory, std::size_t& system_calls);
+
+  /// forget the indexes kept by get
+  static void clearRegistry();
+
+  /**
+   * @brief write the index of a directory tree at its top
+   * @return the number of indexed entries
+   * @throw Exception
+   *   if the index file cannot be written
+   */
+  static std::size_t write(const Item& directory);
+
+  /**
+   * @brief check the index against its location
+   * @details
+   *   The index file must not have been replaced and the top directory
+   *   must have been modified before it. It costs two stat calls,
+   *   whatever the size of the tree.
+   */
+  bool isUpToDate() const;
+
+  /// same as isUpToDate(), incrementing system_calls by the number of stat calls
+  bool isUpToDate(std::size_t& system_calls) const;
+
+  const Item& directory() const;
+
+  std::size_t size() const;
+
+  /// @return the relative path of the i-th entry
+  std::string entry(std::size_t i) const;
+
+  EntryType type(std::size_t i) const;
+
+  /**
+   * @brief look up a relative path
+   * @param relative_path
+   *   path of the form "Some.txt" or "Place/Some.txt"
+   * @return Lookup::unknown if the path is not normalized or lies below
+   *   a directory link
+   */
+  Lookup find(const std::string& relative_path) const;
+
+  /**
+   * @brief search a file or directory name in the indexed tree
+   * @param name
+   *   the exact name of the file or directory
+   * @param recursive
+   *   search the sub-directories too
+   * @return the sorted relative paths of the matches
+   */
+  std::vector<std::string> search(const std::string& name, bool recursive) const;
+
+private:
+  /// @return the position of the first entry not less than the path
+  std::size_t lowerBound(const char* path, std::size_t length) const;
+
+  const char* entryData(std::size_t i) const;
+
+  std::size_t entryLength(std::size_t i) const;
+
+  Item                 m_directory;
+  void*                m_address;
+  std::size_t          m_length;
+  std::int64_t         m_modification_time;
+  std::size_t          m_size;
+  const std::uint64_t* m_offsets;
+  const std::uint8_t*  m_types;
+  const char*          m_strings;
+};
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PATHINDEX_H_
+
+/**@}*/
@@ -0,0 +1,200 @@
+/**
+ * @file ElementsKernel/PathLookupCache.h
+ * @brief Process-wide cache for the lookup of files in search locations
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PATHLOOKUPCACHE_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PATHLOOKUPCACHE_H_
+
+#include <atomic>         // for atomic
+#include <chrono>         // for milliseconds
+#include <cstddef>        // for size_t
+#include <functional>     // for function
+#include <map>            // for map
+#include <memory>         // for shared_ptr
+#include <mutex>          // for mutex
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+#include <vector>         // for vector
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/Path.h"    // for Path::Item
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+/// default period between two checks of the modification time of an indexed directory
+constexpr std::chrono::milliseconds DEFAULT_VALIDATION_PERIOD{1000};
+
+/// maximum number of directory indexes, and thus of watched directories, of a LookupCache
+constexpr std::size_t MAX_DIRECTORY_INDEXES{1024};
+
+/**
+ * @class LookupCache
+ * @brief
+ *   Cache of the search locations and of the content of the searched
+ *   directories
+ * @details
+ *   The locations of a path variable are only rebuilt when the value
+ *   of the variable changes. Each searched directory is listed once
+ *   and kept as a sorted index: a lookup doesn't touch the filesystem
+ *   as long as the index is valid. Each index is checked against the
+ *   modification time of its directory at most once per validation
+ *   period. The indexed directories are also watched (see
+ *   Path::Watcher) and an index is rebuilt at the first lookup after a
+ *   notified change of its directory. When the watcher is not available
+ *   or is disabled, or when the notification is missed (e.g. on some
+ *   network filesystems), a file added to an already indexed directory
+ *   can stay invisible for a validation period. The cache can be
+ *   emptied with clear().
+ *   A path found or missing in the Path::Index of its location is not
+ *   looked up in the directory.
+ *   The empty and relative locations, which depend on the current
+ *   directory, are always checked on the filesystem.
+ *   At most MAX_DIRECTORY_INDEXES directories are indexed and watched:
+ *   the index validated the longest time ago is dropped first.
+ *   All the functions are thread-safe. The directories are listed and
+ *   checked without holding the lock of the cache: the lookups don't
+ *   wait for the listing of another directory.
+ */
+class ELEMENTS_API LookupCache {
+
+public:
+  using LocationProvider = std::function<std::vector<Item>()>;
+  using Locations        = std::shared_ptr<const std::vector<Item>>;
+
+  struct Statistics {
+    /// number of directory lookups served by a valid index
+    std::size_t hits;
+    /// number of directory lookups which needed to (re)build an index
+    std::size_t misses;
+    /// number of location lists and indexes dropped because of a changed variable or directory
+    std::size_t invalidations;
+  };
+
+  LookupCache();
+
+  /// @return the process-wide instance, used for the locations of getAuxiliaryPath and getConfigurationPath
+  static LookupCache& instance();
+
+  /**
+   * @brief
+   *   get the locations associated with an environment variable
+   * @param path_variable
+   *   name of the environment variable
+   * @param provider
+   *   function computing the locations. It is only called when the
+   *   value of the variable has changed since the last call.
+   * @return a shared immutable list of locations
+   */
+  Locations getLocations(const std::string& path_variable, const LocationProvider& provider);
+
+  /**
+   * @brief
+   *   cached equivalent of Path::getPathFromLocations
+   * @param file_name
+   *   file name to look for. Can be of the form "Some.txt" or "Place/Some.txt"
+   * @param locations
+   *   locations to look into
+   * @return the first match or an empty path
+   */
+  Item getPathFromLocations(const Item& file_name, const std::vector<Item>& locations);
+
+  /**
+   * @brief
+   *   cached equivalent of Path::getPathsFromLocations
+   * @param file_names
+   *   file names to look for. Can be of the form "Some.txt" or "Place/Some.txt"
+   * @param locations
+   *   locations to look into
+   * @param parallel
+   *   list the directories which are not indexed yet concurrently, before the lookups
+   * @return
+   *   map of each file name to its first match. The path is empty if the
+   *   file name is not found.
+   */
+  std::map<std::string, Item> getPathsFromLocations(const std::vector<std::string>& file_names,
+                                                    const std::vector<Item>& locations, bool parallel = false);
+
+  void setValidationPeriod(const std::chrono::milliseconds& period);
+
+  std::chrono::milliseconds validationPeriod() const;
+
+  /**
+   * @brief
+   *   enable or disable the watching of the indexed directories
+   * @details
+   *   It is enabled by default when Path::Watcher is available. The
+   *   current indexes are dropped.
+   */
+  void setWatching(bool watching);
+
+  bool watching() const;
+
+  /// drop all the cached locations and directory indexes
+  void clear();
+
+  Statistics statistics() const;
+
+  void resetStatistics();
+
+private:
+  struct DirectoryIndex;
+
+  static std::shared_ptr<DirectoryIndex> buildIndex(const std::string& directory, bool watching);
+
+  using Clock = std::chrono::steady_clock;
+
+  bool contains(const std::string& directory, const std::string& entry, const Clock::time_point& now);
+
+  /**
+   * @brief
+   *   store a new index of a directory, unless another thread replaced the previous one meanwhile
+   * @return the index stored for the directory
+   */
+  std::shared_ptr<DirectoryIndex> publish(const std::string& directory, const std::shared_ptr<DirectoryIndex>& previous,
+                                          const std::shared_ptr<DirectoryIndex>& index);
+
+  /// list concurrently the directories of the file names which are not indexed yet
+  void buildIndexes(const std::vector<std::string>& file_names, const std::vector<Item>& locations);
+
+  mutable std::mutex                                                 m_mutex;
+  std::unordered_map<std::string, std::pair<std::string, Locations>> m_locations;
+  std::unordered_map<std::string, std::shared_ptr<DirectoryIndex>>   m_indexes;
+  std::chrono::milliseconds                                          m_validation_period;
+  bool                                                               m_watching;
+  std::atomic<std::size_t>                                           m_hits;
+  std::atomic<std::size_t>                                           m_misses;
+  std::atomic<std::size_t>                                           m_invalidations;
+};
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PATHLOOKUPCACHE_H_
+
+/**@}*/
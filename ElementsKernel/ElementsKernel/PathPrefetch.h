@@ -0,0 +1,111 @@
+/**
+ * @file ElementsKernel/PathPrefetch.h
+ * @brief Background prefetch of files into the page cache
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PATHPREFETCH_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PATHPREFETCH_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <memory>   // for shared_ptr
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/Path.h"    // for Path::Item
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+/**
+ * @class Prefetch
+ * @brief
+ *   Asynchronous read of files into the page cache
+ * @details
+ *   The files are read ahead by background threads, started by the
+ *   constructor, while the program goes on with its initialization.
+ *   The later reads of the files are then served from memory. On Linux
+ *   the kernel is asked to read the files (posix_fadvise(WILLNEED) and
+ *   readahead) without any copy to the user space. Elsewhere the files
+ *   are read through a small buffer.
+ *
+ *   The destructor stops the prefetch between two chunks and waits for
+ *   the threads: the object has to be kept until the prefetch is done
+ *   or no longer useful. A discarded temporary cancels it at once. The
+ *   object is movable but not thread-safe, except for the done,
+ *   byteNumber and errorNumber functions.
+ */
+class ELEMENTS_API Prefetch {
+
+public:
+  /**
+   * @brief
+   *   start the prefetch of files
+   * @param files
+   *   files to read ahead. The empty items are skipped.
+   * @param thread_number
+   *   maximum number of threads. 0 means the hardware concurrency.
+   */
+  explicit Prefetch(const std::vector<Item>& files, std::size_t thread_number = 0);
+
+  Prefetch(Prefetch&& other) = default;
+
+  Prefetch& operator=(Prefetch&& other);
+
+  ~Prefetch();
+
+  /// block until all the files are prefetched
+  void wait();
+
+  /// @return true if all the files are prefetched
+  bool done() const;
+
+  /// @return the prefetched files. Empty for a moved-from handle
+  const std::vector<Item>& files() const;
+
+  /// @return the number of bytes of the files prefetched so far
+  std::uint64_t byteNumber() const;
+
+  /// @return the number of files which could not be opened
+  std::size_t errorNumber() const;
+
+private:
+  struct State;
+
+  void stop();
+
+  std::shared_ptr<State>   m_state;
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PATHPREFETCH_H_
+
+/**@}*/
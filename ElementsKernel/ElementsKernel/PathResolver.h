@@ -0,0 +1,196 @@
+/**
+ * @file ElementsKernel/PathResolver.h
+ * @brief Search path resolution strategies with instrumentation
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PATHRESOLVER_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PATHRESOLVER_H_
+
+#include <chrono>   // for nanoseconds
+#include <cstddef>  // for size_t
+#include <deque>    // for deque
+#include <iosfwd>   // for ostream
+#include <mutex>    // for mutex
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/Path.h"    // for Path::Item
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+/**
+ * @brief name of the environment variable selecting the strategy of the process-wide resolver
+ * @ingroup ElementsKernel
+ */
+ELEMENTS_API extern const std::string RESOLUTION_STRATEGY_VARIABLE;
+
+/**
+ * @brief name of the environment variable holding the priority list of the process-wide resolver
+ * @ingroup ElementsKernel
+ */
+ELEMENTS_API extern const std::string RESOLUTION_PRIORITIES_VARIABLE;
+
+/**
+ * @brief name of the environment variable holding the file where the statistics are written at exit ("-" for
+ *   the standard error)
+ * @ingroup ElementsKernel
+ */
+ELEMENTS_API extern const std::string RESOLUTION_STATISTICS_VARIABLE;
+
+/// maximum number of lookups kept by a Resolver
+constexpr std::size_t MAX_RESOLUTION_RECORD_NUMBER{1024};
+
+enum class ResolutionStrategy {
+  first_match,  ///< the first location containing the file
+  all_matches,  ///< all the locations containing the file, in order
+  newest,       ///< the most recently modified match
+  priority_list  ///< the first match after sorting the locations by the priority list
+};
+
+/// @return the name of a strategy: "first-match", "all-matches", "newest" or "priority-list"
+ELEMENTS_API std::string toString(ResolutionStrategy strategy);
+
+/**
+ * @brief parse the name of a strategy
+ * @throw Exception
+ *   if the name is unknown
+ */
+ELEMENTS_API ResolutionStrategy toResolutionStrategy(const std::string& name);
+
+/// instrumentation of a single lookup
+struct ELEMENTS_API ResolutionRecord {
+  std::string              file_name;
+  ResolutionStrategy       strategy;
+  std::size_t              probed_locations;
+  std::size_t              system_calls;
+  std::size_t              match_number;
+  std::chrono::nanoseconds duration;
+};
+
+/**
+ * @class Resolver
+ * @brief
+ *   Lookup of a file in a list of locations with a selectable strategy
+ * @details
+ *   Each lookup is instrumented: number of probed locations, number of
+ *   system calls (stat) and duration. The system calls include the stat
+ *   calls done by Index::get to check or load the index of a location.
+ *   The totals and the last MAX_RESOLUTION_RECORD_NUMBER lookups can be
+ *   queried at any time and written with dump.
+ *
+ *   A location is probed like with existsInLocation: a path found or
+ *   missing in the Path::Index of the location is not checked on the
+ *   filesystem.
+ *   The newest strategy always calls stat to get the modification
+ *   times. The resolver doesn't use the Path::LookupCache listings:
+ *   each lookup reflects the current content of the filesystem.
+ *
+ *   The priority list contains location prefixes, from the highest
+ *   priority. The locations below the first prefix come first, then
+ *   those below the second one, etc. The other locations come last.
+ *   The original order is kept otherwise.
+ *
+ *   The process-wide instance is used by getConfigurationPath,
+ *   getAuxiliaryPath and ProgramManager for the default configuration
+ *   file. Its strategy and priority list are initialized
+ *   from the RESOLUTION_STRATEGY_VARIABLE and
+ *   RESOLUTION_PRIORITIES_VARIABLE environment variables (e.g.
+ *   ELEMENTS_RESOLUTION_STRATEGY=newest). Its statistics are written at
+ *   exit to the file named by RESOLUTION_STATISTICS_VARIABLE.
+ *
+ *   All the functions are thread-safe.
+ */
+class ELEMENTS_API Resolver {
+
+public:
+  struct Totals {
+    std::size_t              lookups;
+    std::size_t              probed_locations;
+    std::size_t              system_calls;
+    std::chrono::nanoseconds duration;
+  };
+
+  explicit Resolver(ResolutionStrategy strategy = ResolutionStrategy::first_match);
+
+  ~Resolver();
+
+  Resolver(const Resolver&) = delete;
+  Resolver& operator=(const Resolver&) = delete;
+
+  /// @return the process-wide instance
+  static Resolver& instance();
+
+  void setStrategy(ResolutionStrategy strategy);
+
+  ResolutionStrategy strategy() const;
+
+  void setPriorities(const std::vector<Item>& priorities);
+
+  std::vector<Item> priorities() const;
+
+  /**
+   * @brief
+   *   look up a file with the current strategy
+   * @param file_name
+   *   file name to look for. Can be of the form "Some.txt" or "Place/Some.txt"
+   * @param locations
+   *   locations to look into
+   * @return the matches. There is at most one, except for the
+   *   all_matches strategy.
+   */
+  std::vector<Item> resolve(const Item& file_name, const std::vector<Item>& locations);
+
+  /// @return the first element of resolve or an empty path
+  Item resolvePath(const Item& file_name, const std::vector<Item>& locations);
+
+  Totals totals() const;
+
+  /// @return the last lookups, from the oldest
+  std::vector<ResolutionRecord> records() const;
+
+  void resetStatistics();
+
+  /// write the totals and the last lookups
+  void dump(std::ostream& out) const;
+
+private:
+  mutable std::mutex           m_mutex;
+  ResolutionStrategy           m_strategy;
+  std::vector<Item>            m_priorities;
+  std::deque<ResolutionRecord> m_records;
+  Totals                       m_totals;
+  std::string                  m_statistics_file;
+};
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PATHRESOLVER_H_
+
+/**@}*/
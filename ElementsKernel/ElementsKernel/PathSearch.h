@@ -26,6 +26,8 @@
 #ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PATHSEARCH_H_
 #define ELEMENTSKERNEL_ELEMENTSKERNEL_PATHSEARCH_H_
 
+#include <cstddef>  // for size_t
+#include <limits>   // for numeric_limits
 #include <string>
 #include <vector>
 
@@ -40,7 +42,8 @@ enum class SearchType { Local, Recursive };
 /**
  * @brief
  *   Searches for a file or a directory in a directory. The search can be recursive (SearchType.Recursive)
- *   and in that case more than one results can be return
+ *   and in that case more than one results can be return. A directory
+ *   which has a Path::Index is searched in memory.
  * @ingroup ElementsKernel
  * @param searched_name
  *   Name of the searched file or directory
@@ -84,6 +87,67 @@ extern template ELEMENTS_API std::vector<std::string> pathSearch(const std::stri
 ELEMENTS_API
 std::vector<Path::Item> pathSearchInEnvVariable(const std::string& file_name, const std::string& path_like_env_variable,
                                                 SearchType search_type = SearchType::Recursive);
+
+/**
+ * @brief
+ *   How the searched name is compared to the file names
+ *    MatchType::Exact the name must be identical
+ *    MatchType::Glob shell wildcard pattern, like "*.conf"
+ *    MatchType::Regex ECMAScript regular expression matching the whole name
+ */
+enum class MatchType { Exact, Glob, Regex };
+
+/**
+ * @brief
+ *   Options of the parallel directory tree search
+ */
+struct ELEMENTS_API PathSearchOptions {
+  MatchType match_type{MatchType::Exact};
+  /// number of directory levels below the searched directories. 0 means their content only.
+  std::size_t max_depth{std::numeric_limits<std::size_t>::max()};
+  /// stop at the first match found, whichever thread finds it
+  bool first_match_only{false};
+  /// descend into the symbolic links to directories. The directories already visited are skipped.
+  bool follow_symlinks{false};
+  /// maximum number of threads. 0 means the hardware concurrency.
+  std::size_t thread_number{0};
+};
+
+/**
+ * @brief
+ *   Searches for files or directories in several directory trees with a
+ *   pool of threads
+ * @details
+ *   The sub-directories are distributed between the threads, each one
+ *   stealing work from the others when it runs out. The results are
+ *   ordered like the input directories and then alphabetically, which
+ *   makes them independent of the scheduling.
+ * @param pattern
+ *   searched name, glob pattern or regular expression, depending on the options
+ * @param directories
+ *   directories where the search is performed
+ * @param options
+ *   matching, depth, early exit and threading options
+ * @return
+ *   A vector of paths of the files found
+ * @throw Elements::Exception for an invalid regular expression
+ */
+ELEMENTS_API std::vector<Path::Item> parallelPathSearch(const std::string&             pattern,
+                                                        const std::vector<Path::Item>& directories,
+                                                        const PathSearchOptions&       options = PathSearchOptions{});
+
+ELEMENTS_API std::vector<Path::Item> parallelPathSearch(const std::string& pattern, const Path::Item& directory,
+                                                        const PathSearchOptions& options = PathSearchOptions{});
+
+/**
+ * @brief
+ *   parallel version of pathSearchInEnvVariable: all the locations of
+ *   the variable are searched in the same pool of threads
+ */
+ELEMENTS_API std::vector<Path::Item> pathSearchInEnvVariable(const std::string&       pattern,
+                                                             const std::string&       path_like_env_variable,
+                                                             const PathSearchOptions& options);
+
 }  // namespace Kernel
 }  // namespace Elements
 
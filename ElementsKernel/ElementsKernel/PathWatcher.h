@@ -0,0 +1,125 @@
+/**
+ * @file ElementsKernel/PathWatcher.h
+ * @brief Filesystem notifications for the path caches
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PATHWATCHER_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PATHWATCHER_H_
+
+#include <cstddef>        // for size_t
+#include <functional>     // for function
+#include <mutex>          // for mutex
+#include <thread>         // for thread
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/Path.h"    // for Path::Item
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+/**
+ * @class Watcher
+ * @brief
+ *   Notification of the changes of the content of directories
+ * @details
+ *   The subscribers of a directory are called when an entry is
+ *   created, deleted or renamed in it, and when the directory itself
+ *   is deleted or moved. The subscription is then dropped. The
+ *   notifications are read by a background thread, started with the
+ *   first subscription, and the callbacks are called from it without
+ *   any lock held. They must be short and thread-safe.
+ *
+ *   The watcher is based on inotify and is only available on Linux.
+ *   Elsewhere, or when the directory cannot be watched (e.g. it
+ *   doesn't exist), subscribe returns 0 and the caller must fall back
+ *   to its own validation.
+ */
+class ELEMENTS_API Watcher {
+
+public:
+  using Callback     = std::function<void(const Item&)>;
+  using Subscription = std::size_t;
+
+  Watcher();
+
+  ~Watcher();
+
+  Watcher(const Watcher&) = delete;
+  Watcher& operator=(const Watcher&) = delete;
+
+  /// @return the process-wide instance, used by the LookupCache
+  static Watcher& instance();
+
+  /// @return true if the notifications are supported
+  bool isAvailable() const;
+
+  /**
+   * @brief
+   *   register a callback for the changes of a directory
+   * @param directory
+   *   directory to watch. Its sub-directories are not watched.
+   * @param callback
+   *   function called with the watched directory
+   * @return the subscription identifier, or 0 if the directory cannot
+   *   be watched
+   */
+  Subscription subscribe(const Item& directory, const Callback& callback);
+
+  /// remove a subscription. The callback may still be running when the function returns.
+  void unsubscribe(Subscription subscription);
+
+  /// @return the number of directories currently watched
+  std::size_t watchedDirectoryNumber() const;
+
+private:
+  struct Subscriber {
+    Subscription id;
+    Item         directory;
+    Callback     callback;
+  };
+
+  void run();
+
+  void notify(int watch, bool dropped);
+
+  int                                              m_inotify_fd;
+  int                                              m_stop_fd[2];
+  mutable std::mutex                               m_mutex;
+  std::thread                                      m_thread;
+  Subscription                                     m_last_subscription;
+  std::unordered_map<int, std::vector<Subscriber>> m_subscribers;
+  std::unordered_map<Subscription, int>            m_watches;
+};
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PATHWATCHER_H_
+
+/**@}*/
@@ -0,0 +1,168 @@
+/**
+ * @file ElementsKernel/PluginRegistry.h
+ * @brief Reference counted loading of the plugin libraries
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PLUGINREGISTRY_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PLUGINREGISTRY_H_
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr, unique_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+#include "ElementsKernel/System.h"  // for ImageHandle
+
+namespace Elements {
+namespace System {
+
+/// resolution of the symbols of a plugin
+enum class PluginBinding {
+  Lazy,  ///< RTLD_LAZY: the functions are resolved at their first call
+  Now    ///< RTLD_NOW: everything is resolved at the loading, the missing symbols are reported at once
+};
+
+/**
+ * @class Plugin
+ * @brief
+ *   shared reference to a library loaded by the PluginRegistry
+ * @details
+ *   The copies share the same library, which is unloaded when the last
+ *   one is destroyed. The symbols are looked up once and cached. A
+ *   default constructed Plugin has an empty name and no symbol.
+ */
+class ELEMENTS_API Plugin {
+
+public:
+  struct Library;
+
+  Plugin() = default;
+
+  explicit Plugin(std::shared_ptr<Library> library);
+
+  /// @return false for a default constructed Plugin
+  explicit operator bool() const;
+
+  /// @return the name given to PluginRegistry::load
+  const std::string& name() const;
+
+  /// @return the file name passed to dlopen
+  const std::string& fileName() const;
+
+  PluginBinding binding() const;
+
+  ImageHandle handle() const;
+
+  /// @return the address of a symbol, nullptr if it is not defined
+  void* address(const std::string& symbol) const;
+
+  /**
+   * @brief
+   *   the function of a symbol
+   * @tparam Function
+   *   function pointer type
+   * @throws Exception
+   *   if the symbol is not defined
+   */
+  template <typename Function>
+  Function function(const std::string& symbol) const;
+
+  /// @return the number of symbols in the cache
+  std::size_t cachedSymbolNumber() const;
+
+private:
+  std::shared_ptr<Library> m_library;
+};
+
+/**
+ * @class PluginRegistry
+ * @brief
+ *   process-wide registry of the loaded plugins
+ * @details
+ *   A plugin is loaded once per name: the next loads return the same
+ *   library as long as a Plugin refers to it. The name is resolved like
+ *   for loadDynamicLib: a name with a path separator or with the shared
+ *   library suffix is used as is, a name which is set as an environment
+ *   variable is replaced by its value, and any other name becomes
+ *   lib<name>.so. The libraries are loaded with RTLD_LOCAL: their
+ *   symbols are only reachable through their Plugin. All the functions
+ *   are thread-safe.
+ */
+class ELEMENTS_API PluginRegistry {
+
+public:
+  static PluginRegistry& instance();
+
+  /**
+   * @brief
+   *   load a plugin, or share the already loaded one
+   * @details
+   *   The binding of an already loaded plugin is kept.
+   * @throws Exception
+   *   with the message of dlerror if the library cannot be loaded
+   */
+  Plugin load(const std::string& name, PluginBinding binding = PluginBinding::Lazy);
+
+  /**
+   * @brief
+   *   load a set of plugins concurrently, typically at the startup
+   * @param thread_number
+   *   0 means recommendedThreadNumber()
+   * @return the plugins, in the order of the names
+   * @throws Exception
+   *   listing all the plugins which cannot be loaded, after all the
+   *   others are loaded
+   */
+  std::vector<Plugin> preload(const std::vector<std::string>& names, PluginBinding binding = PluginBinding::Now,
+                              std::size_t thread_number = 0);
+
+  /// @return true if a Plugin of this name is alive
+  bool isLoaded(const std::string& name) const;
+
+  /// @return the number of loaded plugins
+  std::size_t size() const;
+
+  PluginRegistry(const PluginRegistry&) = delete;
+  PluginRegistry& operator=(const PluginRegistry&) = delete;
+
+private:
+  PluginRegistry();
+  ~PluginRegistry();
+
+  struct Implementation;
+  std::unique_ptr<Implementation> m_implementation;
+};
+
+}  // namespace System
+}  // namespace Elements
+
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PLUGINREGISTRY_IMPL_
+#include "ElementsKernel/_impl/PluginRegistry.tpp"
+#undef ELEMENTSKERNEL_ELEMENTSKERNEL_PLUGINREGISTRY_IMPL_
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PLUGINREGISTRY_H_
+
+/**@}*/
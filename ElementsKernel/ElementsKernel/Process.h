@@ -0,0 +1,162 @@
+/**
+ * @file ElementsKernel/Process.h
+ * @brief Creation of child processes without shell
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PROCESS_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PROCESS_H_
+
+#include <sys/types.h>  // for pid_t
+
+#include <chrono>  // for milliseconds
+#include <string>  // for string
+#include <vector>  // for vector
+
+#include "ElementsKernel/Environment.h"  // for Environment::Block
+#include "ElementsKernel/Export.h"       // ELEMENTS_API
+
+namespace Elements {
+namespace System {
+
+/// destination of the standard output or error of a child process
+enum class Redirection {
+  inherit,  ///< same as the parent
+  pipe,     ///< read by the parent through the Process
+  null      ///< discarded (/dev/null)
+};
+
+/// options of Process::spawn
+struct ELEMENTS_API SpawnOptions {
+  Redirection standard_output{Redirection::inherit};
+  Redirection standard_error{Redirection::inherit};
+  /// the environment of the child. It defaults to the process environment (environ)
+  const Environment::Block* environment{nullptr};
+  /// search the executable in the PATH if it has no "/"
+  bool search_path{true};
+};
+
+/// outcome of Process::run
+struct ELEMENTS_API ProcessResult {
+  int         exit_code;
+  std::string output;
+  std::string error;
+  bool        timed_out;
+};
+
+/**
+ * @class Process
+ * @brief
+ *   child process started with posix_spawn
+ * @details
+ *   The arguments are passed as they are, without any shell, and the
+ *   child is created without copying the page tables of the parent
+ *   (vfork semantics), whatever its size. The process is reaped by
+ *   wait, tryWait or waitFor. The destructor closes the pipes and
+ *   waits for a child still running.
+ */
+class ELEMENTS_API Process {
+
+public:
+  /**
+   * @brief
+   *   start a child process
+   * @param arguments
+   *   the command, then its arguments
+   * @param options
+   *   redirections and environment
+   * @throw Exception
+   *   if the process cannot be created (e.g. the executable doesn't exist)
+   */
+  static Process spawn(const std::vector<std::string>& arguments, const SpawnOptions& options = SpawnOptions{});
+
+  /**
+   * @brief
+   *   start a child process, collect its standard output and error and wait for it
+   * @param timeout
+   *   the child is killed if it doesn't exit within this time. 0 means no limit
+   */
+  static ProcessResult run(const std::vector<std::string>& arguments,
+                           std::chrono::milliseconds       timeout     = std::chrono::milliseconds{0},
+                           const Environment::Block*       environment = nullptr);
+
+  ~Process();
+
+  Process(const Process&) = delete;
+  Process& operator=(const Process&) = delete;
+  Process(Process&& other);
+  Process& operator=(Process&& other);
+
+  pid_t pid() const;
+
+  /// @return the read end of the output pipe, -1 if there is none
+  int outputDescriptor() const;
+
+  /// @return the read end of the error pipe, -1 if there is none
+  int errorDescriptor() const;
+
+  /// reap the process if it has exited, without blocking. @return true if it has exited
+  bool tryWait();
+
+  /// wait until the process exits or the timeout expires. @return true if it has exited
+  bool waitFor(std::chrono::milliseconds timeout);
+
+  /// wait until the process exits. @return the exit code
+  int wait();
+
+  /// @return true if the process has exited and has been reaped
+  bool finished() const;
+
+  /// @return the exit status, or 128 + the signal number if killed by a signal
+  int exitCode() const;
+
+  /// send a signal to the process if it is still running
+  void kill(int signal_number);
+
+  /**
+   * @brief
+   *   read the output and error pipes until they are closed and wait for the process
+   * @param timeout
+   *   the process is killed when it expires. 0 means no limit
+   */
+  ProcessResult communicate(std::chrono::milliseconds timeout = std::chrono::milliseconds{0});
+
+private:
+  Process(pid_t pid, int output_descriptor, int error_descriptor);
+
+  void closeDescriptors();
+
+  pid_t m_pid;
+  int   m_output_descriptor;
+  int   m_error_descriptor;
+  bool  m_finished;
+  int   m_exit_code;
+};
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PROCESS_H_
+
+/**@}*/
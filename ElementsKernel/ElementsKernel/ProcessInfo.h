@@ -0,0 +1,145 @@
+/**
+ * @file ElementsKernel/ProcessInfo.h
+ * @brief Resource usage of the running process
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PROCESSINFO_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_PROCESSINFO_H_
+
+#include <cstdint>  // for uint64_t, int64_t
+
+#include "ElementsKernel/Export.h"      // ELEMENTS_API
+#include "ElementsKernel/SystemBase.h"  // for InfoType
+
+namespace Elements {
+namespace System {
+
+/// value of the limits which are not set
+constexpr std::uint64_t UNLIMITED{UINT64_MAX};
+
+/// InfoType::Memory, from /proc/self/status. The sizes are in bytes
+struct ELEMENTS_API MemoryUsage {
+  std::uint64_t virtual_size;
+  std::uint64_t peak_virtual_size;
+  std::uint64_t resident_size;
+  std::uint64_t peak_resident_size;
+  std::uint64_t data_size;  ///< heap and anonymous mappings
+  std::uint64_t stack_size;
+  std::uint64_t swap_size;
+};
+
+/// InfoType::IO, from /proc/self/io
+struct ELEMENTS_API IoCounters {
+  std::uint64_t read_characters;     ///< bytes passed to the read system calls, including the page cache hits
+  std::uint64_t written_characters;  ///< bytes passed to the write system calls
+  std::uint64_t read_calls;
+  std::uint64_t write_calls;
+  std::uint64_t read_bytes;  ///< bytes fetched from the storage
+  std::uint64_t written_bytes;
+  std::uint64_t cancelled_written_bytes;
+};
+
+/// InfoType::Times, from /proc/self/stat
+struct ELEMENTS_API CpuTimes {
+  double        user_time;    ///< in seconds
+  double        system_time;  ///< in seconds
+  std::uint64_t minor_page_faults;
+  std::uint64_t major_page_faults;  ///< the ones which needed a read from the storage
+};
+
+/// InfoType::ProcessBasics, from /proc/self/stat and /proc/self/fd
+struct ELEMENTS_API ProcessBasics {
+  std::int64_t  process_id;
+  std::int64_t  parent_process_id;
+  std::int64_t  priority;
+  std::int64_t  nice;
+  std::uint64_t thread_number;
+  std::uint64_t open_file_descriptor_number;
+};
+
+/// InfoType::Quota, the soft resource limits and the memory limit of the control group. UNLIMITED if not set
+struct ELEMENTS_API ResourceQuota {
+  std::uint64_t address_space;  ///< in bytes
+  std::uint64_t data_size;      ///< in bytes
+  std::uint64_t stack_size;     ///< in bytes
+  std::uint64_t file_descriptor_number;
+  std::uint64_t cpu_time;              ///< in seconds
+  std::uint64_t control_group_memory;  ///< in bytes, memory.max (v2) or memory.limit_in_bytes (v1) of its group
+};
+
+/// InfoType::RemainTime, from RLIMIT_CPU and /proc/self/stat
+struct ELEMENTS_API RemainingTime {
+  double cpu_time;  ///< in seconds before SIGXCPU, a negative value if there is no limit
+};
+
+/**
+ * @class ProcessInfo
+ * @brief
+ *   resource usage of the running process
+ * @details
+ *   Only the part of the requested InfoType is filled, the others are
+ *   left untouched.
+ */
+struct ELEMENTS_API ProcessInfo {
+  MemoryUsage   memory;
+  IoCounters    io;
+  CpuTimes      times;
+  ProcessBasics basics;
+  ResourceQuota quota;
+  RemainingTime remain_time;
+};
+
+/**
+ * @brief
+ *   fill a part of a ProcessInfo
+ * @details
+ *   Each call reads the needed /proc file once into a buffer on the
+ *   stack and parses it in place: there is no memory allocation, and
+ *   the function can be called periodically, e.g. to enforce a memory
+ *   budget.
+ * @param type
+ *   Memory, IO, Times, ProcessBasics, Quota or RemainTime. NoFetch does
+ *   nothing
+ * @return false if the type is not supported or if the information
+ *   cannot be read (e.g. /proc/self/io is not readable in some
+ *   containers)
+ */
+ELEMENTS_API bool processInfo(InfoType type, ProcessInfo& info) noexcept;
+
+/**
+ * @brief
+ *   a part of the resource usage of the running process
+ * @return a ProcessInfo, whose parts other than the requested one are 0
+ * @throws Exception
+ *   if the information is not available
+ */
+ELEMENTS_API ProcessInfo processInfo(InfoType type);
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PROCESSINFO_H_
+
+/**@}*/
@@ -0,0 +1,122 @@
+/**
+ * @file ElementsKernel/StackTrace.h
+ * @brief Capture and symbolization of the call stack
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_STACKTRACE_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_STACKTRACE_H_
+
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+
+namespace Elements {
+namespace System {
+
+/// maximum number of frames kept by a StackTrace
+constexpr std::size_t MAX_STACK_DEPTH{128};
+
+/// symbolic information about a frame of a StackTrace
+struct ELEMENTS_API StackFrame {
+  void*       address;         ///< program counter
+  void*       symbol_address;  ///< start of the function, nullptr if unknown
+  std::string function;        ///< demangled name of the function, "local" if it is not exported and unknown
+  std::string library;         ///< executable or shared library, empty if unknown
+  std::string file;            ///< source file, empty if unknown
+  unsigned    line;            ///< source line, 0 if unknown
+};
+
+/**
+ * @class StackTrace
+ * @brief
+ *   program counters of the call stack
+ * @details
+ *   The capture is split from the symbolization. capture and write
+ *   don't allocate and are async-signal-safe: they can be used in a
+ *   signal handler. The symbolization is done later on the whole
+ *   trace, and the symbols are cached per address. The cache is
+ *   dropped when a library is loaded or unloaded (Linux only), since
+ *   the addresses of an unloaded library can be reused.
+ *
+ *   The source file and line are looked up in the DWARF information
+ *   with the addr2line tool, one run per library, when it is
+ *   installed (Linux only). The names of the functions which are not
+ *   exported are found there as well.
+ */
+class ELEMENTS_API StackTrace {
+
+public:
+  StackTrace() noexcept;
+
+  /**
+   * @brief
+   *   capture the call stack of the calling function
+   * @param skip
+   *   number of the innermost frames to drop, above the caller
+   * @param depth
+   *   maximum number of frames to keep. The outer frames are not
+   *   unwound at all
+   */
+  void capture(std::size_t skip = 0, std::size_t depth = MAX_STACK_DEPTH) noexcept;
+
+  /// @return the number of captured frames
+  std::size_t size() const noexcept;
+
+  /// @return the program counter of a frame. 0 is the innermost one
+  void* operator[](std::size_t level) const noexcept;
+
+  /// write the program counters in hexadecimal, one per line. It is async-signal-safe
+  void write(int file_descriptor) const noexcept;
+
+  /**
+   * @brief
+   *   resolve the symbols of all the frames
+   * @param with_lines
+   *   look for the source file and line as well. This is much slower
+   *   the first time a library is met
+   */
+  std::vector<StackFrame> symbolize(bool with_lines = false) const;
+
+  /// @return the number of addresses in the symbol cache
+  static std::size_t symbolCacheSize();
+
+  static void clearSymbolCache();
+
+private:
+  void*       m_addresses[MAX_STACK_DEPTH];
+  std::size_t m_size;
+};
+
+/// @return "#<level> <symbol address> <function>  [<library>]" and the source location if known
+ELEMENTS_API std::string formatStackFrame(std::size_t level, const StackFrame& frame);
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_STACKTRACE_H_
+
+/**@}*/
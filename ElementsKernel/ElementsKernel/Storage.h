@@ -26,9 +26,12 @@
 #ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_STORAGE_H_
 #define ELEMENTSKERNEL_ELEMENTSKERNEL_STORAGE_H_
 
-#include <cstdint>  // for int64_t
-#include <map>      // for map
-#include <string>   // for string
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int64_t
+#include <stdexcept>  // for out_of_range
+#include <string>     // for string
+#include <utility>    // for pair
 
 #include "ElementsKernel/Export.h"
 
@@ -50,8 +53,154 @@ enum class StorageType {
   MetricPetaByte
 };
 
-ELEMENTS_API extern std::map<StorageType, std::string>  StorageShortName;
-ELEMENTS_API extern std::map<StorageType, std::int64_t> StorageFactor;
+/// Number of entries of the StorageType enumeration
+constexpr std::size_t STORAGE_TYPE_NUMBER{11};
+
+/// Number of bytes of each StorageType, indexed by the enumeration value
+constexpr std::array<std::int64_t, STORAGE_TYPE_NUMBER> STORAGE_FACTOR_TABLE{
+    {1, 1LL << 10, 1LL << 20, 1LL << 30, 1LL << 40, 1LL << 50, 1000LL, 1000000LL, 1000000000LL, 1000000000000LL,
+     1000000000000000LL}};
+
+/// Default number of decimal digits kept when converting to each StorageType. It is
+/// the integer part of the decimal logarithm of the unit factor.
+constexpr std::array<std::size_t, STORAGE_TYPE_NUMBER> STORAGE_DIGITS_TABLE{{0, 3, 6, 9, 12, 15, 3, 6, 9, 12, 15}};
+
+/// Short name of each StorageType, indexed by the enumeration value
+constexpr std::array<const char*, STORAGE_TYPE_NUMBER> STORAGE_SHORT_NAME_TABLE{
+    {"B", "KiB", "MiB", "GiB", "TiB", "PiB", "KB", "MB", "GB", "TB", "PB"}};
+
+/// Powers of 10 that fit in a std::int64_t
+constexpr std::array<std::int64_t, 19> DECIMAL_POWER_TABLE{{1LL,
+                                                            10LL,
+                                                            100LL,
+                                                            1000LL,
+                                                            10000LL,
+                                                            100000LL,
+                                                            1000000LL,
+                                                            10000000LL,
+                                                            100000000LL,
+                                                            1000000000LL,
+                                                            10000000000LL,
+                                                            100000000000LL,
+                                                            1000000000000LL,
+                                                            10000000000000LL,
+                                                            100000000000000LL,
+                                                            1000000000000000LL,
+                                                            10000000000000000LL,
+                                                            100000000000000000LL,
+                                                            1000000000000000000LL}};
+
+/**
+ * @brief number of bytes of a storage unit
+ * @param unit
+ *   the storage unit
+ * @return the multiplicative factor to bytes, computed at compile time when possible
+ */
+constexpr std::int64_t storageFactor(StorageType unit) {
+  return STORAGE_FACTOR_TABLE[static_cast<std::size_t>(unit)];
+}
+
+/**
+ * @brief default rounding digits of a storage unit
+ * @param unit
+ *   the storage unit
+ * @return the number of decimal digits used by storageConvert for this target unit
+ */
+constexpr std::size_t storageDigits(StorageType unit) {
+  return STORAGE_DIGITS_TABLE[static_cast<std::size_t>(unit)];
+}
+
+/**
+ * @brief short name of a storage unit
+ * @param unit
+ *   the storage unit
+ * @return the short name (e.g. "GiB") as a static C string
+ */
+constexpr const char* storageShortName(StorageType unit) {
+  return STORAGE_SHORT_NAME_TABLE[static_cast<std::size_t>(unit)];
+}
+
+/**
+ * @class StorageTable
+ * @brief Immutable table indexed by the StorageType enumeration
+ * @details
+ *   The entries are stored contiguously in the order of the enumeration and the
+ *   lookup is a plain array indexing. The table cannot be modified after its
+ *   construction and it is thus safe to read it concurrently from several threads.
+ *   It provides the read-only subset of the std::map interface.
+ * @tparam T
+ *   type of the stored values
+ */
+template <typename T>
+class StorageTable {
+
+public:
+  using key_type       = StorageType;
+  using mapped_type    = T;
+  using value_type     = std::pair<StorageType, T>;
+  using size_type      = std::size_t;
+  using const_iterator = typename std::array<value_type, STORAGE_TYPE_NUMBER>::const_iterator;
+
+  /**
+   * @brief Constructor
+   * @param values
+   *   the values in the order of the StorageType enumeration
+   */
+  template <typename U>
+  explicit StorageTable(const std::array<U, STORAGE_TYPE_NUMBER>& values) {
+    for (std::size_t i = 0; i < STORAGE_TYPE_NUMBER; ++i) {
+      m_entries[i] = value_type(static_cast<StorageType>(i), T(values[i]));
+    }
+  }
+
+  const T& operator[](StorageType unit) const {
+    return m_entries[static_cast<std::size_t>(unit)].second;
+  }
+
+  const T& at(StorageType unit) const {
+    if (static_cast<std::size_t>(unit) >= STORAGE_TYPE_NUMBER) {
+      throw std::out_of_range("Invalid StorageType");
+    }
+    return operator[](unit);
+  }
+
+  const_iterator find(StorageType unit) const {
+    return static_cast<std::size_t>(unit) < STORAGE_TYPE_NUMBER ? cbegin() + static_cast<std::ptrdiff_t>(unit)
+                                                                : cend();
+  }
+
+  size_type count(StorageType unit) const {
+    return static_cast<std::size_t>(unit) < STORAGE_TYPE_NUMBER ? 1 : 0;
+  }
+
+  constexpr size_type size() const {
+    return STORAGE_TYPE_NUMBER;
+  }
+
+  const_iterator begin() const {
+    return m_entries.cbegin();
+  }
+
+  const_iterator end() const {
+    return m_entries.cend();
+  }
+
+  const_iterator cbegin() const {
+    return m_entries.cbegin();
+  }
+
+  const_iterator cend() const {
+    return m_entries.cend();
+  }
+
+private:
+  std::array<value_type, STORAGE_TYPE_NUMBER> m_entries{};
+};
+
+/// Short name of each StorageType. Kept for backward compatibility, storageShortName is preferred.
+ELEMENTS_API extern const StorageTable<std::string> StorageShortName;
+/// Number of bytes of each StorageType. Kept for backward compatibility, storageFactor is preferred.
+ELEMENTS_API extern const StorageTable<std::int64_t> StorageFactor;
 
 template <typename T>
 ELEMENTS_API T roundToDigits(const T& value, const std::size_t& max_digits);
@@ -72,6 +221,67 @@ extern template ELEMENTS_API float  storageConvert<float>(const float& size, Sto
 extern template ELEMENTS_API        std::int64_t
 storageConvert<std::int64_t>(const std::int64_t& size, StorageType source_unit, StorageType target_unit);
 
+/**
+ * @brief select the largest unit of a family which is not bigger than a size
+ * @param size_in_bytes
+ *   the size to be represented
+ * @param metric
+ *   if true, select among the decimal units (KB, MB, ...), otherwise among the
+ *   binary ones (KiB, MiB, ...)
+ * @return the best unit to display the size
+ */
+ELEMENTS_API StorageType bestStorageUnit(std::int64_t size_in_bytes, bool metric = false) noexcept;
+
+/**
+ * @brief write a human readable representation of a size (e.g. "3.2 GiB")
+ * @details
+ *   The conversion is done with integer arithmetic and the result is rounded
+ *   to the nearest value. Nothing is allocated.
+ * @param size_in_bytes
+ *   the size to be written
+ * @param unit
+ *   the unit used for the representation
+ * @param buffer
+ *   the output character buffer. It is always null terminated if buffer_size is not 0.
+ * @param buffer_size
+ *   the size of the output buffer
+ * @param max_digits
+ *   number of decimal digits written after the decimal point. No decimal digit
+ *   is written for the Byte unit.
+ * @return the number of characters written (without the terminating null character)
+ *   or 0 if the buffer is too small
+ */
+ELEMENTS_API std::size_t formatStorage(std::int64_t size_in_bytes, StorageType unit, char* buffer,
+                                       std::size_t buffer_size, std::size_t max_digits = 1) noexcept;
+
+/**
+ * @brief write a human readable representation of a size with the best suited unit
+ * @details
+ *   The unit is selected with bestStorageUnit.
+ * @return the number of characters written (without the terminating null character)
+ *   or 0 if the buffer is too small
+ */
+ELEMENTS_API std::size_t formatStorage(std::int64_t size_in_bytes, char* buffer, std::size_t buffer_size,
+                                       std::size_t max_digits = 1, bool metric = false) noexcept;
+
+/**
+ * @brief parse a human readable size (e.g. "3.2 GiB") into a number of bytes
+ * @details
+ *   The accepted format is an optional sign, a decimal number, optional blanks and an
+ *   optional unit short name (see STORAGE_SHORT_NAME_TABLE). Without unit, the size
+ *   is in bytes. The result is rounded to the nearest byte. Nothing is allocated.
+ * @param text
+ *   the characters to be parsed
+ * @param length
+ *   the number of characters to be parsed
+ * @param size_in_bytes
+ *   the parsed value. It is left untouched if the parsing fails.
+ * @return true if the whole text could be parsed
+ */
+ELEMENTS_API bool parseStorage(const char* text, std::size_t length, std::int64_t& size_in_bytes) noexcept;
+
+ELEMENTS_API bool parseStorage(const std::string& text, std::int64_t& size_in_bytes) noexcept;
+
 }  // namespace Units
 }  // namespace Kernel
 }  // namespace Elements
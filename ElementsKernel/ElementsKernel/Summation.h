@@ -0,0 +1,145 @@
+/**
+ * @file ElementsKernel/Summation.h
+ * @brief Accurate summation of large floating point sequences
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_SUMMATION_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_SUMMATION_H_
+
+#include <cstddef>      // for size_t
+#include <type_traits>  // for decay
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+
+namespace Elements {
+
+/// Number of independent accumulators used by the lane based kernels
+constexpr std::size_t SUMMATION_LANE_NUMBER{8};
+
+/// Size of the blocks which are summed naively by pairwiseSum
+constexpr std::size_t PAIRWISE_BLOCK_SIZE{128};
+
+/**
+ * @class CompensatedSum
+ * @brief
+ *   Streaming compensated (Kahan-Babuska-Neumaier) accumulator.
+ * @details
+ *   The rounding error of each addition is kept in a separate
+ *   compensation term. The error of the result does not grow with
+ *   the number of terms, even when some of them are larger than the
+ *   running sum.
+ * @tparam T
+ *   floating point type
+ */
+template <typename T>
+class ELEMENTS_API CompensatedSum {
+public:
+  explicit CompensatedSum(T initial_value = T{0});
+
+  CompensatedSum& add(T value);
+
+  CompensatedSum& operator+=(T value);
+
+  /// add the partial sum of another accumulator
+  CompensatedSum& merge(const CompensatedSum& other);
+
+  /// @return the compensated sum
+  T value() const;
+
+private:
+  T m_sum;
+  T m_compensation;
+};
+
+/**
+ * @brief
+ *   naive left to right summation. It is only provided as a reference.
+ */
+template <typename Iterator>
+ELEMENTS_API auto naiveSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type;
+
+/**
+ * @brief
+ *   compensated summation (Kahan-Babuska-Neumaier) of a sequence
+ */
+template <typename Iterator>
+ELEMENTS_API auto kahanSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type;
+
+/**
+ * @brief
+ *   pairwise (cascade) summation of a sequence
+ * @details
+ *   The range is split in halves recursively down to blocks of
+ *   PAIRWISE_BLOCK_SIZE elements which are summed naively. The error
+ *   grows as O(log n) instead of O(n) for the naive loop, at nearly
+ *   the same speed.
+ */
+template <typename Iterator>
+ELEMENTS_API auto pairwiseSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type;
+
+/**
+ * @brief
+ *   compensated summation with SUMMATION_LANE_NUMBER independent
+ *   Kahan accumulators
+ * @details
+ *   The lanes have no dependency between each other and are written
+ *   so that the compiler can map them onto SIMD registers. The lanes
+ *   are merged with a compensated sum at the end.
+ */
+template <typename Iterator>
+ELEMENTS_API auto blockedKahanSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type;
+
+/**
+ * @brief
+ *   multithreaded compensated summation
+ * @details
+ *   The data is split in contiguous chunks, each of them summed with
+ *   blockedKahanSum by its own thread. The partial sums are merged
+ *   with a compensated sum. Small inputs are summed in the calling
+ *   thread, and so are the chunks of the threads which cannot be
+ *   started.
+ * @param data
+ *   pointer to the first element
+ * @param size
+ *   number of elements
+ * @param thread_number
+ *   maximum number of threads. 0 means the hardware concurrency.
+ * @return the compensated sum
+ */
+ELEMENTS_API double parallelSum(const double* data, std::size_t size, std::size_t thread_number = 0);
+
+ELEMENTS_API float parallelSum(const float* data, std::size_t size, std::size_t thread_number = 0);
+
+extern template class CompensatedSum<double>;
+extern template class CompensatedSum<float>;
+
+}  // namespace Elements
+
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_SUMMATION_IMPL_
+#include "ElementsKernel/_impl/Summation.tpp"
+#undef ELEMENTSKERNEL_ELEMENTSKERNEL_SUMMATION_IMPL_
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_SUMMATION_H_
+
+/**@}*/
@@ -38,6 +38,8 @@
 #include <typeinfo>
 #include <vector>
 
+#include <boost/utility/string_view.hpp>  // for string_view
+
 // Framework include files
 #include "ElementsKernel/Export.h"  // ELEMENTS_API
 #include "ElementsKernel/Unused.h"  // ELEMENTS_UNUSED
@@ -128,9 +130,12 @@ ELEMENTS_API unsigned long getLastError();
 ELEMENTS_API const std::string getLastErrorString();
 /// Retrieve error code as string for a given error
 ELEMENTS_API const std::string getErrorString(unsigned long error);
-/// Get platform independent information about the class type
+/// Get platform independent information about the class type. The demangled names are cached
 ELEMENTS_API const std::string typeinfoName(const std::type_info&);
 ELEMENTS_API const std::string typeinfoName(const char*);
+/// Name of a type, as written by the compiler, computed at compile time (e.g. "std::vector<int>")
+template <typename T>
+constexpr boost::string_view typeName();
 /// Host name
 ELEMENTS_API const std::string& hostName();
 /// OS name
@@ -166,6 +171,10 @@ ELEMENTS_API bool getStackLevel(ELEMENTS_UNUSED void* addresses, ELEMENTS_UNUSED
 }  // namespace System
 }  // namespace Elements
 
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEM_IMPL_
+#include "ElementsKernel/_impl/System.tpp"
+#undef ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEM_IMPL_
+
 #endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEM_H_
 
 /**@}*/
@@ -0,0 +1,112 @@
+/**
+ * @file ElementsKernel/SystemInfo.h
+ * @brief Snapshot of the host and hardware description
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+/**
+ * @addtogroup ElementsKernel ElementsKernel
+ * @{
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEMINFO_H_
+#define ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEMINFO_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <string>   // for string
+
+#include "ElementsKernel/Export.h"  // ELEMENTS_API
+
+namespace Elements {
+namespace System {
+
+/// SIMD instruction sets, usable as bits of SystemInfo::simd_features
+enum class SimdFeature : std::uint32_t {
+  SSE2     = 1U << 0,
+  SSE3     = 1U << 1,
+  SSSE3    = 1U << 2,
+  SSE4_1   = 1U << 3,
+  SSE4_2   = 1U << 4,
+  AVX      = 1U << 5,
+  AVX2     = 1U << 6,
+  FMA      = 1U << 7,
+  AVX512F  = 1U << 8,
+  NEON     = 1U << 9,
+  POPCNT   = 1U << 10,
+  BMI2     = 1U << 11,
+  AVX512DQ = 1U << 12,
+  AVX512BW = 1U << 13,
+  AVX512VL = 1U << 14
+};
+
+/// @return the combination of the bits of the features
+constexpr std::uint32_t simdFeatures() {
+  return 0;
+}
+
+template <typename... Features>
+constexpr std::uint32_t simdFeatures(SimdFeature first, Features... others) {
+  return static_cast<std::uint32_t>(first) | simdFeatures(others...);
+}
+
+/**
+ * @class SystemInfo
+ * @brief
+ *   description of the host and of its hardware
+ * @details
+ *   The sizes are 0 when they are not known. The detailed description
+ *   of the processors is provided by cpuTopology().
+ */
+struct ELEMENTS_API SystemInfo {
+  std::string   host_name;
+  std::string   os_name;
+  std::string   os_version;
+  std::string   machine_type;
+  std::size_t   cpu_number;        ///< online logical processors
+  std::size_t   numa_node_number;  ///< at least 1
+  std::size_t   page_size;         ///< in bytes
+  std::size_t   physical_memory;   ///< in bytes
+  std::size_t   cache_line_size;   ///< in bytes
+  std::size_t   l1_data_cache_size;
+  std::size_t   l2_cache_size;
+  std::size_t   l3_cache_size;
+  std::uint32_t simd_features;  ///< combination of SimdFeature bits
+
+  bool hasSimd(SimdFeature feature) const;
+
+  /// @return the names of the supported SIMD instruction sets, separated by spaces (e.g. "sse2 avx avx2")
+  std::string simdFeatureNames() const;
+};
+
+/**
+ * @brief
+ *   the description of the host
+ * @details
+ *   It is read once, at the first call, in a thread-safe way. The
+ *   later calls don't do any system call.
+ */
+ELEMENTS_API const SystemInfo& systemInfo();
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEMINFO_H_
+
+/**@}*/
@@ -22,23 +22,35 @@
 #error "This file should not be included directly! Use ElementsKernel/Auxiliary.h instead"
 #else
 
-#include "ElementsKernel/Exception.h"  // for Exception
-#include "ElementsKernel/Path.h"       // for Path::VARIABLE, Path::Type, Path::Item
-                                       // getPathFromLocations
+#include "ElementsKernel/AuxiliaryCache.h"   // for AuxiliaryCache
+#include "ElementsKernel/Exception.h"        // for Exception
+#include "ElementsKernel/Path.h"             // for Path::VARIABLE, Path::Type, Path::Item
+#include "ElementsKernel/PathLookupCache.h"  // for Path::LookupCache
+#include "ElementsKernel/PathResolver.h"     // for Path::Resolver
+
 namespace Elements {
 inline namespace Kernel {
 
 template <typename T>
 Path::Item getAuxiliaryPath(const T& file_name, bool raise_exception) {
 
-  auto location_list = getAuxiliaryLocations();
+  // the locations are cached between the calls, the file is looked up with the strategy of the process
+  auto location_list = Path::LookupCache::instance().getLocations(getAuxiliaryVariableName(), []() {
+    return getAuxiliaryLocations();
+  });
 
-  auto result = Path::getPathFromLocations(file_name, location_list);
+  auto result = Path::Resolver::instance().resolvePath(Path::Item{file_name}, *location_list);
 
   if (result.empty() and raise_exception) {
     throw Exception() << "The auxiliary path \"" << file_name << "\" cannot be found!";
   }
 
+  // the optional node-local copy
+  auto local_cache = AuxiliaryCache::fromEnvironment();
+  if (local_cache != nullptr and not result.empty()) {
+    result = local_cache->get(result);
+  }
+
   return result;
 }
 
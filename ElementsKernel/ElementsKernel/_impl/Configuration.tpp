@@ -22,9 +22,10 @@
 #error "This file should not be included directly! Use ElementsKernel/Configuration.h instead"
 #else
 
-#include "ElementsKernel/Exception.h"  // for Exception
-#include "ElementsKernel/Path.h"       // for Path::VARIABLE, Path::Type, Path::Item
-                                       // getPathFromLocations
+#include "ElementsKernel/Exception.h"        // for Exception
+#include "ElementsKernel/Path.h"             // for Path::VARIABLE, Path::Type, Path::Item
+#include "ElementsKernel/PathLookupCache.h"  // for Path::LookupCache
+#include "ElementsKernel/PathResolver.h"     // for Path::Resolver
 
 namespace Elements {
 inline namespace Kernel {
@@ -32,9 +33,12 @@ inline namespace Kernel {
 template <typename T>
 Path::Item getConfigurationPath(const T& file_name, bool raise_exception) {
 
-  auto location_list = getConfigurationLocations();
+  // the locations are cached between the calls, the file is looked up with the strategy of the process
+  auto location_list = Path::LookupCache::instance().getLocations(getConfigurationVariableName(), []() {
+    return getConfigurationLocations();
+  });
 
-  auto result = Path::getPathFromLocations(file_name, location_list);
+  auto result = Path::Resolver::instance().resolvePath(Path::Item{file_name}, *location_list);
 
   if (result.empty() and raise_exception) {
     throw Exception() << "The configuration path \"" << file_name << "\" cannot be found!";
@@ -0,0 +1,70 @@
+/**
+ * @file ElementsKernel/_impl/MultiVersion.tpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_MULTIVERSION_IMPL_
+#error "This file should not be included directly! Use ElementsKernel/MultiVersion.h instead"
+#else
+
+#include <cstdint>           // for uint32_t
+#include <initializer_list>  // for initializer_list
+#include <utility>           // for forward
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Hardware.h"   // for cpuTopology
+
+namespace Elements {
+namespace System {
+
+template <typename Result, typename... Arguments>
+MultiVersion<Result(Arguments...)>::MultiVersion(std::initializer_list<Version> versions)
+    : MultiVersion(versions, cpuTopology().isa_features) {}
+
+template <typename Result, typename... Arguments>
+MultiVersion<Result(Arguments...)>::MultiVersion(std::initializer_list<Version> versions,
+                                                 std::uint32_t                  available_features)
+    : m_selected(select(versions, available_features)) {}
+
+template <typename Result, typename... Arguments>
+Result MultiVersion<Result(Arguments...)>::operator()(Arguments... arguments) const {
+  return m_selected.function(std::forward<Arguments>(arguments)...);
+}
+
+template <typename Result, typename... Arguments>
+auto MultiVersion<Result(Arguments...)>::selected() const -> const Version& {
+  return m_selected;
+}
+
+template <typename Result, typename... Arguments>
+auto MultiVersion<Result(Arguments...)>::select(std::initializer_list<Version> versions,
+                                                std::uint32_t available_features) -> Version {
+  for (const auto& v : versions) {
+    if ((v.required_features & available_features) == v.required_features and v.function != nullptr) {
+      return v;
+    }
+  }
+  throw Exception() << "None of the " << versions.size() << " implementations can run on this processor";
+}
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_MULTIVERSION_IMPL_
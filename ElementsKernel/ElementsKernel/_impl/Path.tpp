@@ -22,13 +22,14 @@
 #error "This file should not be included directly! Use ElementsKernel/Path.h instead"
 #else
 
-#include <algorithm>      // for find_if, transform, for_each
+#include <algorithm>      // for find_if
+#include <cstddef>        // for size_t
 #include <string>         // for string
 #include <unordered_set>  // for unordered_set
 #include <vector>         // for vector
 
-#include <boost/algorithm/string/join.hpp>  // for join
-#include <boost/filesystem/operations.hpp>  // for exists
+#include <boost/functional/hash.hpp>      // for hash_range
+#include <boost/utility/string_view.hpp>  // for string_view
 
 namespace Elements {
 inline namespace Kernel {
@@ -41,7 +42,7 @@ Item getPathFromLocations(const T& file_name, const std::vector<U>& locations) {
   Item file_path{file_name};
 
   auto found_pos = std::find_if(locations.cbegin(), locations.cend(), [file_path](const U& l) {
-    return boost::filesystem::exists(Item{l} / file_path);
+    return existsInLocation(file_path, Item{l});
   });
 
   if (found_pos != locations.cend()) {
@@ -54,18 +55,14 @@ Item getPathFromLocations(const T& file_name, const std::vector<U>& locations) {
 template <typename T, typename U>
 std::vector<Item> getAllPathFromLocations(const T& file_name, const std::vector<U>& locations) {
 
-  std::vector<Item> file_list(locations.size());
+  std::vector<Item> file_list;
   Item              file_path{file_name};
 
-  std::transform(locations.cbegin(), locations.cend(), file_list.begin(), [file_path](const U& l) {
-    return Item{l} / file_path;
-  });
-
-  auto found_pos = std::remove_if(file_list.begin(), file_list.end(), [](const Item& p) {
-    return not boost::filesystem::exists(p);
-  });
-
-  file_list.erase(found_pos, file_list.end());
+  for (const auto& l : locations) {
+    if (existsInLocation(file_path, Item{l})) {
+      file_list.emplace_back(Item{l} / file_path);
+    }
+  }
 
   return removeDuplicates(file_list);
 }
@@ -80,19 +77,37 @@ Item getPathFromEnvVariable(const T& file_name, const std::string& path_variable
   return getPathFromLocations(file_name, location_list);
 }
 
+/// the string of a path without copy for the most common types
+inline const std::string& pathString(const std::string& path) {
+  return path;
+}
+
+inline const std::string& pathString(const Item& path) {
+  return path.native();
+}
+
 template <typename T>
-std::string joinPath(const std::vector<T>& path_list) {
+std::string pathString(const T& path) {
+  return Item{path}.string();
+}
 
-  using std::string;
-  using std::vector;
+template <typename T>
+std::string joinPath(const std::vector<T>& path_list) {
 
-  vector<string> elems(path_list.size());
+  std::size_t length = 0;
+  for (const auto& p : path_list) {
+    length += pathString(p).size() + PATH_SEP.size();
+  }
 
-  std::transform(path_list.cbegin(), path_list.cend(), elems.begin(), [](const T& s) {
-    return Item{s}.string();
-  });
+  std::string result;
+  result.reserve(length);
 
-  std::string result = boost::algorithm::join(elems, PATH_SEP);
+  for (const auto& p : path_list) {
+    if (&p != &path_list.front()) {
+      result += PATH_SEP;
+    }
+    result += pathString(p);
+  }
 
   return result;
 }
@@ -110,34 +125,121 @@ auto split(Args&&... args) -> decltype(splitPath(std::forward<Args>(args)...)) {
 template <typename T, typename U>
 std::vector<Item> multiPathAppend(const std::vector<T>& initial_locations, const std::vector<U>& suffixes) {
 
-  using std::vector;
+  std::vector<Item> result;
+  result.reserve(initial_locations.size() * suffixes.size());
+
+  for (const auto& l : initial_locations) {
+    const Item location{l};
+    for (const auto& s : suffixes) {
+      result.emplace_back(location);
+      result.back() /= s;
+    }
+  }
 
-  vector<Item> result(initial_locations.size() * suffixes.size());
+  return result;
+}
 
-  auto pos = result.begin();
+template <typename T, typename U>
+MultiPathRange<T, U>::const_iterator::const_iterator(const MultiPathRange& range, std::size_t position)
+    : m_range{&range}, m_position{position} {}
 
-  std::for_each(initial_locations.cbegin(), initial_locations.cend(), [&pos, &suffixes](const T& l) {
-    std::transform(suffixes.cbegin(), suffixes.cend(), pos, [l](const U& s) {
-      return Item{l} / s;
-    });
-    pos += static_cast<std::ptrdiff_t>(suffixes.size());
-  });
+template <typename T, typename U>
+Item MultiPathRange<T, U>::const_iterator::operator*() const {
+  const std::size_t suffix_number = m_range->m_suffixes.size();
+  return Item{m_range->m_initial_locations[m_position / suffix_number]} /
+         m_range->m_suffixes[m_position % suffix_number];
+}
+
+template <typename T, typename U>
+auto MultiPathRange<T, U>::const_iterator::operator++() -> const_iterator& {
+  ++m_position;
+  return *this;
+}
+
+template <typename T, typename U>
+auto MultiPathRange<T, U>::const_iterator::operator++(int) -> const_iterator {
+  const_iterator previous{*this};
+  ++m_position;
+  return previous;
+}
+
+template <typename T, typename U>
+bool MultiPathRange<T, U>::const_iterator::operator==(const const_iterator& other) const {
+  return m_range == other.m_range and m_position == other.m_position;
+}
+
+template <typename T, typename U>
+bool MultiPathRange<T, U>::const_iterator::operator!=(const const_iterator& other) const {
+  return not(*this == other);
+}
+
+template <typename T, typename U>
+MultiPathRange<T, U>::MultiPathRange(const std::vector<T>& initial_locations, const std::vector<U>& suffixes)
+    : m_initial_locations{initial_locations}, m_suffixes{suffixes} {}
+
+template <typename T, typename U>
+auto MultiPathRange<T, U>::begin() const -> const_iterator {
+  return const_iterator{*this, 0};
+}
+
+template <typename T, typename U>
+auto MultiPathRange<T, U>::end() const -> const_iterator {
+  return const_iterator{*this, size()};
+}
+
+template <typename T, typename U>
+std::size_t MultiPathRange<T, U>::size() const {
+  return m_initial_locations.size() * m_suffixes.size();
+}
+
+template <typename T, typename U>
+bool MultiPathRange<T, U>::empty() const {
+  return size() == 0;
+}
+
+template <typename T, typename U>
+MultiPathRange<T, U> multiPathRange(const std::vector<T>& initial_locations, const std::vector<U>& suffixes) {
+  return MultiPathRange<T, U>{initial_locations, suffixes};
+}
+
+template <typename T, typename U>
+std::string joinPath(const MultiPathRange<T, U>& path_range) {
+
+  std::string result;
+
+  for (auto it = path_range.begin(); it != path_range.end(); ++it) {
+    if (it != path_range.begin()) {
+      result += PATH_SEP;
+    }
+    result += (*it).native();
+  }
 
   return result;
 }
 
+/// hash of the views used by removeDuplicates
+struct PathViewHash {
+  std::size_t operator()(boost::string_view path) const {
+    return boost::hash_range(path.begin(), path.end());
+  }
+};
+
 template <typename T>
 std::vector<Item> removeDuplicates(const std::vector<T>& path_list) {
 
-  std::unordered_set<std::string> s;
-
-  std::vector<Item> output(path_list.size());
+  std::vector<Item> output;
+  output.reserve(path_list.size());
 
-  auto end = copy_if(path_list.cbegin(), path_list.cend(), output.begin(), [&s](const T& i) {
-    return s.insert(Item{i}.string()).second;
-  });
+  // views on the strings of the output items: the reserved vector is never reallocated
+  std::unordered_set<boost::string_view, PathViewHash> s;
+  s.reserve(path_list.size());
 
-  output.erase(end, output.end());
+  for (const auto& p : path_list) {
+    output.emplace_back(p);
+    if (not s.insert(boost::string_view{output.back().native()}).second) {
+      output.pop_back();
+    }
+  }
 
   return output;
 }
@@ -29,6 +29,7 @@
 #include <boost/filesystem/operations.hpp>
 
 #include "ElementsKernel/Path.h"
+#include "ElementsKernel/PathIndex.h"
 
 namespace Elements {
 inline namespace Kernel {
@@ -62,13 +63,22 @@ std::vector<T> searchOption(std::string searched_name, T directory, SearchType s
 
   // create a local tmp vector result to avoid multiple return statements
   std::vector<T> searchResults{};
-  switch (search_type) {
-  case SearchType::Local:
-    searchResults = pathSearch<T, boost::filesystem::directory_iterator>(searched_name, directory);
-    break;
-  case SearchType::Recursive:
-    searchResults = pathSearch<T, boost::filesystem::recursive_directory_iterator>(searched_name, directory);
-    break;
+  Path::Item     l_directory{directory};
+  // an indexed directory is searched in memory
+  auto index = Path::Index::get(l_directory);
+  if (index != nullptr) {
+    for (const auto& entry : index->search(searched_name, search_type == SearchType::Recursive)) {
+      searchResults.emplace_back(T{(l_directory / entry).string()});
+    }
+  } else {
+    switch (search_type) {
+    case SearchType::Local:
+      searchResults = pathSearch<T, boost::filesystem::directory_iterator>(searched_name, directory);
+      break;
+    case SearchType::Recursive:
+      searchResults = pathSearch<T, boost::filesystem::recursive_directory_iterator>(searched_name, directory);
+      break;
+    }
   }
   return searchResults;
 }
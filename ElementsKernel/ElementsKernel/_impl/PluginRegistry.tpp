@@ -0,0 +1,47 @@
+/**
+ * @file ElementsKernel/_impl/PluginRegistry.tpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_PLUGINREGISTRY_IMPL_
+#error "This file should not be included directly! Use ElementsKernel/PluginRegistry.h instead"
+#else
+
+#include <string>  // for string
+
+#include "ElementsKernel/Exception.h"    // for Exception
+#include "ElementsKernel/FuncPtrCast.h"  // for FuncPtrCast
+
+namespace Elements {
+namespace System {
+
+template <typename Function>
+Function Plugin::function(const std::string& symbol) const {
+  void* symbol_address = address(symbol);
+  if (symbol_address == nullptr) {
+    throw Exception() << "The symbol " << symbol << " is not defined in the plugin " << name();
+  }
+  return FuncPtrCast<Function>(symbol_address);
+}
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_PLUGINREGISTRY_IMPL_
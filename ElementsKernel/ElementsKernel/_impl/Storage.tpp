@@ -24,8 +24,11 @@
 #error "This file should not be included directly! Use ElementsKernel/Storage.h instead"
 #else
 
-#include <cmath>    // for pow, round
-#include <cstdint>  // for int64_t
+#include <cmath>        // for pow, round
+#include <cstdint>      // for int64_t, uint64_t
+#include <limits>       // for numeric_limits
+#include <stdexcept>    // for overflow_error
+#include <type_traits>  // for is_integral, integral_constant
 
 #include "ElementsKernel/Number.h"  // for numberCast
 
@@ -35,22 +38,169 @@ namespace Units {
 
 template <typename T>
 ELEMENTS_API T roundToDigits(const T& value, const size_t& max_digits) {
-  std::int64_t factor = std::int64_t(std::pow(10, max_digits));
+  std::int64_t factor = max_digits < DECIMAL_POWER_TABLE.size() ? DECIMAL_POWER_TABLE[max_digits]
+                                                                : std::int64_t(std::pow(10, max_digits));
   return std::round(value * static_cast<T>(factor)) / static_cast<T>(factor);
 }
 
+/**
+ * @brief integer division rounded to the nearest value (halfway cases away from zero)
+ * @param numerator
+ *   the value to be divided
+ * @param denominator
+ *   a strictly positive divisor
+ * @return the rounded quotient
+ */
+inline std::int64_t roundedDivision(std::int64_t numerator, std::int64_t denominator) {
+  std::int64_t quotient  = numerator / denominator;
+  std::int64_t remainder = numerator % denominator;
+  if (remainder >= 0 and 2 * remainder >= denominator) {
+    ++quotient;
+  } else if (remainder < 0 and -2 * remainder >= denominator) {
+    --quotient;
+  }
+  return quotient;
+}
+
+/// @return the greatest common divisor of two strictly positive values
+inline std::int64_t greatestCommonDivisor(std::int64_t first, std::int64_t second) {
+  while (second != 0) {
+    const std::int64_t remainder = first % second;
+    first                        = second;
+    second                       = remainder;
+  }
+  return first;
+}
+
+/**
+ * @brief exact product of a magnitude by a ratio, rounded to the nearest value (halfway cases away from zero)
+ * @details
+ *   the magnitude is split into a quotient and a remainder of the denominator. The product of the remainder is
+ *   accumulated bit by bit, its partial remainder staying below the denominator: no intermediate value overflows.
+ * @param magnitude
+ *   the value to be scaled
+ * @param numerator
+ *   a strictly positive multiplier
+ * @param denominator
+ *   a strictly positive divisor, lower than 2^63
+ * @param result
+ *   the rounded value of magnitude * numerator / denominator
+ * @return false if the result cannot be represented on 64 bits
+ */
+inline bool scaleMagnitude(std::uint64_t magnitude, std::uint64_t numerator, std::uint64_t denominator,
+                           std::uint64_t& result) {
+
+  const std::uint64_t max_value = std::numeric_limits<std::uint64_t>::max();
+  const std::uint64_t quotient  = magnitude / denominator;
+  const std::uint64_t remainder = magnitude % denominator;
+  if (quotient > max_value / numerator) {
+    return false;
+  }
+
+  // remainder * numerator = partial_quotient * denominator + partial_remainder
+  std::uint64_t partial_quotient  = 0;
+  std::uint64_t partial_remainder = 0;
+  for (int bit = std::numeric_limits<std::uint64_t>::digits - 1; bit >= 0; --bit) {
+    partial_quotient <<= 1;
+    partial_remainder <<= 1;
+    if (partial_remainder >= denominator) {
+      partial_remainder -= denominator;
+      ++partial_quotient;
+    }
+    if (((numerator >> bit) & 1) != 0) {
+      partial_remainder += remainder;
+      if (partial_remainder >= denominator) {
+        partial_remainder -= denominator;
+        ++partial_quotient;
+      }
+    }
+  }
+  if (2 * partial_remainder >= denominator) {
+    ++partial_quotient;
+  }
+
+  const std::uint64_t product = quotient * numerator;
+  if (partial_quotient > max_value - product) {
+    return false;
+  }
+  result = product + partial_quotient;
+
+  return true;
+}
+
+/// Floating point conversion: the value is rounded to the requested number of digits
+template <typename T>
+T convertStorageValue(const T& size, StorageType source_unit, StorageType target_unit, std::size_t max_digits,
+                      std::false_type) {
+  T            size_in_bytes = size * T(storageFactor(source_unit));
+  std::int64_t target_factor = storageFactor(target_unit);
+  double       value = roundToDigits(static_cast<double>(size_in_bytes) / static_cast<double>(target_factor), max_digits);
+  return Elements::numberCast<T>(value);
+}
+
+/// @return the largest int64_t value which can be represented by T
+template <typename T>
+std::int64_t maxStorageValue() {
+  return std::numeric_limits<T>::digits < std::numeric_limits<std::int64_t>::digits
+             ? static_cast<std::int64_t>(std::numeric_limits<T>::max())
+             : std::numeric_limits<std::int64_t>::max();
+}
+
+/// @return the smallest int64_t value which can be represented by T
+template <typename T>
+std::int64_t minStorageValue() {
+  return std::numeric_limits<T>::is_signed ? static_cast<std::int64_t>(std::numeric_limits<T>::lowest()) : 0;
+}
+
+/// Integer conversion: exact computation, rounded to the nearest integer
+/// @throw std::overflow_error if the converted value cannot be represented by T
+template <typename T>
+T convertStorageValue(const T& size, StorageType source_unit, StorageType target_unit, std::size_t /*max_digits*/,
+                      std::true_type) {
+
+  const std::int64_t source_factor = storageFactor(source_unit);
+  const std::int64_t target_factor = storageFactor(target_unit);
+  const std::int64_t value         = static_cast<std::int64_t>(size);
+  const std::int64_t max_value     = maxStorageValue<T>();
+  const std::int64_t min_value     = minStorageValue<T>();
+
+  std::int64_t result;
+
+  if (source_factor % target_factor == 0) {
+    const std::int64_t factor = source_factor / target_factor;
+    if (value > max_value / factor or value < min_value / factor) {
+      throw std::overflow_error("The converted storage value is out of range");
+    }
+    result = value * factor;
+  } else if (target_factor % source_factor == 0) {
+    result = roundedDivision(value, target_factor / source_factor);
+  } else {
+    // binary to metric units (or the opposite)
+    const std::int64_t  common    = greatestCommonDivisor(source_factor, target_factor);
+    const bool          negative  = value < 0;
+    const std::uint64_t magnitude =
+        negative ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+    const std::uint64_t limit =
+        negative ? 0 - static_cast<std::uint64_t>(min_value) : static_cast<std::uint64_t>(max_value);
+    std::uint64_t       scaled;
+    if (not scaleMagnitude(magnitude, static_cast<std::uint64_t>(source_factor / common),
+                           static_cast<std::uint64_t>(target_factor / common), scaled) or
+        scaled > limit) {
+      throw std::overflow_error("The converted storage value is out of range");
+    }
+    result = negative ? static_cast<std::int64_t>(0 - scaled) : static_cast<std::int64_t>(scaled);
+  }
+
+  return static_cast<T>(result);
+}
+
 template <std::size_t max_digits, typename T>
 ELEMENTS_API T storageConvert(const T& size, StorageType source_unit, StorageType target_unit) {
 
-  using std::log10;
-
   T converted_value = size;
 
   if (source_unit != target_unit) {
-    T       size_in_bytes = size * T(StorageFactor[source_unit]);
-    int64_t target_factor = StorageFactor[target_unit];
-    double  value = roundToDigits(static_cast<double>(size_in_bytes) / static_cast<double>(target_factor), max_digits);
-    converted_value = Elements::numberCast<T>(value);
+    converted_value = convertStorageValue(size, source_unit, target_unit, max_digits, std::is_integral<T>{});
   }
 
   return converted_value;
@@ -59,16 +209,11 @@ ELEMENTS_API T storageConvert(const T& size, StorageType source_unit, StorageTyp
 template <typename T>
 ELEMENTS_API T storageConvert(const T& size, StorageType source_unit, StorageType target_unit) {
 
-  using std::log10;
-
   T converted_value = size;
 
   if (source_unit != target_unit) {
-    T       size_in_bytes = size * T(StorageFactor[source_unit]);
-    int64_t target_factor = StorageFactor[target_unit];
-    double  value         = roundToDigits(static_cast<double>(size_in_bytes) / static_cast<double>(target_factor),
-                                 static_cast<size_t>(log10(static_cast<double>(target_factor))));
-    converted_value       = Elements::numberCast<T>(value);
+    converted_value =
+        convertStorageValue(size, source_unit, target_unit, storageDigits(target_unit), std::is_integral<T>{});
   }
 
   return converted_value;
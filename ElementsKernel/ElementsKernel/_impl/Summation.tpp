@@ -0,0 +1,138 @@
+/**
+ * @file ElementsKernel/_impl/Summation.tpp
+ * @brief implementation of the summation templates
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_SUMMATION_IMPL_
+#error "This file should not be included directly! Use ElementsKernel/Summation.h instead"
+#else
+
+#include <array>     // for array
+#include <cmath>     // for abs
+#include <cstddef>   // for size_t
+#include <iterator>  // for distance, next, iterator_traits
+
+namespace Elements {
+
+template <typename T>
+CompensatedSum<T>::CompensatedSum(T initial_value) : m_sum{initial_value}, m_compensation{T{0}} {}
+
+template <typename T>
+CompensatedSum<T>& CompensatedSum<T>::add(T value) {
+  const T sum = m_sum + value;
+  if (std::abs(m_sum) >= std::abs(value)) {
+    m_compensation += (m_sum - sum) + value;
+  } else {
+    m_compensation += (value - sum) + m_sum;
+  }
+  m_sum = sum;
+  return *this;
+}
+
+template <typename T>
+CompensatedSum<T>& CompensatedSum<T>::operator+=(T value) {
+  return add(value);
+}
+
+template <typename T>
+CompensatedSum<T>& CompensatedSum<T>::merge(const CompensatedSum& other) {
+  add(other.m_sum);
+  m_compensation += other.m_compensation;
+  return *this;
+}
+
+template <typename T>
+T CompensatedSum<T>::value() const {
+  return m_sum + m_compensation;
+}
+
+template <typename Iterator>
+auto naiveSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type {
+  using T = typename std::decay<decltype(*first)>::type;
+  T sum{0};
+  for (; first != last; ++first) {
+    sum += *first;
+  }
+  return sum;
+}
+
+template <typename Iterator>
+auto kahanSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type {
+  using T = typename std::decay<decltype(*first)>::type;
+  CompensatedSum<T> sum;
+  for (; first != last; ++first) {
+    sum.add(*first);
+  }
+  return sum.value();
+}
+
+template <typename Iterator>
+auto pairwiseSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type {
+  const auto size = static_cast<std::size_t>(std::distance(first, last));
+  if (size <= PAIRWISE_BLOCK_SIZE) {
+    return naiveSum(first, last);
+  }
+  // split on a block boundary to keep the blocks full
+  using Difference = typename std::iterator_traits<Iterator>::difference_type;
+  const std::size_t half   = (size / 2 + PAIRWISE_BLOCK_SIZE - 1) / PAIRWISE_BLOCK_SIZE * PAIRWISE_BLOCK_SIZE;
+  const Iterator    middle = std::next(first, static_cast<Difference>(half));
+  return pairwiseSum(first, middle) + pairwiseSum(middle, last);
+}
+
+template <typename Iterator>
+auto blockedKahanSum(Iterator first, Iterator last) -> typename std::decay<decltype(*first)>::type {
+
+  using T = typename std::decay<decltype(*first)>::type;
+
+  std::array<T, SUMMATION_LANE_NUMBER> sums{};
+  std::array<T, SUMMATION_LANE_NUMBER> compensations{};
+  std::array<T, SUMMATION_LANE_NUMBER> values{};
+
+  std::size_t remaining = static_cast<std::size_t>(std::distance(first, last));
+
+  while (remaining >= SUMMATION_LANE_NUMBER) {
+    for (std::size_t lane = 0; lane < SUMMATION_LANE_NUMBER; ++lane, ++first) {
+      values[lane] = *first;
+    }
+    // branch free Neumaier step: the selects are turned into blends by the vectorizer
+    for (std::size_t lane = 0; lane < SUMMATION_LANE_NUMBER; ++lane) {
+      const T sum    = sums[lane] + values[lane];
+      const T larger = std::abs(sums[lane]) >= std::abs(values[lane]) ? sums[lane] : values[lane];
+      const T other  = std::abs(sums[lane]) >= std::abs(values[lane]) ? values[lane] : sums[lane];
+      compensations[lane] += (larger - sum) + other;
+      sums[lane] = sum;
+    }
+    remaining -= SUMMATION_LANE_NUMBER;
+  }
+
+  CompensatedSum<T> total;
+  for (std::size_t lane = 0; lane < SUMMATION_LANE_NUMBER; ++lane) {
+    total.add(sums[lane]);
+    total.add(compensations[lane]);
+  }
+  for (; first != last; ++first) {
+    total.add(*first);
+  }
+
+  return total.value();
+}
+
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_SUMMATION_IMPL_
@@ -0,0 +1,74 @@
+/**
+ * @file ElementsKernel/_impl/System.tpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *
+ */
+
+#ifndef ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEM_IMPL_
+#error "This file should not be included directly! Use ElementsKernel/System.h instead"
+#else
+
+#include <cstddef>  // for size_t
+
+#include <boost/utility/string_view.hpp>  // for string_view
+
+namespace Elements {
+namespace System {
+
+namespace TypeNameDetail {
+
+/// C++11 constexpr helpers: only single return statements
+
+constexpr bool startsWith(const char* text, const char* prefix) {
+  return *prefix == '\0' or (*text == *prefix and startsWith(text + 1, prefix + 1));
+}
+
+/// position of the type in the function signature ("... [with T = int]" or "... [T = int]")
+constexpr std::size_t typeStart(const char* signature, std::size_t pos = 0) {
+  return signature[pos] == '\0' ? 0 : (startsWith(signature + pos, "T = ") ? pos + 4 : typeStart(signature, pos + 1));
+}
+
+/// plain type: the compilers would append the expansion of an alias, like boost::string_view, to the signature
+struct Signature {
+  const char* data;
+  std::size_t size;
+};
+
+template <typename T>
+constexpr Signature signature() {
+  return Signature{__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1};
+}
+
+/// the signature ends with the type and a closing bracket
+constexpr boost::string_view typeOf(Signature signature, std::size_t start) {
+  return boost::string_view(signature.data + start, signature.size - start - 1);
+}
+
+}  // namespace TypeNameDetail
+
+template <typename T>
+constexpr boost::string_view typeName() {
+  return TypeNameDetail::typeOf(TypeNameDetail::signature<T>(),
+                                TypeNameDetail::typeStart(TypeNameDetail::signature<T>().data));
+}
+
+}  // namespace System
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_ELEMENTSKERNEL_SYSTEM_IMPL_
@@ -25,13 +25,19 @@
 #include <algorithm>  // for remove_if
 #include <iterator>
 #include <map>
+#include <memory>  // for shared_ptr
 #include <string>  // for string
 #include <vector>  // for vector
 
 #include <boost/filesystem/operations.hpp>  // for exists
 
-#include "ElementsKernel/Path.h"    // for Type, Item, VARIABLE
-#include "ElementsKernel/System.h"  // for DEFAULT_INSTALL_PREFIX
+#include "ElementsKernel/AuxiliaryCache.h"   // for AuxiliaryCache
+#include "ElementsKernel/Exception.h"        // for Exception
+#include "ElementsKernel/MappedFile.h"       // for MappedFile
+#include "ElementsKernel/Path.h"             // for Type, Item, VARIABLE
+#include "ElementsKernel/PathLookupCache.h"  // for Path::LookupCache
+#include "ElementsKernel/PathPrefetch.h"     // for Path::Prefetch
+#include "ElementsKernel/System.h"           // for DEFAULT_INSTALL_PREFIX
 
 using std::string;
 
@@ -46,6 +52,52 @@ string getAuxiliaryVariableName() {
 template Path::Item getAuxiliaryPath(const Path::Item& file_name, bool raise_exception);
 template Path::Item getAuxiliaryPath(const string& file_name, bool raise_exception);
 
+std::map<string, Path::Item> getAuxiliaryPaths(const std::vector<string>& file_names, bool raise_exception,
+                                               bool parallel) {
+
+  auto location_list = Path::LookupCache::instance().getLocations(getAuxiliaryVariableName(), []() {
+    return getAuxiliaryLocations();
+  });
+
+  auto result = Path::getPathsFromLocations(file_names, *location_list, parallel);
+
+  if (raise_exception) {
+    for (const auto& found : result) {
+      if (found.second.empty()) {
+        throw Exception() << "The auxiliary path \"" << found.first << "\" cannot be found!";
+      }
+    }
+  }
+
+  auto local_cache = AuxiliaryCache::fromEnvironment();
+  if (local_cache != nullptr) {
+    for (auto& found : result) {
+      if (not found.second.empty()) {
+        found.second = local_cache->get(found.second);
+      }
+    }
+  }
+
+  return result;
+}
+
+Path::Prefetch prefetchAuxiliaryFiles(const std::vector<string>& file_names, bool raise_exception) {
+
+  const auto found_paths = getAuxiliaryPaths(file_names, raise_exception);
+
+  std::vector<Path::Item> files;
+  files.reserve(found_paths.size());
+  for (const auto& found : found_paths) {
+    files.emplace_back(found.second);
+  }
+
+  return Path::Prefetch(files);
+}
+
+std::shared_ptr<const MappedFile> mapAuxiliaryFile(const Path::Item& file_name) {
+  return MappedFile::get(getAuxiliaryPath(file_name));
+}
+
 std::vector<Path::Item> getAuxiliaryLocations(bool exist_only) {
 
   using System::DEFAULT_INSTALL_PREFIX;
@@ -77,6 +129,18 @@ string getVariableName() {
 template Path::Item getPath(const Path::Item& file_name, bool raise_exception);
 template Path::Item getPath(const std::string& file_name, bool raise_exception);
 
+std::map<string, Path::Item> getPaths(const std::vector<string>& file_names, bool raise_exception, bool parallel) {
+  return getAuxiliaryPaths(file_names, raise_exception, parallel);
+}
+
+Path::Prefetch prefetch(const std::vector<string>& file_names, bool raise_exception) {
+  return prefetchAuxiliaryFiles(file_names, raise_exception);
+}
+
+std::shared_ptr<const MappedFile> map(const Path::Item& file_name) {
+  return mapAuxiliaryFile(file_name);
+}
+
 std::vector<Path::Item> getLocations(bool exist_only) {
   return getAuxiliaryLocations(exist_only);
 }
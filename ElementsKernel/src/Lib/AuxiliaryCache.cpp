@@ -0,0 +1,546 @@
+/**
+ * @file AuxiliaryCache.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/AuxiliaryCache.h"
+
+#include <fcntl.h>     // for open, AT_FDCWD
+#include <sys/file.h>  // for flock
+#include <sys/stat.h>  // for stat, utimensat
+#include <unistd.h>    // for close
+
+#include <algorithm>  // for sort
+#include <chrono>     // for system_clock, steady_clock, nanoseconds, duration_cast
+#include <cstdint>    // for uint64_t, int64_t, uint32_t
+#include <exception>  // for exception
+#include <fstream>    // for ifstream, ofstream
+#include <iomanip>    // for setw, setfill
+#include <memory>     // for make_shared
+#include <mutex>      // for lock_guard
+#include <sstream>    // for ostringstream
+#include <string>     // for string, getline
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+#include <boost/crc.hpp>                    // for crc_32_type
+#include <boost/filesystem/operations.hpp>  // for create_directories, rename, remove, remove_all
+#include <boost/system/error_code.hpp>      // for error_code
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Logging.h"    // for Logging
+#include "ElementsKernel/Path.h"       // for Path::Item
+#include "ElementsKernel/Storage.h"    // for Units::parseStorage
+#include "ElementsKernel/System.h"     // for getEnv
+
+#include "ModificationTime.h"  // for modificationTime
+
+using std::string;
+using std::vector;
+
+namespace Elements {
+inline namespace Kernel {
+
+const string AUX_CACHE_DIR_VARIABLE{"ELEMENTS_AUX_CACHE_DIR"};
+const string AUX_CACHE_SIZE_VARIABLE{"ELEMENTS_AUX_CACHE_SIZE"};
+
+namespace {
+
+auto log = Logging::getLogger("AuxiliaryCache");
+
+const string METADATA_FILE_NAME{".source"};
+const string GLOBAL_LOCK_FILE_NAME{".lock"};
+const string LOCK_FILE_EXTENSION{".lock"};
+const string EVICTED_ENTRY_PREFIX{".evicted-"};
+
+constexpr std::size_t COPY_BUFFER_SIZE{1024 * 1024};
+
+/// advisory lock on a file, shared between the processes
+class FileLock {
+
+public:
+  enum class Mode { shared = LOCK_SH, exclusive = LOCK_EX };
+
+  FileLock(const Path::Item& file_name, Mode mode, bool wait) : m_descriptor{-1}, m_locked{false} {
+    // the lock file can be removed by the eviction while waiting: the lock must be held on the current file
+    do {
+      if (m_descriptor >= 0) {
+        ::close(m_descriptor);
+      }
+      m_descriptor = ::open(file_name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+      if (m_descriptor < 0) {
+        throw Exception() << "Cannot open the lock file " << file_name;
+      }
+      const int operation = static_cast<int>(mode);
+      m_locked            = ::flock(m_descriptor, wait ? operation : operation | LOCK_NB) == 0;
+    } while (m_locked and not isCurrent(file_name));
+  }
+
+  ~FileLock() {
+    // closing the descriptor releases the lock
+    ::close(m_descriptor);
+  }
+
+  FileLock(const FileLock&) = delete;
+  FileLock& operator=(const FileLock&) = delete;
+
+  bool locked() const {
+    return m_locked;
+  }
+
+private:
+  bool isCurrent(const Path::Item& file_name) const {
+    struct stat opened_status;
+    struct stat current_status;
+    return ::fstat(m_descriptor, &opened_status) == 0 and ::stat(file_name.c_str(), &current_status) == 0 and
+           opened_status.st_dev == current_status.st_dev and opened_status.st_ino == current_status.st_ino;
+  }
+
+  int  m_descriptor;
+  bool m_locked;
+};
+
+struct Metadata {
+  string        source;
+  std::uint64_t size;
+  std::int64_t  modification_time;
+  std::uint32_t checksum;
+};
+
+/// @return a stable name for the entry of a source file (64 bits FNV-1a hash of its path)
+string entryKey(const string& source) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const char c : source) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  std::ostringstream key;
+  key << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return key.str();
+}
+
+bool hasPrefix(const string& name, const string& prefix) {
+  return name.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool hasSuffix(const string& name, const string& suffix) {
+  return name.size() >= suffix.size() and name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/// the same local file can be copied again with another content by another process
+string verifiedKey(const Path::Item& local_file, std::uint32_t checksum) {
+  return local_file.string() + '\n' + std::to_string(checksum);
+}
+
+/// @return the current time in the unit of the modification times
+std::int64_t currentTime() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+bool lastUse(const Path::Item& metadata_file, std::int64_t& last_use) {
+  struct stat status;
+  if (::stat(metadata_file.c_str(), &status) != 0) {
+    return false;
+  }
+  last_use = modificationTime(status);
+  return true;
+}
+
+bool readMetadata(const Path::Item& file_name, Metadata& metadata) {
+  std::ifstream input(file_name.string());
+  return static_cast<bool>(std::getline(input, metadata.source) >> metadata.size >> metadata.modification_time >>
+                           metadata.checksum);
+}
+
+void writeMetadata(const Path::Item& file_name, const Metadata& metadata) {
+  const Path::Item tmp_name{file_name.string() + ".tmp"};
+  {
+    std::ofstream output(tmp_name.string());
+    output << metadata.source << '\n'
+           << metadata.size << '\n'
+           << metadata.modification_time << '\n'
+           << metadata.checksum << '\n';
+    if (not output) {
+      throw Exception() << "Cannot write " << tmp_name;
+    }
+  }
+  boost::filesystem::rename(tmp_name, file_name);
+}
+
+/// update the modification time of the metadata: it is the last use of the entry
+void touch(const Path::Item& file_name) {
+  ::utimensat(AT_FDCWD, file_name.c_str(), nullptr, 0);
+}
+
+std::uint32_t fileChecksum(const Path::Item& file_name) {
+
+  std::ifstream input(file_name.string(), std::ios::binary);
+  if (not input) {
+    throw Exception() << "Cannot read " << file_name;
+  }
+
+  boost::crc_32_type crc;
+  vector<char>       buffer(COPY_BUFFER_SIZE);
+  while (input.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) or input.gcount() > 0) {
+    crc.process_bytes(buffer.data(), static_cast<std::size_t>(input.gcount()));
+  }
+
+  return crc.checksum();
+}
+
+/// @return the checksum of the copied content
+std::uint32_t copyFile(const Path::Item& source, const Path::Item& target) {
+
+  std::ifstream input(source.string(), std::ios::binary);
+  std::ofstream output(target.string(), std::ios::binary | std::ios::trunc);
+  if (not input or not output) {
+    throw Exception() << "Cannot copy " << source << " to " << target;
+  }
+
+  boost::crc_32_type crc;
+  vector<char>       buffer(COPY_BUFFER_SIZE);
+  while (input.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) or input.gcount() > 0) {
+    crc.process_bytes(buffer.data(), static_cast<std::size_t>(input.gcount()));
+    output.write(buffer.data(), input.gcount());
+  }
+
+  output.close();
+  if (input.bad() or not output) {
+    throw Exception() << "Cannot copy " << source << " to " << target;
+  }
+
+  return crc.checksum();
+}
+
+}  // namespace
+
+AuxiliaryCache::AuxiliaryCache(const Path::Item& directory, std::uint64_t max_size,
+                               const std::chrono::milliseconds& min_age)
+    : m_directory{directory}
+    , m_max_size{max_size}
+    , m_min_age{min_age}
+    , m_hits{0}
+    , m_copies{0}
+    , m_evictions{0}
+    , m_failures{0} {}
+
+std::shared_ptr<AuxiliaryCache> AuxiliaryCache::fromEnvironment() {
+
+  static std::mutex                      mutex;
+  static string                          configuration;
+  static std::shared_ptr<AuxiliaryCache> cache;
+
+  string directory;
+  if (not System::getEnv(AUX_CACHE_DIR_VARIABLE, directory) or directory.empty()) {
+    return nullptr;
+  }
+
+  string size_text;
+  System::getEnv(AUX_CACHE_SIZE_VARIABLE, size_text);
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (cache != nullptr and configuration == directory + '\n' + size_text) {
+    return cache;
+  }
+
+  std::uint64_t max_size = DEFAULT_AUX_CACHE_SIZE;
+  if (not size_text.empty()) {
+    std::int64_t parsed_size;
+    if (Units::parseStorage(size_text, parsed_size) and parsed_size > 0) {
+      max_size = static_cast<std::uint64_t>(parsed_size);
+    } else {
+      log.warn() << "Invalid " << AUX_CACHE_SIZE_VARIABLE << " value: \"" << size_text << "\"";
+    }
+  }
+
+  cache         = std::make_shared<AuxiliaryCache>(Path::Item{directory}, max_size);
+  configuration = directory + '\n' + size_text;
+
+  return cache;
+}
+
+Path::Item AuxiliaryCache::get(const Path::Item& source_file) {
+
+  struct stat source_status;
+  if (::stat(source_file.c_str(), &source_status) != 0 or not S_ISREG(source_status.st_mode) or
+      static_cast<std::uint64_t>(source_status.st_size) > m_max_size) {
+    return source_file;
+  }
+
+  Metadata source_metadata{source_file.string(), static_cast<std::uint64_t>(source_status.st_size),
+                           modificationTime(source_status), 0};
+
+  Path::Item local_file;
+  if (findLocalCopy(source_metadata.source, source_metadata.size, source_metadata.modification_time, local_file)) {
+    ++m_hits;
+    return local_file;
+  }
+
+  const string     key           = entryKey(source_metadata.source);
+  const Path::Item entry         = m_directory / key;
+  const Path::Item metadata_file = entry / METADATA_FILE_NAME;
+  const Path::Item lock_file     = m_directory / (key + LOCK_FILE_EXTENSION);
+  local_file                     = entry / source_file.filename();
+
+  auto isUpToDate = [this, &source_metadata, &local_file, &metadata_file]() {
+    Metadata metadata;
+    return readMetadata(metadata_file, metadata) and metadata.source == source_metadata.source and
+           metadata.size == source_metadata.size and metadata.modification_time == source_metadata.modification_time and
+           boost::filesystem::exists(local_file) and boost::filesystem::file_size(local_file) == metadata.size and
+           isVerified(local_file, metadata.checksum);
+  };
+
+  auto useEntry = [this, &source_metadata, &local_file, &metadata_file]() {
+    // the last use protects the entry from the eviction
+    touch(metadata_file);
+    keepLocalCopy(source_metadata.source, source_metadata.size, source_metadata.modification_time, local_file);
+    ++m_hits;
+  };
+
+  try {
+
+    boost::filesystem::create_directories(m_directory);
+
+    {
+      // an existing entry is checked and used by several processes at once
+      FileLock shared_lock(lock_file, FileLock::Mode::shared, true);
+      if (isUpToDate()) {
+        useEntry();
+        return local_file;
+      }
+    }
+
+    // the other processes wait here while the entry is copied
+    FileLock entry_lock(lock_file, FileLock::Mode::exclusive, true);
+
+    // another process may have copied the entry between both locks
+    if (isUpToDate()) {
+      useEntry();
+      return local_file;
+    }
+
+    // an outdated local file is replaced by the rename: it is never missing for the other processes
+    boost::filesystem::create_directories(entry);
+
+    const Path::Item tmp_file{local_file.string() + ".tmp"};
+    source_metadata.checksum = copyFile(source_file, tmp_file);
+    if (fileChecksum(tmp_file) != source_metadata.checksum) {
+      throw Exception() << "The checksum of the copy of " << source_file << " is wrong";
+    }
+    boost::filesystem::rename(tmp_file, local_file);
+    // the metadata is written last: it marks a complete entry
+    writeMetadata(metadata_file, source_metadata);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_verified.insert(verifiedKey(local_file, source_metadata.checksum));
+    }
+    keepLocalCopy(source_metadata.source, source_metadata.size, source_metadata.modification_time, local_file);
+    ++m_copies;
+
+  } catch (const std::exception& e) {
+    log.warn() << "The local cache cannot be used for " << source_file << ": " << e.what();
+    ++m_failures;
+    return source_file;
+  }
+
+  try {
+    evict(key);
+  } catch (const std::exception& e) {
+    log.warn() << "The local cache " << m_directory << " cannot be cleaned: " << e.what();
+  }
+
+  return local_file;
+}
+
+bool AuxiliaryCache::findLocalCopy(const string& source, std::uint64_t size, std::int64_t modification_time,
+                                   Path::Item& local_file) {
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // the entry can be evicted by another process once it has not been used during the minimum age
+  auto found = m_local_copies.find(source);
+  if (found == m_local_copies.end() or found->second.size != size or
+      found->second.modification_time != modification_time or
+      std::chrono::steady_clock::now() - found->second.use_time >= m_min_age / 2) {
+    return false;
+  }
+
+  local_file = found->second.local_file;
+
+  return true;
+}
+
+void AuxiliaryCache::keepLocalCopy(const string& source, std::uint64_t size, std::int64_t modification_time,
+                                   const Path::Item& local_file) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_local_copies[source] = LocalCopy{size, modification_time, local_file, std::chrono::steady_clock::now()};
+}
+
+bool AuxiliaryCache::isVerified(const Path::Item& local_file, std::uint32_t checksum) {
+
+  const string verified_key = verifiedKey(local_file, checksum);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_verified.count(verified_key) != 0) {
+      return true;
+    }
+  }
+
+  if (fileChecksum(local_file) != checksum) {
+    log.warn() << "The checksum of the cached file " << local_file << " is wrong";
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_verified.insert(verified_key);
+
+  return true;
+}
+
+void AuxiliaryCache::evict(const string& kept_key) {
+
+  // a single process cleans the cache at a time
+  FileLock global_lock(m_directory / GLOBAL_LOCK_FILE_NAME, FileLock::Mode::exclusive, true);
+
+  struct Entry {
+    string        key;
+    std::uint64_t size;
+    std::int64_t  last_use;
+  };
+
+  vector<Entry>      entries;
+  vector<string>     lock_keys;
+  vector<Path::Item> leftovers;
+  std::uint64_t      total_size = 0;
+
+  boost::system::error_code error;
+  for (boost::filesystem::directory_iterator it{m_directory, error}, end; not error and it != end;
+       it.increment(error)) {
+    const string name = it->path().filename().string();
+    if (name == GLOBAL_LOCK_FILE_NAME) {
+      continue;
+    }
+    if (hasPrefix(name, EVICTED_ENTRY_PREFIX)) {
+      // left by an interrupted eviction
+      leftovers.push_back(it->path());
+    } else if (hasSuffix(name, LOCK_FILE_EXTENSION)) {
+      lock_keys.push_back(name.substr(0, name.size() - LOCK_FILE_EXTENSION.size()));
+    } else {
+      Metadata     metadata;
+      std::int64_t last_use;
+      const auto   metadata_file = it->path() / METADATA_FILE_NAME;
+      // the incomplete entries are skipped
+      if (readMetadata(metadata_file, metadata) and lastUse(metadata_file, last_use)) {
+        entries.push_back(Entry{name, metadata.size, last_use});
+        total_size += metadata.size;
+      }
+    }
+  }
+
+  for (const auto& leftover : leftovers) {
+    boost::filesystem::remove_all(leftover, error);
+  }
+
+  // the lock files of the removed entries
+  for (const auto& key : lock_keys) {
+    const Path::Item lock_file = m_directory / (key + LOCK_FILE_EXTENSION);
+    if (not boost::filesystem::exists(m_directory / key)) {
+      FileLock entry_lock(lock_file, FileLock::Mode::exclusive, false);
+      if (entry_lock.locked()) {
+        boost::filesystem::remove(lock_file, error);
+      }
+    }
+  }
+
+  if (total_size <= m_max_size) {
+    return;
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& first, const Entry& second) {
+    return first.last_use < second.last_use;
+  });
+
+  const std::int64_t last_evictable_use =
+      currentTime() - std::chrono::duration_cast<std::chrono::nanoseconds>(m_min_age).count();
+
+  for (const auto& e : entries) {
+    if (total_size <= m_max_size or e.last_use > last_evictable_use) {
+      break;
+    }
+    if (e.key == kept_key) {
+      continue;
+    }
+    // an entry in use by another process is skipped
+    const Path::Item lock_file = m_directory / (e.key + LOCK_FILE_EXTENSION);
+    FileLock         entry_lock(lock_file, FileLock::Mode::exclusive, false);
+    std::int64_t     last_use;
+    // the entry may have been used since the listing
+    if (entry_lock.locked() and lastUse(m_directory / e.key / METADATA_FILE_NAME, last_use) and
+        last_use <= last_evictable_use) {
+      // the entry disappears at once: the other processes never see it partially removed
+      const Path::Item evicted_entry = m_directory / (EVICTED_ENTRY_PREFIX + e.key);
+      boost::filesystem::rename(m_directory / e.key, evicted_entry);
+      boost::filesystem::remove_all(evicted_entry);
+      boost::filesystem::remove(lock_file);
+      total_size -= e.size;
+      ++m_evictions;
+    }
+  }
+}
+
+const Path::Item& AuxiliaryCache::directory() const {
+  return m_directory;
+}
+
+std::uint64_t AuxiliaryCache::maxSize() const {
+  return m_max_size;
+}
+
+std::chrono::milliseconds AuxiliaryCache::minAge() const {
+  return m_min_age;
+}
+
+std::uint64_t AuxiliaryCache::size() const {
+
+  std::uint64_t total_size = 0;
+
+  boost::system::error_code error;
+  for (boost::filesystem::directory_iterator it{m_directory, error}, end; not error and it != end;
+       it.increment(error)) {
+    Metadata metadata;
+    if (not hasPrefix(it->path().filename().string(), EVICTED_ENTRY_PREFIX) and
+        readMetadata(it->path() / METADATA_FILE_NAME, metadata)) {
+      total_size += metadata.size;
+    }
+  }
+
+  return total_size;
+}
+
+AuxiliaryCache::Statistics AuxiliaryCache::statistics() const {
+  return Statistics{m_hits.load(), m_copies.load(), m_evictions.load(), m_failures.load()};
+}
+
+}  // namespace Kernel
+}  // namespace Elements
@@ -25,13 +25,17 @@
 #include <algorithm>  // for remove_if
 #include <iterator>
 #include <map>
+#include <memory>  // for shared_ptr
 #include <string>  // for string
 #include <vector>  // for vector
 
 #include <boost/filesystem/operations.hpp>  // for exists
 
-#include "ElementsKernel/Path.h"    // for Path::VARIABLE, Path::Type
-#include "ElementsKernel/System.h"  // for DEFAULT_INSTALL_PREFIX
+#include "ElementsKernel/Exception.h"        // for Exception
+#include "ElementsKernel/MappedFile.h"       // for MappedFile
+#include "ElementsKernel/Path.h"             // for Path::VARIABLE, Path::Type
+#include "ElementsKernel/PathLookupCache.h"  // for Path::LookupCache
+#include "ElementsKernel/System.h"           // for DEFAULT_INSTALL_PREFIX
 
 using std::string;
 
@@ -46,6 +50,30 @@ string getConfigurationVariableName() {
 template Path::Item getConfigurationPath(const Path::Item& file_name, bool raise_exception);
 template Path::Item getConfigurationPath(const string& file_name, bool raise_exception);
 
+std::map<string, Path::Item> getConfigurationPaths(const std::vector<string>& file_names, bool raise_exception,
+                                                   bool parallel) {
+
+  auto location_list = Path::LookupCache::instance().getLocations(getConfigurationVariableName(), []() {
+    return getConfigurationLocations();
+  });
+
+  auto result = Path::getPathsFromLocations(file_names, *location_list, parallel);
+
+  if (raise_exception) {
+    for (const auto& found : result) {
+      if (found.second.empty()) {
+        throw Exception() << "The configuration path \"" << found.first << "\" cannot be found!";
+      }
+    }
+  }
+
+  return result;
+}
+
+std::shared_ptr<const MappedFile> mapConfigurationFile(const Path::Item& file_name) {
+  return MappedFile::get(getConfigurationPath(file_name));
+}
+
 std::vector<Path::Item> getConfigurationLocations(bool exist_only) {
 
   auto location_list = Path::getLocations(Path::Type::configuration, exist_only);
@@ -73,6 +101,14 @@ string getVariableName() {
 template Path::Item getPath(const Path::Item& file_name, bool raise_exception);
 template Path::Item getPath(const std::string& file_name, bool raise_exception);
 
+std::map<string, Path::Item> getPaths(const std::vector<string>& file_names, bool raise_exception, bool parallel) {
+  return getConfigurationPaths(file_names, raise_exception, parallel);
+}
+
+std::shared_ptr<const MappedFile> map(const Path::Item& file_name) {
+  return mapConfigurationFile(file_name);
+}
+
 std::vector<Path::Item> getLocations(bool exist_only) {
   return getConfigurationLocations(exist_only);
 }
@@ -22,25 +22,27 @@
 #include "ElementsKernel/Environment.h"
 
 #include <algorithm>  // for find
+#include <cstdlib>    // for getenv, setenv, unsetenv
 #include <map>        // for map
 #include <sstream>    // for stringstream
 #include <stdexcept>  // for out_of_range
 #include <string>     // for string
 #include <utility>    // for move
+#include <vector>     // for vector
 
 #include <boost/format.hpp>  // for format
 
-#include "ElementsKernel/System.h"  // for getEnv, setEnv, isEnvSet
+#include "ElementsKernel/EnvironmentSnapshot.h"  // for EnvironmentSnapshot
+#include "ElementsKernel/System.h"               // for setEnv, unSetEnv
 
 using std::endl;
 using std::ostream;
 using std::string;
 using std::stringstream;
+using std::vector;
 
 namespace Elements {
 
-using System::getEnv;
-using System::isEnvSet;
 using System::setEnv;
 using System::unSetEnv;
 
@@ -141,7 +143,7 @@ bool Environment::Variable::empty() const {
 }
 
 bool Environment::Variable::exists() const {
-  return m_env.get().hasKey(m_index);
+  return m_env.get().contains(m_index);
 }
 
 void Environment::Variable::checkCompatibility(const Environment::Variable& other) {
@@ -156,9 +158,16 @@ void Environment::Variable::checkCompatibility(const Environment::Variable& othe
 
 //----------------------------------------------------------------------------
 
-Environment::Environment(bool keep_same) : m_old_values{}, m_keep_same{keep_same}, m_added_variables{} {}
+Environment::Environment(bool keep_same) : Environment(Mode::process, keep_same) {}
+
+Environment::Environment(Mode mode, bool keep_same)
+    : m_old_values{}, m_keep_same{keep_same}, m_added_variables{}, m_mode{mode}, m_overlay{} {}
 
 Environment& Environment::restore() {
+
+  // the process environment has not been touched
+  m_overlay = {};
+
   for (const auto& v : m_added_variables) {
     unSetEnv(v);
   }
@@ -186,17 +195,25 @@ const Environment::Variable Environment::operator[](const string& index) const {
 
 Environment& Environment::set(const string& index, const string& value) {
 
-  if (m_old_values.find(index) == m_old_values.end()) {
-    if (hasKey(index)) {
-      if ((not m_keep_same) || (getEnv(index) != value)) {
-        m_old_values[index] = getEnv(index);
-      }
-    } else {
-      m_added_variables.emplace_back(index);
-    }
+  if (m_mode == Mode::overlay) {
+    m_overlay[index] = Override{true, value};
+    return *this;
   }
 
-  setEnv(index, value);
+  // the previous value is read from the process environment together with the change
+  EnvironmentSnapshot::update(index, [this, &index, &value]() {
+    if (m_old_values.find(index) == m_old_values.end()) {
+      const char* old_value = ::getenv(index.c_str());
+      if (old_value != nullptr) {
+        if ((not m_keep_same) || (old_value != value)) {
+          m_old_values[index] = old_value;
+        }
+      } else {
+        m_added_variables.emplace_back(index);
+      }
+    }
+    return ::setenv(index.c_str(), value.c_str(), 1);
+  });
 
   return *this;
 }
@@ -205,16 +222,23 @@ Environment& Environment::unSet(const string& index) {
 
   checkOutOfRange(index);
 
-  if (m_old_values.find(index) == m_old_values.end()) {
-    auto found_index = std::find(m_added_variables.begin(), m_added_variables.end(), index);
-    if (found_index != m_added_variables.end()) {
-      m_added_variables.erase(found_index);
-    } else {
-      m_old_values[index] = getEnv(index);
-    }
+  if (m_mode == Mode::overlay) {
+    m_overlay[index] = Override{false, ""};
+    return *this;
   }
 
-  unSetEnv(index);
+  EnvironmentSnapshot::update(index, [this, &index]() {
+    if (m_old_values.find(index) == m_old_values.end()) {
+      auto found_index = std::find(m_added_variables.begin(), m_added_variables.end(), index);
+      if (found_index != m_added_variables.end()) {
+        m_added_variables.erase(found_index);
+      } else {
+        const char* old_value = ::getenv(index.c_str());
+        m_old_values[index]   = (old_value != nullptr) ? old_value : "";
+      }
+    }
+    return ::unsetenv(index.c_str());
+  });
 
   return *this;
 }
@@ -238,26 +262,70 @@ Environment& Environment::prepend(const string& index, const string& value) {
 }
 
 string Environment::get(const string& index, const string& default_value) const {
-  string value{default_value};
 
-  if (hasKey(index)) {
-    value = getEnv(index);
+  const auto found = m_overlay.find(index);
+  if (found != m_overlay.end()) {
+    return found->second.is_set ? found->second.value : default_value;
   }
 
-  return value;
+  return EnvironmentSnapshot::get(index, default_value);
 }
 
 bool Environment::hasKey(const string& index) {
 
-  return isEnvSet(index);
+  return EnvironmentSnapshot::hasKey(index);
+}
+
+bool Environment::contains(const string& index) const {
+
+  const auto found = m_overlay.find(index);
+  if (found != m_overlay.end()) {
+    return found->second.is_set;
+  }
+
+  return hasKey(index);
 }
 
 void Environment::commit() {
 
+  for (const auto& o : m_overlay) {
+    if (o.second.is_set) {
+      setEnv(o.first, o.second.value);
+    } else {
+      unSetEnv(o.first);
+    }
+  }
+
+  m_overlay         = {};
   m_old_values      = {};
   m_added_variables = {};
 }
 
+Environment::Mode Environment::mode() const {
+  return m_mode;
+}
+
+Environment::Block Environment::block() const {
+
+  auto variables = EnvironmentSnapshot::variables();
+
+  for (const auto& o : m_overlay) {
+    if (o.second.is_set) {
+      variables[o.first] = o.second.value;
+    } else {
+      variables.erase(o.first);
+    }
+  }
+
+  vector<string> entries;
+  entries.reserve(variables.size());
+  for (const auto& v : variables) {
+    entries.emplace_back(v.first + "=" + v.second);
+  }
+
+  return Block(std::move(entries));
+}
+
 string Environment::generateScript(Environment::ShellType type) const {
 
   using boost::format;
@@ -268,6 +336,14 @@ string Environment::generateScript(Environment::ShellType type) const {
   map<ShellType, string> set_cmd{{ShellType::sh, "export %s=%s"}, {ShellType::csh, "setenv %s %s"}};
   map<ShellType, string> unset_cmd{{ShellType::sh, "unset %s"}, {ShellType::csh, "unsetenv %s"}};
 
+  for (const auto& o : m_overlay) {
+    if (o.second.is_set) {
+      script_text << format(set_cmd[type]) % o.first % o.second.value << endl;
+    } else {
+      script_text << format(unset_cmd[type]) % o.first << endl;
+    }
+  }
+
   for (const auto& v : m_old_values) {
     if (hasKey(v.first)) {
       script_text << format(set_cmd[type]) % v.first % get(v.first) << endl;
@@ -283,9 +359,26 @@ string Environment::generateScript(Environment::ShellType type) const {
   return script_text.str();
 }
 
-void Environment::checkOutOfRange(const string& index) {
+Environment::Block::Block(vector<string> entries) : m_entries{std::move(entries)}, m_pointers{} {
+
+  m_pointers.reserve(m_entries.size() + 1);
+  for (auto& e : m_entries) {
+    m_pointers.emplace_back(&e[0]);
+  }
+  m_pointers.emplace_back(nullptr);
+}
+
+char* const* Environment::Block::envp() const {
+  return m_pointers.data();
+}
+
+const vector<string>& Environment::Block::entries() const {
+  return m_entries;
+}
+
+void Environment::checkOutOfRange(const string& index) const {
 
-  if (not hasKey(index)) {
+  if (not contains(index)) {
     stringstream error_buffer;
     error_buffer << "The environment doesn't contain the " << index << " variable." << endl;
     throw std::out_of_range(error_buffer.str());
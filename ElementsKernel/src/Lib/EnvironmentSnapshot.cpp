@@ -0,0 +1,244 @@
+/**
+ * @file EnvironmentSnapshot.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/EnvironmentSnapshot.h"
+
+#include <atomic>         // for atomic
+#include <cstddef>        // for size_t
+#include <cstdlib>        // for getenv
+#include <functional>     // for function
+#include <map>            // for map
+#include <memory>         // for unique_ptr
+#include <mutex>          // for mutex, lock_guard
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#if defined(__APPLE__)
+// Needed for _NSGetEnviron(void)
+#include "crt_externs.h"
+#else
+#include <unistd.h>  // for environ
+#endif
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+namespace {
+
+struct Snapshot {
+  std::unordered_map<string, string> variables;
+  size_t                             generation;
+};
+
+/// the published snapshot. It is only read through a Reader
+std::atomic<const Snapshot*> current_snapshot{nullptr};
+
+constexpr size_t READER_SLOT_NUMBER{16};
+
+/// number of threads reading the published snapshot. The counters are spread
+/// over several cache lines so that the readers don't contend on a single one
+struct alignas(64) ReaderSlot {
+  std::atomic<size_t> reader_number{0};
+};
+
+ReaderSlot reader_slots[READER_SLOT_NUMBER];
+
+ReaderSlot& readerSlot() {
+  static std::atomic<size_t> thread_number{0};
+  thread_local size_t        slot = thread_number++ % READER_SLOT_NUMBER;
+  return reader_slots[slot];
+}
+
+bool hasReader() {
+  for (const auto& s : reader_slots) {
+    if (s.reader_number.load() != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+struct Registry {
+  std::mutex                                   mutex;
+  std::unique_ptr<const Snapshot>              current;
+  std::vector<std::unique_ptr<const Snapshot>> retired;
+  size_t                                       generation{0};
+};
+
+/// never destroyed: the snapshot can still be read during the static destruction
+Registry& registry() {
+  static Registry* instance = new Registry;
+  return *instance;
+}
+
+/// read the whole process environment. The registry lock must be held
+void readEnvironment(Snapshot& snapshot) {
+#if defined(__APPLE__)
+  char** environ = *_NSGetEnviron();
+#endif
+  for (char** entry = environ; *entry != nullptr; ++entry) {
+    const string e{*entry};
+    const auto   separator = e.find('=');
+    if (separator != string::npos) {
+      snapshot.variables.emplace(e.substr(0, separator), e.substr(separator + 1));
+    }
+  }
+}
+
+/// read a single variable on top of the current snapshot. The registry lock must be held
+void readVariable(const Registry& reg, const string& name, Snapshot& snapshot) {
+  if (reg.current) {
+    snapshot.variables = reg.current->variables;
+  }
+  const char* value = ::getenv(name.c_str());
+  if (value != nullptr) {
+    snapshot.variables[name] = value;
+  } else {
+    snapshot.variables.erase(name);
+  }
+}
+
+/// publish a new snapshot. The registry lock must be held
+void publish(Registry& reg, std::unique_ptr<Snapshot> snapshot) {
+
+  snapshot->generation = ++reg.generation;
+
+  current_snapshot.store(snapshot.get());
+  if (reg.current) {
+    reg.retired.emplace_back(std::move(reg.current));
+  }
+  reg.current = std::move(snapshot);
+
+  // a reader which is not counted yet will load the new snapshot
+  if (not hasReader()) {
+    reg.retired.clear();
+  }
+}
+
+/// lock-free access to the published snapshot, which stays valid during the lifetime of the reader
+class Reader {
+
+public:
+  Reader() : m_slot(readerSlot()) {
+    ++m_slot.reader_number;
+    m_snapshot = current_snapshot.load();
+    if (m_snapshot == nullptr) {
+      EnvironmentSnapshot::refresh();
+      m_snapshot = current_snapshot.load();
+    }
+  }
+
+  ~Reader() {
+    --m_slot.reader_number;
+  }
+
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+
+  const Snapshot& snapshot() const {
+    return *m_snapshot;
+  }
+
+private:
+  ReaderSlot&     m_slot;
+  const Snapshot* m_snapshot;
+};
+
+/// the snapshot is taken at load time
+const bool snapshot_taken = (EnvironmentSnapshot::refresh(), true);
+
+}  // namespace
+
+bool EnvironmentSnapshot::lookup(const string& name, string& value) {
+
+  const Reader reader;
+  const auto&  variables = reader.snapshot().variables;
+
+  const auto found = variables.find(name);
+  if (found == variables.end()) {
+    return false;
+  }
+
+  value = found->second;
+  return true;
+}
+
+string EnvironmentSnapshot::get(const string& name, const string& default_value) {
+  string value{default_value};
+  lookup(name, value);
+  return value;
+}
+
+bool EnvironmentSnapshot::hasKey(const string& name) {
+  const Reader reader;
+  return reader.snapshot().variables.count(name) != 0;
+}
+
+size_t EnvironmentSnapshot::size() {
+  const Reader reader;
+  return reader.snapshot().variables.size();
+}
+
+std::map<string, string> EnvironmentSnapshot::variables() {
+  const Reader reader;
+  const auto&  variables = reader.snapshot().variables;
+  return std::map<string, string>(variables.cbegin(), variables.cend());
+}
+
+size_t EnvironmentSnapshot::generation() {
+  const Reader reader;
+  return reader.snapshot().generation;
+}
+
+void EnvironmentSnapshot::refresh() {
+  std::unique_ptr<Snapshot>   snapshot{new Snapshot{{}, 0}};
+  auto&                       reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  readEnvironment(*snapshot);
+  publish(reg, std::move(snapshot));
+}
+
+int EnvironmentSnapshot::update(const std::function<int()>& modification) {
+  std::unique_ptr<Snapshot>   snapshot{new Snapshot{{}, 0}};
+  auto&                       reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  const int                   result = modification();
+  readEnvironment(*snapshot);
+  publish(reg, std::move(snapshot));
+  return result;
+}
+
+int EnvironmentSnapshot::update(const string& name, const std::function<int()>& modification) {
+  std::unique_ptr<Snapshot>   snapshot{new Snapshot{{}, 0}};
+  auto&                       reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  const int                   result = modification();
+  readVariable(reg, name, *snapshot);
+  publish(reg, std::move(snapshot));
+  return result;
+}
+
+}  // namespace Elements
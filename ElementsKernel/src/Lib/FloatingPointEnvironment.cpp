@@ -0,0 +1,277 @@
+/**
+ * @file FloatingPointEnvironment.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/FloatingPointEnvironment.h"
+
+#include <array>    // for array
+#include <cfenv>    // for fegetenv, fesetenv, feenableexcept, fedisableexcept, fegetexcept
+#include <cstdint>  // for uint64_t
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+#include <boost/algorithm/string.hpp>  // for split, trim, is_any_of
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Exit.h"       // for ExitCode
+
+#if defined(__SSE__) || defined(__x86_64__)
+#include <xmmintrin.h>  // for _mm_getcsr, _mm_setcsr
+#define ELEMENTS_HAS_MXCSR
+#endif
+
+using std::string;
+
+namespace Elements {
+
+namespace {
+
+#if defined(ELEMENTS_HAS_MXCSR)
+
+constexpr unsigned int FTZ_BIT{0x8000};
+constexpr unsigned int DAZ_BIT{0x0040};
+
+bool getControlBit(unsigned int bit) {
+  return (_mm_getcsr() & bit) != 0;
+}
+
+bool setControlBit(unsigned int bit, bool enable) {
+  const unsigned int csr = _mm_getcsr();
+  _mm_setcsr(enable ? (csr | bit) : (csr & ~bit));
+  return (csr & bit) != 0;
+}
+
+#elif defined(__aarch64__)
+
+// there is a single flush-to-zero bit for the operands and the results
+constexpr std::uint64_t FZ_BIT{std::uint64_t{1} << 24};
+
+bool getControlBit(std::uint64_t bit) {
+  std::uint64_t fpcr;
+  __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+  return (fpcr & bit) != 0;
+}
+
+bool setControlBit(std::uint64_t bit, bool enable) {
+  std::uint64_t fpcr;
+  __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+  const std::uint64_t new_fpcr = enable ? (fpcr | bit) : (fpcr & ~bit);
+  __asm__ __volatile__("msr fpcr, %0" : : "r"(new_fpcr));
+  return (fpcr & bit) != 0;
+}
+
+#endif
+
+constexpr int DEFAULT_TRAPS{FE_INVALID | FE_DIVBYZERO | FE_OVERFLOW};
+
+const std::array<std::pair<const char*, int>, 5> TRAP_NAMES{{{"invalid", FE_INVALID},
+                                                             {"divbyzero", FE_DIVBYZERO},
+                                                             {"overflow", FE_OVERFLOW},
+                                                             {"underflow", FE_UNDERFLOW},
+                                                             {"inexact", FE_INEXACT}}};
+
+}  // namespace
+
+bool hasDenormalControl() noexcept {
+#if defined(ELEMENTS_HAS_MXCSR) || defined(__aarch64__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool setFlushToZero(bool enable) noexcept {
+#if defined(ELEMENTS_HAS_MXCSR)
+  return setControlBit(FTZ_BIT, enable);
+#elif defined(__aarch64__)
+  return setControlBit(FZ_BIT, enable);
+#else
+  static_cast<void>(enable);
+  return false;
+#endif
+}
+
+bool isFlushToZero() noexcept {
+#if defined(ELEMENTS_HAS_MXCSR)
+  return getControlBit(FTZ_BIT);
+#elif defined(__aarch64__)
+  return getControlBit(FZ_BIT);
+#else
+  return false;
+#endif
+}
+
+bool setDenormalsAreZero(bool enable) noexcept {
+#if defined(ELEMENTS_HAS_MXCSR)
+  return setControlBit(DAZ_BIT, enable);
+#elif defined(__aarch64__)
+  return setControlBit(FZ_BIT, enable);
+#else
+  static_cast<void>(enable);
+  return false;
+#endif
+}
+
+bool isDenormalsAreZero() noexcept {
+#if defined(ELEMENTS_HAS_MXCSR)
+  return getControlBit(DAZ_BIT);
+#elif defined(__aarch64__)
+  return getControlBit(FZ_BIT);
+#else
+  return false;
+#endif
+}
+
+int enableFloatingPointTraps(int excepts) noexcept {
+#if defined(__GLIBC__)
+  // a pending flag would otherwise trap at the next operation
+  std::feclearexcept(excepts);
+  return feenableexcept(excepts);
+#else
+  static_cast<void>(excepts);
+  return -1;
+#endif
+}
+
+int disableFloatingPointTraps(int excepts) noexcept {
+#if defined(__GLIBC__)
+  return fedisableexcept(excepts);
+#else
+  static_cast<void>(excepts);
+  return -1;
+#endif
+}
+
+int floatingPointTraps() noexcept {
+#if defined(__GLIBC__)
+  return fegetexcept();
+#else
+  return -1;
+#endif
+}
+
+FloatingPointEnvironment::FloatingPointEnvironment(bool flush_to_zero, bool denormals_are_zero, int traps)
+    : m_flush_to_zero{flush_to_zero}, m_denormals_are_zero{denormals_are_zero}, m_traps{traps} {}
+
+FloatingPointEnvironment FloatingPointEnvironment::current() {
+  const int traps = floatingPointTraps();
+  return FloatingPointEnvironment{isFlushToZero(), isDenormalsAreZero(), traps < 0 ? 0 : traps};
+}
+
+FloatingPointEnvironment FloatingPointEnvironment::fromString(const string& modes) {
+
+  bool flush_to_zero      = false;
+  bool denormals_are_zero = false;
+  int  traps              = 0;
+
+  std::vector<string> tokens;
+  boost::split(tokens, modes, boost::is_any_of(","));
+
+  for (auto& token : tokens) {
+    boost::trim(token);
+    if (token.empty() or token == "default") {
+      continue;
+    }
+    if (token == "ftz") {
+      flush_to_zero = true;
+    } else if (token == "daz") {
+      denormals_are_zero = true;
+    } else if (token == "denormals") {
+      flush_to_zero      = true;
+      denormals_are_zero = true;
+    } else if (token == "traps") {
+      traps |= DEFAULT_TRAPS;
+    } else {
+      bool found = false;
+      for (const auto& trap : TRAP_NAMES) {
+        if (token == trap.first) {
+          traps |= trap.second;
+          found = true;
+        }
+      }
+      if (not found) {
+        throw Exception(ExitCode::CONFIG) << "Unknown floating point mode: \"" << token << "\"";
+      }
+    }
+  }
+
+  return FloatingPointEnvironment{flush_to_zero, denormals_are_zero, traps};
+}
+
+void FloatingPointEnvironment::apply() const {
+  setFlushToZero(m_flush_to_zero);
+  setDenormalsAreZero(m_denormals_are_zero);
+  disableFloatingPointTraps(FE_ALL_EXCEPT & ~m_traps);
+  if (m_traps != 0) {
+    enableFloatingPointTraps(m_traps);
+  }
+}
+
+bool FloatingPointEnvironment::flushToZero() const {
+  return m_flush_to_zero;
+}
+
+bool FloatingPointEnvironment::denormalsAreZero() const {
+  return m_denormals_are_zero;
+}
+
+int FloatingPointEnvironment::traps() const {
+  return m_traps;
+}
+
+string FloatingPointEnvironment::toString() const {
+
+  std::vector<string> modes;
+
+  if (m_flush_to_zero) {
+    modes.emplace_back("ftz");
+  }
+  if (m_denormals_are_zero) {
+    modes.emplace_back("daz");
+  }
+  for (const auto& trap : TRAP_NAMES) {
+    if ((m_traps & trap.second) != 0) {
+      modes.emplace_back(trap.first);
+    }
+  }
+  if (modes.empty()) {
+    modes.emplace_back("default");
+  }
+
+  return boost::algorithm::join(modes, ",");
+}
+
+FloatingPointEnvironmentGuard::FloatingPointEnvironmentGuard(const FloatingPointEnvironment& environment)
+    : m_saved_fenv{}, m_saved_environment{FloatingPointEnvironment::current()} {
+  std::fegetenv(&m_saved_fenv);
+  environment.apply();
+}
+
+FloatingPointEnvironmentGuard::~FloatingPointEnvironmentGuard() {
+  // the raised flags and the rounding mode are restored with the fenv_t. The
+  // denormal bits are not part of it on every platform.
+  std::fesetenv(&m_saved_fenv);
+  m_saved_environment.apply();
+}
+
+}  // namespace Elements
+
+#undef ELEMENTS_HAS_MXCSR
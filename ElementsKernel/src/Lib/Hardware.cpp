@@ -0,0 +1,400 @@
+/**
+ * @file Hardware.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/Hardware.h"
+
+#include <sched.h>   // for sched_getaffinity, CPU_ISSET
+#include <unistd.h>  // for sysconf
+
+#if (defined(__x86_64__) or defined(__i386__)) and (defined(__GNUC__) or defined(__clang__))
+#include <cpuid.h>  // for __get_cpuid, __cpuid_count
+#define ELEMENTS_HAS_CPUID
+#endif
+
+#include <algorithm>  // for sort, unique, find_if
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t, uint64_t
+#include <cstdlib>    // for strtoul
+#include <cstring>    // for memcpy
+#include <fstream>    // for ifstream
+#include <set>        // for set
+#include <string>     // for string, getline
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+using std::size_t;
+using std::string;
+using std::uint32_t;
+using std::uint64_t;
+using std::vector;
+
+namespace Elements {
+namespace System {
+
+namespace {
+
+// constant initialized: the topology can be read during the static initialization
+constexpr const char* cpu_directory  = "/sys/devices/system/cpu/";
+constexpr const char* node_directory = "/sys/devices/system/node/";
+
+/// first line of a small file of /sys, empty if it cannot be read
+string readLine(const string& file_name) {
+  std::ifstream input(file_name);
+  string        line;
+  std::getline(input, line);
+  return line;
+}
+
+/// value of a file of /sys, or the default if it cannot be read
+size_t readNumber(const string& file_name, size_t default_value) {
+  const string line = readLine(file_name);
+  return line.empty() ? default_value : std::strtoul(line.c_str(), nullptr, 10);
+}
+
+/// size like "32K" or "8192K"
+size_t parseSize(const string& text) {
+  char*      end;
+  size_t     size = std::strtoul(text.c_str(), &end, 10);
+  const char unit = *end;
+  if (unit == 'K') {
+    size <<= 10;
+  } else if (unit == 'M') {
+    size <<= 20;
+  } else if (unit == 'G') {
+    size <<= 30;
+  }
+  return size;
+}
+
+/// list like "0-3,8,10-11"
+vector<size_t> parseCpuList(const string& text) {
+
+  vector<size_t> cpus;
+  const char*    current = text.c_str();
+
+  while (*current >= '0' and *current <= '9') {
+    char*        end;
+    const size_t first = std::strtoul(current, &end, 10);
+    size_t       last  = first;
+    if (*end == '-') {
+      last = std::strtoul(end + 1, &end, 10);
+    }
+    for (size_t cpu = first; cpu <= last; ++cpu) {
+      cpus.emplace_back(cpu);
+    }
+    current = (*end == ',') ? end + 1 : end;
+  }
+
+  return cpus;
+}
+
+size_t configuration(int name) {
+  const long value = ::sysconf(name);
+  return value > 0 ? static_cast<size_t>(value) : 0;
+}
+
+void readCpus(CpuTopology& topology) {
+
+  vector<size_t> online = parseCpuList(readLine(string{cpu_directory} + "online"));
+  if (online.empty()) {
+    const size_t cpu_number = std::max(configuration(_SC_NPROCESSORS_ONLN), size_t{1});
+    for (size_t cpu = 0; cpu < cpu_number; ++cpu) {
+      online.emplace_back(cpu);
+    }
+  }
+
+  for (const auto cpu : online) {
+    const string topology_directory = string{cpu_directory} + "cpu" + std::to_string(cpu) + "/topology/";
+    topology.cpus.emplace_back(LogicalCpu{cpu, readNumber(topology_directory + "core_id", cpu),
+                                          readNumber(topology_directory + "physical_package_id", 0), 0});
+  }
+
+  std::set<std::pair<size_t, size_t>> cores;
+  std::set<size_t>                    packages;
+  for (const auto& c : topology.cpus) {
+    cores.emplace(c.package_id, c.core_id);
+    packages.emplace(c.package_id);
+  }
+  topology.core_number    = cores.size();
+  topology.package_number = packages.size();
+}
+
+void readCaches(CpuTopology& topology) {
+
+  const string directory = string{cpu_directory} + "cpu" + std::to_string(topology.cpus.front().id) + "/cache/index";
+
+  for (size_t index = 0;; ++index) {
+    const string prefix = directory + std::to_string(index) + "/";
+    const string level  = readLine(prefix + "level");
+    if (level.empty()) {
+      break;
+    }
+    const string type       = readLine(prefix + "type");
+    CacheType    cache_type = CacheType::Unified;
+    if (type == "Data") {
+      cache_type = CacheType::Data;
+    } else if (type == "Instruction") {
+      cache_type = CacheType::Instruction;
+    }
+    topology.caches.emplace_back(CacheDescription{static_cast<unsigned>(std::strtoul(level.c_str(), nullptr, 10)),
+                                                  cache_type, parseSize(readLine(prefix + "size")),
+                                                  readNumber(prefix + "coherency_line_size", 0),
+                                                  readNumber(prefix + "ways_of_associativity", 0),
+                                                  parseCpuList(readLine(prefix + "shared_cpu_list")).size()});
+  }
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  // glibc only
+  if (topology.caches.empty()) {
+    const size_t              line_size = configuration(_SC_LEVEL1_DCACHE_LINESIZE);
+    const std::pair<int, int> levels[]  = {{_SC_LEVEL1_DCACHE_SIZE, _SC_LEVEL1_DCACHE_ASSOC},
+                                           {_SC_LEVEL2_CACHE_SIZE, _SC_LEVEL2_CACHE_ASSOC},
+                                           {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL3_CACHE_ASSOC}};
+    unsigned level = 1;
+    for (const auto& l : levels) {
+      const size_t size = configuration(l.first);
+      if (size != 0) {
+        topology.caches.emplace_back(CacheDescription{level, level == 1 ? CacheType::Data : CacheType::Unified, size,
+                                                      line_size, configuration(l.second), 0});
+      }
+      ++level;
+    }
+  }
+#endif
+}
+
+/// memory of a node, from the "Node 0 MemTotal:       16309612 kB" line
+size_t readNodeMemory(const string& meminfo_name) {
+
+  std::ifstream input(meminfo_name);
+  string        line;
+  while (std::getline(input, line)) {
+    const auto position = line.find("MemTotal:");
+    if (position != string::npos) {
+      return static_cast<size_t>(std::strtoul(line.c_str() + position + 9, nullptr, 10)) << 10;
+    }
+  }
+
+  return 0;
+}
+
+void readNumaNodes(CpuTopology& topology) {
+
+  for (const auto node : parseCpuList(readLine(string{node_directory} + "online"))) {
+    const string prefix = string{node_directory} + "node" + std::to_string(node) + "/";
+    topology.numa_nodes.emplace_back(
+        NumaNode{node, parseCpuList(readLine(prefix + "cpulist")), readNodeMemory(prefix + "meminfo")});
+  }
+
+  if (topology.numa_nodes.empty()) {
+    NumaNode node{0, {}, configuration(_SC_PHYS_PAGES) * configuration(_SC_PAGESIZE)};
+    for (const auto& c : topology.cpus) {
+      node.cpus.emplace_back(c.id);
+    }
+    topology.numa_nodes.emplace_back(node);
+  }
+
+  for (auto& c : topology.cpus) {
+    for (const auto& n : topology.numa_nodes) {
+      if (std::find(n.cpus.begin(), n.cpus.end(), c.id) != n.cpus.end()) {
+        c.numa_node = n.id;
+      }
+    }
+  }
+}
+
+/// vendor and model name, from the first processor of /proc/cpuinfo
+void readCpuInfo(CpuTopology& topology) {
+
+  std::ifstream input("/proc/cpuinfo");
+  string        line;
+  while (std::getline(input, line) and not line.empty()) {
+    const auto separator = line.find(':');
+    if (separator == string::npos) {
+      continue;
+    }
+    const string value = separator + 2 <= line.size() ? line.substr(separator + 2) : "";
+    if (line.compare(0, 9, "vendor_id") == 0) {
+      topology.vendor = value;
+    } else if (line.compare(0, 10, "model name") == 0) {
+      topology.model_name = value;
+    }
+  }
+}
+
+#if defined(ELEMENTS_HAS_CPUID)
+
+/// @return the extended control register 0, which tells the register states saved by the operating system
+uint64_t readXcr0() {
+  uint32_t eax;
+  uint32_t edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
+#endif
+
+void detectInstructionSets(CpuTopology& topology) {
+
+  uint32_t features = 0;
+
+  auto add = [&features](bool supported, SimdFeature feature) {
+    if (supported) {
+      features |= static_cast<uint32_t>(feature);
+    }
+  };
+
+#if defined(ELEMENTS_HAS_CPUID)
+  uint32_t eax = 0;
+  uint32_t ebx = 0;
+  uint32_t ecx = 0;
+  uint32_t edx = 0;
+
+  if (__get_cpuid(0, &eax, &ebx, &ecx, &edx) == 0) {
+    topology.isa_features = 0;
+    return;
+  }
+  const uint32_t max_leaf = eax;
+
+  if (topology.vendor.empty()) {
+    char vendor[12];
+    std::memcpy(vendor, &ebx, 4);
+    std::memcpy(vendor + 4, &edx, 4);
+    std::memcpy(vendor + 8, &ecx, 4);
+    topology.vendor.assign(vendor, sizeof(vendor));
+  }
+
+  __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+  add(edx & bit_SSE2, SimdFeature::SSE2);
+  add(ecx & bit_SSE3, SimdFeature::SSE3);
+  add(ecx & bit_SSSE3, SimdFeature::SSSE3);
+  add(ecx & bit_SSE4_1, SimdFeature::SSE4_1);
+  add(ecx & bit_SSE4_2, SimdFeature::SSE4_2);
+  add(ecx & bit_POPCNT, SimdFeature::POPCNT);
+
+  // the AVX registers can only be used if the operating system saves them
+  const bool     os_xsave  = (ecx & bit_OSXSAVE) != 0;
+  const uint64_t xcr0      = os_xsave ? readXcr0() : 0;
+  const bool     ymm_state = (xcr0 & 0x6) == 0x6;
+  const bool     zmm_state = (xcr0 & 0xE6) == 0xE6;
+  const bool     avx       = ymm_state and (ecx & bit_AVX) != 0;
+  add(avx, SimdFeature::AVX);
+  add(avx and (ecx & bit_FMA) != 0, SimdFeature::FMA);
+
+  if (max_leaf >= 7) {
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    add(avx and (ebx & bit_AVX2) != 0, SimdFeature::AVX2);
+    add((ebx & bit_BMI2) != 0, SimdFeature::BMI2);
+    const bool avx512 = avx and zmm_state and (ebx & bit_AVX512F) != 0;
+    add(avx512, SimdFeature::AVX512F);
+    add(avx512 and (ebx & bit_AVX512DQ) != 0, SimdFeature::AVX512DQ);
+    add(avx512 and (ebx & bit_AVX512BW) != 0, SimdFeature::AVX512BW);
+    add(avx512 and (ebx & bit_AVX512VL) != 0, SimdFeature::AVX512VL);
+  }
+#elif defined(__aarch64__) or defined(__ARM_NEON)
+  add(true, SimdFeature::NEON);
+#else
+  static_cast<void>(add);
+#endif
+
+  topology.isa_features = features;
+}
+
+CpuTopology readCpuTopology() {
+
+  CpuTopology topology{"", "", {}, {}, {}, 0, 0, 0};
+
+  readCpuInfo(topology);
+  readCpus(topology);
+  readCaches(topology);
+  readNumaNodes(topology);
+  detectInstructionSets(topology);
+
+  return topology;
+}
+
+}  // namespace
+
+size_t CpuTopology::logicalCpuNumber() const {
+  return cpus.size();
+}
+
+size_t CpuTopology::threadsPerCore() const {
+  return core_number > 0 ? (cpus.size() + core_number - 1) / core_number : 1;
+}
+
+bool CpuTopology::hasFeatures(uint32_t features) const {
+  return (isa_features & features) == features;
+}
+
+const CacheDescription* CpuTopology::dataCache(unsigned level) const {
+
+  const auto found = std::find_if(caches.begin(), caches.end(), [level](const CacheDescription& c) {
+    return c.level == level and c.type != CacheType::Instruction;
+  });
+
+  return found != caches.end() ? &(*found) : nullptr;
+}
+
+const CpuTopology& cpuTopology() {
+  static const CpuTopology topology = readCpuTopology();
+  return topology;
+}
+
+vector<size_t> availableCpus() {
+
+  vector<size_t> cpus;
+
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (::sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+    for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &mask)) {
+        cpus.emplace_back(cpu);
+      }
+    }
+  } else {
+    for (const auto& c : cpuTopology().cpus) {
+      cpus.emplace_back(c.id);
+    }
+  }
+
+  return cpus;
+}
+
+size_t recommendedThreadNumber() {
+
+  const auto& topology = cpuTopology();
+  const auto  cpus     = availableCpus();
+
+  std::set<std::pair<size_t, size_t>> cores;
+  for (const auto& c : topology.cpus) {
+    if (std::find(cpus.begin(), cpus.end(), c.id) != cpus.end()) {
+      cores.emplace(c.package_id, c.core_id);
+    }
+  }
+
+  return std::max(cores.size(), size_t{1});
+}
+
+}  // namespace System
+}  // namespace Elements
@@ -0,0 +1,65 @@
+/**
+ * @file LoaderState.h
+ * @brief counters of the dynamic loader, shared by the local implementations
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef ELEMENTSKERNEL_SRC_LIB_LOADERSTATE_H_
+#define ELEMENTSKERNEL_SRC_LIB_LOADERSTATE_H_
+
+#ifndef __APPLE__
+
+#include <link.h>  // for dl_iterate_phdr, dl_phdr_info
+
+#include <cstddef>  // for size_t, offsetof
+
+namespace Elements {
+inline namespace Kernel {
+
+/// number of libraries loaded and unloaded since the start, which identifies the state of the loader
+struct LoaderState {
+  unsigned long long adds;
+  unsigned long long subs;
+};
+
+inline bool operator==(const LoaderState& left, const LoaderState& right) {
+  return left.adds == right.adds and left.subs == right.subs;
+}
+
+/// the counters are the same for all the modules: only the first one is visited
+inline int readLoaderState(struct dl_phdr_info* info, std::size_t size, void* data) {
+  auto state = static_cast<LoaderState*>(data);
+  if (size >= offsetof(struct dl_phdr_info, dlpi_subs) + sizeof(info->dlpi_subs)) {
+    state->adds = info->dlpi_adds;
+    state->subs = info->dlpi_subs;
+  }
+  return 1;
+}
+
+/// @return the current counters. They are 0 with the old C libraries which don't provide them
+inline LoaderState currentLoaderState() {
+  LoaderState state{0, 0};
+  ::dl_iterate_phdr(readLoaderState, &state);
+  return state;
+}
+
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif
+
+#endif  // ELEMENTSKERNEL_SRC_LIB_LOADERSTATE_H_
@@ -0,0 +1,213 @@
+/**
+ * @file MappedFile.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/MappedFile.h"
+
+#include <fcntl.h>     // for open
+#include <sys/mman.h>  // for mmap, munmap, madvise
+#include <sys/stat.h>  // for stat, fstat
+#include <unistd.h>    // for close, sysconf
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t, int64_t, uintptr_t
+#include <map>      // for map
+#include <memory>   // for shared_ptr, weak_ptr, make_shared
+#include <mutex>    // for mutex, lock_guard
+#include <utility>  // for pair, make_pair
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Path.h"       // for Path::Item
+
+#include "ModificationTime.h"  // for modificationTime
+
+namespace Elements {
+inline namespace Kernel {
+
+namespace {
+
+using FileKey = std::pair<std::uint64_t, std::uint64_t>;
+
+struct Registry {
+  std::mutex                                         mutex;
+  std::map<FileKey, std::weak_ptr<const MappedFile>> mappings;
+};
+
+Registry& registry() {
+  static Registry the_registry;
+  return the_registry;
+}
+
+/// map the file and place it on a huge page boundary when it is large enough
+void* mapFile(int descriptor, std::size_t size, bool& huge_pages) {
+
+  huge_pages = false;
+
+#if defined(MADV_HUGEPAGE)
+  if (size >= HUGE_PAGE_SIZE) {
+    const std::size_t reserved_size = size + HUGE_PAGE_SIZE;
+    void*             reserved      = ::mmap(nullptr, reserved_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved != MAP_FAILED) {
+      const auto start   = reinterpret_cast<std::uintptr_t>(reserved);
+      const auto aligned = (start + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+      void*      address = ::mmap(reinterpret_cast<void*>(aligned), size, PROT_READ, MAP_SHARED | MAP_FIXED,
+                                  descriptor, 0);
+      if (address == MAP_FAILED) {
+        ::munmap(reserved, reserved_size);
+      } else {
+        // release the parts of the reservation around the mapping
+        const auto page_size  = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const auto mapped_end = aligned + (size + page_size - 1) / page_size * page_size;
+        if (aligned > start) {
+          ::munmap(reserved, aligned - start);
+        }
+        if (start + reserved_size > mapped_end) {
+          ::munmap(reinterpret_cast<void*>(mapped_end), start + reserved_size - mapped_end);
+        }
+        huge_pages = ::madvise(address, size, MADV_HUGEPAGE) == 0;
+        return address;
+      }
+    }
+  }
+#endif
+
+  return ::mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+}
+
+}  // namespace
+
+MappedFile::MappedFile(const Path::Item& file_name)
+    : m_path{file_name}
+    , m_address{nullptr}
+    , m_size{0}
+    , m_huge_pages{false}
+    , m_device{0}
+    , m_inode{0}
+    , m_modification_time{0} {
+
+  const int descriptor = ::open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+  if (descriptor < 0) {
+    throw Exception() << "Cannot open the file " << file_name;
+  }
+
+  struct stat status;
+  if (::fstat(descriptor, &status) != 0 or not S_ISREG(status.st_mode)) {
+    ::close(descriptor);
+    throw Exception() << "Cannot map the file " << file_name << ": it is not a regular file";
+  }
+
+  m_size              = static_cast<std::size_t>(status.st_size);
+  m_device            = static_cast<std::uint64_t>(status.st_dev);
+  m_inode             = static_cast<std::uint64_t>(status.st_ino);
+  m_modification_time = modificationTime(status);
+
+  // an empty file cannot be mapped
+  if (m_size > 0) {
+    void* address = mapFile(descriptor, m_size, m_huge_pages);
+    m_address     = (address == MAP_FAILED) ? nullptr : address;
+  }
+  ::close(descriptor);
+
+  if (m_size > 0 and m_address == nullptr) {
+    throw Exception() << "Cannot map the file " << file_name;
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (m_address != nullptr) {
+    ::munmap(m_address, m_size);
+  }
+}
+
+std::shared_ptr<const MappedFile> MappedFile::get(const Path::Item& file_name) {
+
+  struct stat status;
+  if (::stat(file_name.c_str(), &status) != 0) {
+    throw Exception() << "Cannot open the file " << file_name;
+  }
+
+  const FileKey key{static_cast<std::uint64_t>(status.st_dev), static_cast<std::uint64_t>(status.st_ino)};
+
+  auto&                       the_registry = registry();
+  std::lock_guard<std::mutex> lock(the_registry.mutex);
+
+  auto found = the_registry.mappings.find(key);
+  if (found != the_registry.mappings.end()) {
+    auto mapping = found->second.lock();
+    // a file modified in place is mapped again
+    if (mapping != nullptr and mapping->m_modification_time == modificationTime(status) and
+        mapping->m_size == static_cast<std::size_t>(status.st_size)) {
+      return mapping;
+    }
+  }
+
+  auto mapping = std::make_shared<const MappedFile>(file_name);
+
+  // the released mappings are dropped
+  for (auto it = the_registry.mappings.begin(); it != the_registry.mappings.end();) {
+    if (it->second.expired()) {
+      it = the_registry.mappings.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  the_registry.mappings[std::make_pair(mapping->m_device, mapping->m_inode)] = mapping;
+
+  return mapping;
+}
+
+std::size_t MappedFile::registrySize() {
+
+  auto&                       the_registry = registry();
+  std::lock_guard<std::mutex> lock(the_registry.mutex);
+
+  std::size_t size = 0;
+  for (const auto& m : the_registry.mappings) {
+    if (not m.second.expired()) {
+      ++size;
+    }
+  }
+
+  return size;
+}
+
+const Path::Item& MappedFile::path() const {
+  return m_path;
+}
+
+const char* MappedFile::data() const {
+  return static_cast<const char*>(m_address);
+}
+
+std::size_t MappedFile::size() const {
+  return m_size;
+}
+
+bool MappedFile::empty() const {
+  return m_size == 0;
+}
+
+bool MappedFile::hugePages() const {
+  return m_huge_pages;
+}
+
+}  // namespace Kernel
+}  // namespace Elements
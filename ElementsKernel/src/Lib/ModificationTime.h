@@ -0,0 +1,44 @@
+/**
+ * @file ModificationTime.h
+ * @brief nanosecond modification time of a file, shared by the local implementations
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef ELEMENTSKERNEL_SRC_LIB_MODIFICATIONTIME_H_
+#define ELEMENTSKERNEL_SRC_LIB_MODIFICATIONTIME_H_
+
+#include <sys/stat.h>  // for stat
+
+#include <cstdint>  // for int64_t
+
+namespace Elements {
+inline namespace Kernel {
+
+/// @return the modification time of a file status in nanoseconds since the epoch
+inline std::int64_t modificationTime(const struct stat& status) {
+#if defined(__APPLE__)
+  const auto& time_spec = status.st_mtimespec;
+#else
+  const auto& time_spec = status.st_mtim;
+#endif
+  return static_cast<std::int64_t>(time_spec.tv_sec) * 1000000000 + time_spec.tv_nsec;
+}
+
+}  // namespace Kernel
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_SRC_LIB_MODIFICATIONTIME_H_
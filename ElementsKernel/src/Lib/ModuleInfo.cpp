@@ -23,6 +23,10 @@
 
 #include <dlfcn.h>
 #include <libgen.h>
+#ifndef __APPLE__
+#include <elf.h>   // for PT_LOAD, PT_NOTE, NT_GNU_BUILD_ID
+#include <link.h>  // for dl_iterate_phdr, dl_phdr_info, ElfW
+#endif
 #include <sys/param.h>
 #include <sys/times.h>
 #include <unistd.h>
@@ -32,12 +36,16 @@
 #endif
 
 #include <array>
+#include <algorithm>  // for min, max
 #include <cerrno>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uintptr_t
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <fstream>  // for ifstream
 #include <iostream>
+#include <memory>   // for shared_ptr, make_shared
+#include <mutex>    // for mutex, lock_guard
 #include <sstream>  // for stringstream
 #include <string>   // for string
 #include <vector>
@@ -51,13 +59,13 @@
 #include "ElementsKernel/FuncPtrCast.h"
 #include "ElementsKernel/Path.h"  // for Path::Item
 
+#include "LoaderState.h"  // for LoaderState, currentLoaderState
+
+using std::size_t;
 using std::string;
+using std::uintptr_t;
 using std::vector;
 
-namespace {
-vector<string> s_linkedModules;
-}
-
 namespace Elements {
 namespace System {
 
@@ -203,44 +211,154 @@ Path::Item getSelfProc() {
   return self_proc;
 }
 
-vector<Path::Item> linkedModulePaths() {
+namespace {
 
-  vector<Path::Item> linked_modules;
+#ifndef __APPLE__
+
+string readBuildId(const struct dl_phdr_info* info, const ElfW(Phdr)& header) {
+
+  static const char hexadecimal[] = "0123456789abcdef";
+
+  const size_t alignment = header.p_align == 8 ? 8 : 4;
+  const auto   begin     = reinterpret_cast<const char*>(info->dlpi_addr + header.p_vaddr);
+  const auto   end       = begin + header.p_memsz;
 
-  Path::Item    self_maps = getSelfProc() / "maps";
-  std::ifstream maps_str(self_maps.string());
-
-  string line;
-  while (std::getline(maps_str, line)) {
-    string             address;
-    string             perms;
-    string             offset;
-    string             dev;
-    string             pathname;
-    unsigned           inode;
-    std::istringstream iss(line);
-    if (not(iss >> address >> perms >> offset >> dev >> inode >> pathname)) {
-      continue;
+  auto align = [alignment](size_t value) {
+    return (value + alignment - 1) & ~(alignment - 1);
+  };
+
+  for (auto current = begin; current + sizeof(ElfW(Nhdr)) <= end;) {
+    const auto note        = reinterpret_cast<const ElfW(Nhdr)*>(current);
+    const auto name        = current + sizeof(ElfW(Nhdr));
+    const auto description = name + align(note->n_namesz);
+    if (description + note->n_descsz > end) {
+      break;
+    }
+    if (note->n_type == NT_GNU_BUILD_ID and note->n_namesz == 4 and std::memcmp(name, "GNU", 4) == 0) {
+      string build_id;
+      build_id.reserve(2 * note->n_descsz);
+      for (size_t i = 0; i < note->n_descsz; ++i) {
+        const auto byte = static_cast<unsigned char>(description[i]);
+        build_id += hexadecimal[byte >> 4];
+        build_id += hexadecimal[byte & 0xF];
+      }
+      return build_id;
     }
-    if (perms == "r-xp" and boost::filesystem::exists(pathname)) {
-      linked_modules.emplace_back(Path::Item(pathname));
+    current = description + align(note->n_descsz);
+  }
+
+  return "";
+}
+
+int addLinkedModule(struct dl_phdr_info* info, size_t, void* data) {
+
+  auto modules = static_cast<vector<LinkedModule>*>(data);
+
+  const bool is_executable = info->dlpi_name == nullptr or info->dlpi_name[0] == '\0';
+  // the modules without a file (vDSO) have a bare name
+  if (not is_executable and std::strchr(info->dlpi_name, '/') == nullptr) {
+    return 0;
+  }
+
+  uintptr_t low      = UINTPTR_MAX;
+  uintptr_t high     = 0;
+  bool      has_code = false;
+  string    build_id;
+  for (ElfW(Half) i = 0; i < info->dlpi_phnum; ++i) {
+    const auto& header = info->dlpi_phdr[i];
+    if (header.p_type == PT_LOAD) {
+      low      = std::min(low, static_cast<uintptr_t>(header.p_vaddr));
+      high     = std::max(high, static_cast<uintptr_t>(header.p_vaddr + header.p_memsz));
+      has_code = has_code or (header.p_flags & PF_X) != 0;
+    } else if (header.p_type == PT_NOTE and build_id.empty()) {
+      build_id = readBuildId(info, header);
     }
   }
 
-  maps_str.close();
+  if (has_code) {
+    // the executable has no name in the list of the loader
+    modules->emplace_back(LinkedModule{is_executable ? string() : string(info->dlpi_name),
+                                       reinterpret_cast<const void*>(info->dlpi_addr + low), high - low, build_id});
+  }
+
+  return 0;
+}
+
+#endif
+
+struct LinkedModuleCache {
+  std::mutex                                  mutex;
+  std::shared_ptr<const vector<LinkedModule>> modules;
+#ifndef __APPLE__
+  LoaderState state{0, 0};
+#endif
+};
+
+/// never destroyed: the modules can be listed during the static destruction
+LinkedModuleCache& linkedModuleCache() {
+  static LinkedModuleCache* cache = new LinkedModuleCache;
+  return *cache;
+}
+
+std::shared_ptr<const vector<LinkedModule>> currentLinkedModules() {
+
+  auto&                       cache = linkedModuleCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+
+#ifndef __APPLE__
+  const LoaderState state = currentLoaderState();
+
+  // without the counters (old C libraries), the list is always rebuilt
+  if (cache.modules == nullptr or not(state == cache.state) or state.adds == 0) {
+    auto modules = std::make_shared<vector<LinkedModule>>();
+    ::dl_iterate_phdr(addLinkedModule, modules.get());
+    for (auto& m : *modules) {
+      if (m.path.empty()) {
+        m.path = getExecutablePath().string();
+      }
+    }
+    cache.modules = modules;
+    cache.state   = state;
+  }
+#else
+  if (cache.modules == nullptr) {
+    cache.modules = std::make_shared<vector<LinkedModule>>();
+  }
+#endif
+
+  return cache.modules;
+}
+
+}  // namespace
+
+vector<LinkedModule> linkedModuleEntries() {
+  return *currentLinkedModules();
+}
+
+vector<Path::Item> linkedModulePaths() {
+
+  const auto modules = currentLinkedModules();
+
+  vector<Path::Item> linked_modules;
+  linked_modules.reserve(modules->size());
+  for (const auto& m : *modules) {
+    linked_modules.emplace_back(m.path);
+  }
 
   return linked_modules;
 }
 
 const vector<string> linkedModules() {
 
-  if (s_linkedModules.size() == 0) {
+  const auto modules = currentLinkedModules();
 
-    for (auto m : linkedModulePaths()) {
-      s_linkedModules.emplace_back(m.string());
-    }
+  vector<string> linked_modules;
+  linked_modules.reserve(modules->size());
+  for (const auto& m : *modules) {
+    linked_modules.emplace_back(m.path);
   }
-  return s_linkedModules;
+
+  return linked_modules;
 }
 
 Path::Item getExecutablePath() {
@@ -22,16 +22,19 @@
 
 #include "ElementsKernel/Path.h"
 
-#include <algorithm>  // for transform, remove_if
+#include <algorithm>  // for remove_if
+#include <cstddef>    // for size_t
 #include <map>        // for map
 #include <string>     // for string
 #include <vector>     // for vector
 
-#include <boost/algorithm/string.hpp>  // for boost::split
-#include <boost/filesystem.hpp>        // for boost::filesystem
+#include <boost/filesystem.hpp>           // for boost::filesystem
+#include <boost/utility/string_view.hpp>  // for string_view
 
-#include "ElementsKernel/Environment.h"  // for the Environment class
-#include "ElementsKernel/System.h"       // for getEnv, SHLIB_VAR_NAME
+#include "ElementsKernel/EnvironmentSnapshot.h"  // for EnvironmentSnapshot
+#include "ElementsKernel/PathIndex.h"            // for Index
+#include "ElementsKernel/PathLookupCache.h"      // for LookupCache
+#include "ElementsKernel/System.h"               // for getEnv, SHLIB_VAR_NAME
 
 using std::map;
 using std::string;
@@ -69,11 +72,7 @@ const std::map<Type, const bool> HAS_SUBLEVELS{{Type::executable, false},
 
 vector<Item> getLocationsFromEnv(const string& path_variable, bool exist_only) {
 
-  Environment current_env;
-
-  string env_content = current_env[path_variable];
-
-  vector<Item> found_list = split(env_content);
+  vector<Item> found_list = split(EnvironmentSnapshot::get(path_variable));
 
   if (exist_only) {
     auto new_end = std::remove_if(found_list.begin(), found_list.end(), [](const Item& p) {
@@ -91,17 +90,108 @@ vector<Item> getLocations(const Type& path_type, bool exist_only) {
 
 vector<Item> splitPath(const string& path_string) {
 
-  vector<string> str_list;
-  boost::split(str_list, path_string, boost::is_any_of(PATH_SEP));
+  const PathTokenizer tokens{path_string};
+
+  vector<Item> found_list;
+  found_list.reserve(tokens.size());
 
-  vector<Item> found_list(str_list.size());
-  std::transform(str_list.cbegin(), str_list.cend(), found_list.begin(), [](const string& s) {
-    return Item{s};
-  });
+  for (const auto& token : tokens) {
+    found_list.emplace_back(string(token.data(), token.size()));
+  }
 
   return found_list;
 }
 
+namespace {
+
+/// @return the position of the next separator. The single character case goes through memchr.
+std::size_t findSeparator(boost::string_view path_string, std::size_t position) {
+  if (PATH_SEP.size() == 1) {
+    return path_string.find(PATH_SEP[0], position);
+  }
+  return path_string.find_first_of(PATH_SEP, position);
+}
+
+}  // namespace
+
+PathTokenizer::const_iterator::const_iterator(boost::string_view path_string, std::size_t position)
+    : m_path_string{path_string}, m_position{position} {
+  if (m_position <= m_path_string.size()) {
+    m_entry = m_path_string.substr(m_position, findSeparator(m_path_string, m_position) - m_position);
+  }
+}
+
+auto PathTokenizer::const_iterator::operator*() const -> reference {
+  return m_entry;
+}
+
+auto PathTokenizer::const_iterator::operator->() const -> pointer {
+  return &m_entry;
+}
+
+auto PathTokenizer::const_iterator::operator++() -> const_iterator& {
+  *this = const_iterator{m_path_string, m_position + m_entry.size() + 1};
+  return *this;
+}
+
+auto PathTokenizer::const_iterator::operator++(int) -> const_iterator {
+  const_iterator previous{*this};
+  ++(*this);
+  return previous;
+}
+
+bool PathTokenizer::const_iterator::operator==(const const_iterator& other) const {
+  return m_path_string.data() == other.m_path_string.data() and m_position == other.m_position;
+}
+
+bool PathTokenizer::const_iterator::operator!=(const const_iterator& other) const {
+  return not(*this == other);
+}
+
+PathTokenizer::PathTokenizer(boost::string_view path_string) : m_path_string{path_string} {}
+
+auto PathTokenizer::begin() const -> const_iterator {
+  return const_iterator{m_path_string, 0};
+}
+
+auto PathTokenizer::end() const -> const_iterator {
+  // one past the last separator
+  return const_iterator{m_path_string, m_path_string.size() + 1};
+}
+
+std::size_t PathTokenizer::size() const {
+  std::size_t entry_number = 1;
+  for (auto pos = findSeparator(m_path_string, 0); pos != boost::string_view::npos;
+       pos      = findSeparator(m_path_string, pos + 1)) {
+    ++entry_number;
+  }
+  return entry_number;
+}
+
+bool existsInLocation(const Item& file_name, const Item& location) {
+
+  // only the paths below a directory link are unknown to a valid index
+  const auto index = Index::get(location);
+  if (index != nullptr) {
+    const auto lookup = index->find(file_name.string());
+    if (lookup != Index::Lookup::unknown) {
+      return lookup == Index::Lookup::found;
+    }
+  }
+
+  return boost::filesystem::exists(location / file_name);
+}
+
+map<string, Item> getPathsFromLocations(const vector<string>& file_names, const vector<Item>& locations,
+                                        bool parallel) {
+  return LookupCache::instance().getPathsFromLocations(file_names, locations, parallel);
+}
+
+map<string, Item> getPathsFromEnvVariable(const vector<string>& file_names, const string& path_variable,
+                                          bool parallel) {
+  return getPathsFromLocations(file_names, getLocationsFromEnv(path_variable), parallel);
+}
+
 // Template instantiation for the most common types
 template Item getPathFromLocations(const Item& file_name, const vector<Item>& locations);
 template Item getPathFromLocations(const Item& file_name, const vector<string>& locations);
@@ -0,0 +1,472 @@
+/**
+ * @file PathIndex.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathIndex.h"
+
+#include <fcntl.h>     // for open, AT_FDCWD
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for stat, fstat, utimensat
+#include <unistd.h>    // for close
+
+#include <algorithm>      // for sort, min
+#include <chrono>         // for steady_clock, milliseconds
+#include <cstdint>        // for uint64_t, uint8_t
+#include <cstring>        // for memcmp, memcpy
+#include <fstream>        // for ofstream
+#include <memory>         // for make_shared
+#include <mutex>          // for mutex, lock_guard
+#include <string>         // for string
+#include <thread>         // for sleep_for
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+#include <vector>         // for vector
+
+#include <boost/filesystem/operations.hpp>  // for recursive_directory_iterator, rename
+#include <boost/system/error_code.hpp>      // for error_code
+
+#include "ElementsKernel/Exception.h"        // for Exception
+#include "ElementsKernel/Logging.h"          // for Logging
+#include "ElementsKernel/PathLookupCache.h"  // for DEFAULT_VALIDATION_PERIOD
+
+#include "ModificationTime.h"  // for modificationTime
+
+using std::string;
+using std::vector;
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+const string INDEX_FILE_NAME{".elements_index"};
+
+namespace {
+
+auto log = Logging::getLogger("PathIndex");
+
+constexpr char        MAGIC[8] = {'E', 'L', 'P', 'I', 'D', 'X', '0', '1'};
+constexpr std::size_t WORD_SIZE{sizeof(std::uint64_t)};
+constexpr std::size_t HEADER_SIZE{sizeof(MAGIC) + 2 * WORD_SIZE};
+
+std::size_t paddedSize(std::size_t size) {
+  return (size + WORD_SIZE - 1) / WORD_SIZE * WORD_SIZE;
+}
+
+using Clock = std::chrono::steady_clock;
+
+struct RegistryEntry {
+  std::shared_ptr<const Index> index;
+  Clock::time_point            check_time;
+};
+
+struct Registry {
+  std::mutex                                mutex;
+  std::unordered_map<string, RegistryEntry> indexes;
+};
+
+Registry& registry() {
+  static Registry the_registry;
+  return the_registry;
+}
+
+/**
+ * @return true if the directory exists and was last modified before the given time. A
+ *   modification at the same time can be later within the resolution of the timestamps.
+ */
+bool isModifiedBefore(const Item& directory, std::int64_t time, std::size_t& system_calls) {
+  struct stat status;
+  ++system_calls;
+  return ::stat(directory.c_str(), &status) == 0 and modificationTime(status) < time;
+}
+
+/// @return the valid index of a directory or nullptr
+std::shared_ptr<const Index> loadIndex(const Item& directory, std::size_t& system_calls) {
+
+  std::shared_ptr<const Index> index;
+
+  struct stat status;
+  // a quick check of the top directory before the mapping
+  ++system_calls;
+  if (::stat((directory / INDEX_FILE_NAME).c_str(), &status) != 0 or
+      not isModifiedBefore(directory, modificationTime(status), system_calls)) {
+    return index;
+  }
+
+  try {
+    index = std::make_shared<const Index>(directory);
+  } catch (const Exception& e) {
+    log.warn() << e.what();
+    return index;
+  }
+
+  // the index file can have been replaced since the quick check
+  if (not index->isUpToDate(system_calls)) {
+    log.debug() << "The path index of " << directory << " is outdated";
+    index.reset();
+  }
+
+  return index;
+}
+
+/**
+ * @brief set the modification time of the index file strictly after the one of its directory
+ * @details
+ *   The renaming of the index updates the directory. The time is set
+ *   again until the timestamp resolution is exceeded.
+ */
+bool touchAfter(const Item& file_name, const Item& directory) {
+
+  constexpr int max_attempts{1000};
+
+  struct stat file_status;
+  struct stat directory_status;
+
+  for (int attempt = 0; attempt < max_attempts; ++attempt) {
+    if (::utimensat(AT_FDCWD, file_name.c_str(), nullptr, 0) != 0 or ::stat(file_name.c_str(), &file_status) != 0 or
+        ::stat(directory.c_str(), &directory_status) != 0) {
+      return false;
+    }
+    if (modificationTime(directory_status) < modificationTime(file_status)) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  return false;
+}
+
+int compare(const char* first, std::size_t first_length, const char* second, std::size_t second_length) {
+  int result = std::memcmp(first, second, std::min(first_length, second_length));
+  if (result == 0 and first_length != second_length) {
+    result = first_length < second_length ? -1 : 1;
+  }
+  return result;
+}
+
+}  // namespace
+
+Index::Index(const Item& directory)
+    : m_directory{directory}
+    , m_address{nullptr}
+    , m_length{0}
+    , m_modification_time{0}
+    , m_size{0}
+    , m_offsets{nullptr}
+    , m_types{nullptr}
+    , m_strings{nullptr} {
+
+  const Item file_name = directory / INDEX_FILE_NAME;
+
+  const int descriptor = ::open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+  if (descriptor < 0) {
+    throw Exception() << "Cannot open the path index " << file_name;
+  }
+
+  struct stat status;
+  if (::fstat(descriptor, &status) == 0 and static_cast<std::size_t>(status.st_size) >= HEADER_SIZE) {
+    m_length            = static_cast<std::size_t>(status.st_size);
+    m_modification_time = modificationTime(status);
+    void* address       = ::mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    m_address           = (address == MAP_FAILED) ? nullptr : address;
+  }
+  ::close(descriptor);
+
+  bool valid = (m_address != nullptr);
+
+  if (valid) {
+    const char*   bytes = static_cast<const char*>(m_address);
+    std::uint64_t size;
+    std::uint64_t string_size;
+    std::memcpy(&size, bytes + sizeof(MAGIC), WORD_SIZE);
+    std::memcpy(&string_size, bytes + sizeof(MAGIC) + WORD_SIZE, WORD_SIZE);
+    valid = std::memcmp(bytes, MAGIC, sizeof(MAGIC)) == 0 and size < m_length / WORD_SIZE and
+            string_size <= m_length and
+            HEADER_SIZE + (size + 1) * WORD_SIZE + paddedSize(size) + string_size == m_length;
+    if (valid) {
+      m_size    = static_cast<std::size_t>(size);
+      m_offsets = reinterpret_cast<const std::uint64_t*>(bytes + HEADER_SIZE);
+      m_types   = reinterpret_cast<const std::uint8_t*>(bytes + HEADER_SIZE + (m_size + 1) * WORD_SIZE);
+      m_strings = bytes + HEADER_SIZE + (m_size + 1) * WORD_SIZE + paddedSize(m_size);
+      // the offsets must be increasing and each entry terminated: the lookups don't check anything
+      valid = m_offsets[0] == 0 and m_offsets[m_size] == string_size;
+      for (std::size_t i = 0; valid and i < m_size; ++i) {
+        valid = m_offsets[i] < m_offsets[i + 1] and m_strings[m_offsets[i + 1] - 1] == '\0' and
+                m_types[i] <= static_cast<std::uint8_t>(EntryType::linked_directory);
+      }
+    }
+  }
+
+  if (not valid) {
+    if (m_address != nullptr) {
+      ::munmap(m_address, m_length);
+    }
+    throw Exception() << "Invalid path index " << file_name;
+  }
+}
+
+Index::~Index() {
+  ::munmap(m_address, m_length);
+}
+
+std::shared_ptr<const Index> Index::get(const Item& directory) {
+  std::size_t system_calls = 0;
+  return get(directory, system_calls);
+}
+
+std::shared_ptr<const Index> Index::get(const Item& directory, std::size_t& system_calls) {
+
+  if (directory.empty()) {
+    return nullptr;
+  }
+
+  auto&        the_registry = registry();
+  const string key          = directory.string();
+  const auto   now          = Clock::now();
+
+  std::shared_ptr<const Index> index;
+  {
+    std::lock_guard<std::mutex> lock(the_registry.mutex);
+    auto                        found = the_registry.indexes.find(key);
+    if (found != the_registry.indexes.end()) {
+      if (now - found->second.check_time < DEFAULT_VALIDATION_PERIOD) {
+        return found->second.index;
+      }
+      index = found->second.index;
+    }
+  }
+
+  // the filesystem is checked without the lock: the other locations are not delayed
+  if (index == nullptr or not index->isUpToDate(system_calls)) {
+    // first request, outdated index or absence of index to be checked again
+    index = loadIndex(directory, system_calls);
+  }
+
+  std::lock_guard<std::mutex> lock(the_registry.mutex);
+  auto&                       entry = the_registry.indexes[key];
+  entry.index                       = index;
+  entry.check_time                  = now;
+
+  return index;
+}
+
+void Index::clearRegistry() {
+  auto&                       the_registry = registry();
+  std::lock_guard<std::mutex> lock(the_registry.mutex);
+  the_registry.indexes.clear();
+}
+
+std::size_t Index::write(const Item& directory) {
+
+  using boost::filesystem::recursive_directory_iterator;
+
+  vector<std::pair<string, EntryType>> entries;
+
+  boost::system::error_code error;
+  for (recursive_directory_iterator it{directory, error}, end; not error and it != end; it.increment(error)) {
+    const auto& path = it->path();
+    // the index itself and its temporary file
+    if (it.depth() == 0 and path.filename().string().compare(0, INDEX_FILE_NAME.size(), INDEX_FILE_NAME) == 0) {
+      continue;
+    }
+    auto       type = EntryType::file;
+    const bool link = boost::filesystem::is_symlink(it->symlink_status());
+    if (boost::filesystem::is_directory(it->status())) {
+      type = link ? EntryType::linked_directory : EntryType::directory;
+    } else if (link and not boost::filesystem::exists(path)) {
+      // broken links are not found by getPathFromLocations either
+      continue;
+    }
+    entries.emplace_back(path.lexically_relative(directory).generic_string(), type);
+  }
+  if (error) {
+    throw Exception() << "Cannot index the " << directory << " directory: " << error.message();
+  }
+
+  std::sort(entries.begin(), entries.end());
+
+  vector<std::uint64_t> offsets{0};
+  vector<std::uint8_t>  types;
+  string                strings;
+  for (const auto& entry : entries) {
+    strings += entry.first;
+    strings += '\0';
+    offsets.emplace_back(strings.size());
+    types.emplace_back(static_cast<std::uint8_t>(entry.second));
+  }
+  types.resize(paddedSize(types.size()), 0);
+
+  const std::uint64_t size        = entries.size();
+  const std::uint64_t string_size = strings.size();
+  const Item          file_name   = directory / INDEX_FILE_NAME;
+  const Item          tmp_name    = directory / (INDEX_FILE_NAME + ".tmp");
+
+  {
+    std::ofstream output(tmp_name.string(), std::ios::binary | std::ios::trunc);
+    output.write(MAGIC, sizeof(MAGIC));
+    output.write(reinterpret_cast<const char*>(&size), WORD_SIZE);
+    output.write(reinterpret_cast<const char*>(&string_size), WORD_SIZE);
+    output.write(reinterpret_cast<const char*>(offsets.data()),
+                 static_cast<std::streamsize>(offsets.size() * WORD_SIZE));
+    output.write(reinterpret_cast<const char*>(types.data()), static_cast<std::streamsize>(types.size()));
+    output.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+    if (not output) {
+      throw Exception() << "Cannot write the path index " << tmp_name;
+    }
+  }
+
+  boost::filesystem::rename(tmp_name, file_name, error);
+  if (error or not touchAfter(file_name, directory)) {
+    throw Exception() << "Cannot install the path index " << file_name;
+  }
+
+  {
+    auto&                       the_registry = registry();
+    std::lock_guard<std::mutex> lock(the_registry.mutex);
+    the_registry.indexes.erase(directory.string());
+  }
+
+  return entries.size();
+}
+
+bool Index::isUpToDate() const {
+  std::size_t system_calls = 0;
+  return isUpToDate(system_calls);
+}
+
+bool Index::isUpToDate(std::size_t& system_calls) const {
+
+  // the tree below the top directory is not checked: the index is rewritten with it
+  struct stat status;
+  ++system_calls;
+  return ::stat((m_directory / INDEX_FILE_NAME).c_str(), &status) == 0 and
+         modificationTime(status) == m_modification_time and
+         isModifiedBefore(m_directory, m_modification_time, system_calls);
+}
+
+const Item& Index::directory() const {
+  return m_directory;
+}
+
+std::size_t Index::size() const {
+  return m_size;
+}
+
+string Index::entry(std::size_t i) const {
+  return string(entryData(i), entryLength(i));
+}
+
+Index::EntryType Index::type(std::size_t i) const {
+  return static_cast<EntryType>(m_types[i]);
+}
+
+const char* Index::entryData(std::size_t i) const {
+  return m_strings + m_offsets[i];
+}
+
+std::size_t Index::entryLength(std::size_t i) const {
+  return static_cast<std::size_t>(m_offsets[i + 1] - m_offsets[i] - 1);
+}
+
+std::size_t Index::lowerBound(const char* path, std::size_t length) const {
+
+  std::size_t first = 0;
+  std::size_t count = m_size;
+
+  while (count > 0) {
+    const std::size_t step   = count / 2;
+    const std::size_t middle = first + step;
+    if (compare(entryData(middle), entryLength(middle), path, length) < 0) {
+      first = middle + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+
+  return first;
+}
+
+Index::Lookup Index::find(const string& relative_path) const {
+
+  if (relative_path.empty() or relative_path.front() == '/') {
+    return Lookup::unknown;
+  }
+
+  // only the normalized paths are in the index
+  std::size_t begin = 0;
+  while (begin <= relative_path.size()) {
+    std::size_t end = relative_path.find('/', begin);
+    if (end == string::npos) {
+      end = relative_path.size();
+    }
+    const std::size_t length = end - begin;
+    if (length == 0 or (length == 1 and relative_path[begin] == '.') or
+        (length == 2 and relative_path.compare(begin, 2, "..") == 0)) {
+      return Lookup::unknown;
+    }
+    begin = end + 1;
+  }
+
+  auto isEntry = [this](const char* path, std::size_t length, std::size_t& position) {
+    position = lowerBound(path, length);
+    return position < m_size and compare(entryData(position), entryLength(position), path, length) == 0;
+  };
+
+  std::size_t position;
+  if (isEntry(relative_path.data(), relative_path.size(), position)) {
+    return Lookup::found;
+  }
+
+  // a missing path can still exist below a directory link
+  for (std::size_t end = relative_path.find('/'); end != string::npos; end = relative_path.find('/', end + 1)) {
+    if (not isEntry(relative_path.data(), end, position)) {
+      return Lookup::missing;
+    }
+    if (type(position) == EntryType::linked_directory) {
+      return Lookup::unknown;
+    }
+  }
+
+  return Lookup::missing;
+}
+
+vector<string> Index::search(const string& name, bool recursive) const {
+
+  vector<string> found_entries;
+
+  for (std::size_t i = 0; not name.empty() and i < m_size; ++i) {
+    const char*       data   = entryData(i);
+    const std::size_t length = entryLength(i);
+    if (length < name.size() or std::memcmp(data + length - name.size(), name.data(), name.size()) != 0) {
+      continue;
+    }
+    const std::size_t parent_length = length - name.size();
+    if (parent_length == 0 or (recursive and data[parent_length - 1] == '/')) {
+      found_entries.emplace_back(data, length);
+    }
+  }
+
+  return found_entries;
+}
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
@@ -0,0 +1,394 @@
+/**
+ * @file PathLookupCache.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/PathLookupCache.h"
+
+#include <sys/stat.h>  // for stat
+
+#include <algorithm>  // for sort, binary_search, min, max
+#include <atomic>     // for atomic
+#include <chrono>     // for steady_clock
+#include <cstdint>    // for int64_t
+#include <map>        // for map
+#include <memory>     // for make_shared, weak_ptr
+#include <mutex>      // for lock_guard
+#include <set>        // for set
+#include <string>     // for string
+#include <thread>     // for thread, hardware_concurrency
+#include <vector>     // for vector
+
+#include <boost/filesystem/operations.hpp>  // for directory_iterator, exists
+#include <boost/system/error_code.hpp>      // for error_code
+
+#include "ElementsKernel/Path.h"         // for Item, getPathFromLocations
+#include "ElementsKernel/PathIndex.h"    // for Index
+#include "ElementsKernel/PathWatcher.h"  // for Watcher
+#include "ElementsKernel/System.h"       // for getEnv
+
+#include "ModificationTime.h"  // for modificationTime
+
+using std::string;
+using std::vector;
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+struct LookupCache::DirectoryIndex {
+
+  DirectoryIndex() : exists{false}, modification_time{0}, check_time{Clock::now()}, subscription{0}, changed{false} {}
+
+  ~DirectoryIndex() {
+    if (subscription != 0) {
+      Watcher::instance().unsubscribe(subscription);
+    }
+  }
+
+  // only check_time and changed are modified once the index is published
+  bool                           exists;
+  std::int64_t                   modification_time;
+  vector<string>                 entries;
+  std::atomic<Clock::time_point> check_time;
+  Watcher::Subscription          subscription;
+  std::atomic<bool>              changed;
+};
+
+namespace {
+
+/// @return false if the directory doesn't exist
+bool getModificationTime(const string& directory, std::int64_t& modification_time) {
+
+  struct stat status;
+  if (::stat(directory.c_str(), &status) != 0 or not S_ISDIR(status.st_mode)) {
+    modification_time = 0;
+    return false;
+  }
+
+  modification_time = modificationTime(status);
+
+  return true;
+}
+
+}  // namespace
+
+// the watcher instance is created first: it outlives the indexes which are subscribed to it
+LookupCache::LookupCache()
+    : m_validation_period{DEFAULT_VALIDATION_PERIOD}
+    , m_watching{Watcher::instance().isAvailable()}
+    , m_hits{0}
+    , m_misses{0}
+    , m_invalidations{0} {}
+
+LookupCache& LookupCache::instance() {
+  static LookupCache cache;
+  return cache;
+}
+
+LookupCache::Locations LookupCache::getLocations(const string& path_variable, const LocationProvider& provider) {
+
+  string value;
+  System::getEnv(path_variable, value);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        found = m_locations.find(path_variable);
+    if (found != m_locations.end() and found->second.first == value) {
+      return found->second.second;
+    }
+  }
+
+  // the provider is called without the lock: it may do some filesystem access
+  auto locations = std::make_shared<const vector<Item>>(provider());
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto&                       entry = m_locations[path_variable];
+  if (entry.second != nullptr) {
+    ++m_invalidations;
+  }
+  entry = std::make_pair(value, locations);
+
+  return locations;
+}
+
+std::shared_ptr<LookupCache::DirectoryIndex> LookupCache::buildIndex(const string& directory, bool watching) {
+
+  auto index = std::make_shared<DirectoryIndex>();
+  // the time is taken before the listing: a concurrent change is caught at the next check
+  index->exists = getModificationTime(directory, index->modification_time);
+
+  if (index->exists) {
+    if (watching) {
+      // the subscription is done before the listing: a concurrent change is not lost
+      std::weak_ptr<DirectoryIndex> watched_index{index};
+      index->subscription = Watcher::instance().subscribe(Item{directory}, [watched_index](const Item&) {
+        auto changed_index = watched_index.lock();
+        if (changed_index != nullptr) {
+          changed_index->changed = true;
+        }
+      });
+    }
+    boost::system::error_code error;
+    for (boost::filesystem::directory_iterator it{directory, error}, end; not error and it != end;
+         it.increment(error)) {
+      // broken links are not found by the uncached lookup either
+      if (boost::filesystem::is_symlink(it->symlink_status()) and not boost::filesystem::exists(it->path())) {
+        continue;
+      }
+      index->entries.emplace_back(it->path().filename().string());
+    }
+    std::sort(index->entries.begin(), index->entries.end());
+  }
+
+  return index;
+}
+
+std::shared_ptr<LookupCache::DirectoryIndex>
+LookupCache::publish(const string& directory, const std::shared_ptr<DirectoryIndex>& previous,
+                     const std::shared_ptr<DirectoryIndex>& index) {
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto found = m_indexes.find(directory);
+  if (found != m_indexes.end()) {
+    // another thread may have published its own listing in the meantime
+    if (found->second == previous) {
+      found->second = index;
+    }
+    return found->second;
+  }
+
+  if (m_indexes.size() >= MAX_DIRECTORY_INDEXES) {
+    // the index validated the longest time ago is dropped, with its watch
+    auto oldest = m_indexes.begin();
+    for (auto it = m_indexes.begin(); it != m_indexes.end(); ++it) {
+      if (it->second->check_time.load() < oldest->second->check_time.load()) {
+        oldest = it;
+      }
+    }
+    m_indexes.erase(oldest);
+  }
+  m_indexes.emplace(directory, index);
+
+  return index;
+}
+
+bool LookupCache::contains(const string& directory, const string& entry, const Clock::time_point& now) {
+
+  std::shared_ptr<DirectoryIndex> index;
+  std::chrono::milliseconds       validation_period;
+  bool                            watching;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        found = m_indexes.find(directory);
+    if (found != m_indexes.end()) {
+      index = found->second;
+    }
+    validation_period = m_validation_period;
+    watching          = m_watching;
+  }
+
+  // the filesystem is only accessed without the lock
+  bool rebuild = false;
+  if (index == nullptr) {
+    rebuild = true;
+  } else if (index->changed) {
+    // a notified change is taken at once
+    ++m_invalidations;
+    rebuild = true;
+  } else if (now - index->check_time.load() >= validation_period) {
+    // the notifications can miss some changes (e.g. on network filesystems): the
+    // modification time is still checked for the watched directories
+    std::int64_t modification_time;
+    const bool   exists = getModificationTime(directory, modification_time);
+    if (exists != index->exists or modification_time != index->modification_time) {
+      ++m_invalidations;
+      rebuild = true;
+    } else {
+      index->check_time = now;
+    }
+  }
+
+  if (rebuild) {
+    ++m_misses;
+    index = publish(directory, index, buildIndex(directory, watching));
+  } else {
+    ++m_hits;
+  }
+
+  return std::binary_search(index->entries.cbegin(), index->entries.cend(), entry);
+}
+
+Item LookupCache::getPathFromLocations(const Item& file_name, const vector<Item>& locations) {
+
+  const string leaf = file_name.filename().string();
+
+  // the names which cannot be looked up in the index of a single directory
+  if (file_name.empty() or file_name.has_root_directory() or leaf == "." or leaf == "..") {
+    return Path::getPathFromLocations(file_name, locations);
+  }
+
+  const string relative_path = file_name.string();
+  const Item   parent        = file_name.parent_path();
+  const auto   now           = Clock::now();
+
+  for (const auto& location : locations) {
+    // an empty or relative location depends on the current directory: it is not cached
+    if (location.is_relative()) {
+      if (boost::filesystem::exists(location / file_name)) {
+        return location / file_name;
+      }
+      continue;
+    }
+    // a path of an installed location is looked up in its index without listing
+    const auto index = Index::get(location);
+    if (index != nullptr) {
+      const auto lookup = index->find(relative_path);
+      if (lookup == Index::Lookup::found) {
+        return location / file_name;
+      }
+      if (lookup == Index::Lookup::missing) {
+        continue;
+      }
+    }
+    if (contains((location / parent).string(), leaf, now)) {
+      return location / file_name;
+    }
+  }
+
+  return Item{};
+}
+
+std::map<string, Item> LookupCache::getPathsFromLocations(const vector<string>& file_names,
+                                                         const vector<Item>& locations, bool parallel) {
+
+  if (parallel) {
+    buildIndexes(file_names, locations);
+  }
+
+  // each directory is listed once for all the file names, by the cache
+  std::map<string, Item> found_paths;
+  for (const auto& name : file_names) {
+    if (found_paths.count(name) == 0) {
+      found_paths[name] = getPathFromLocations(Item{name}, locations);
+    }
+  }
+
+  return found_paths;
+}
+
+void LookupCache::buildIndexes(const vector<string>& file_names, const vector<Item>& locations) {
+
+  std::set<string> parents;
+  for (const auto& name : file_names) {
+    const Item   file_name{name};
+    const string leaf = file_name.filename().string();
+    if (not(file_name.empty() or file_name.has_root_directory() or leaf == "." or leaf == "..")) {
+      parents.emplace(file_name.parent_path().string());
+    }
+  }
+
+  // the directories which would be listed by the lookups
+  vector<string> directories;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& location : locations) {
+      if (location.is_relative()) {
+        continue;
+      }
+      for (const auto& parent : parents) {
+        const string directory = (location / parent).string();
+        if (m_indexes.count(directory) == 0) {
+          directories.emplace_back(directory);
+        }
+      }
+    }
+  }
+
+  const std::size_t thread_number =
+      std::min<std::size_t>(std::max(1U, std::thread::hardware_concurrency()), directories.size());
+  if (thread_number < 2) {
+    return;
+  }
+
+  // the listings are done without the lock
+  vector<std::shared_ptr<DirectoryIndex>> indexes(directories.size());
+  std::atomic<std::size_t>                next_directory{0};
+  const bool                              watching = this->watching();
+  vector<std::thread>                     threads;
+  for (std::size_t t = 0; t < thread_number; ++t) {
+    threads.emplace_back([&]() {
+      for (std::size_t d = next_directory++; d < directories.size(); d = next_directory++) {
+        indexes[d] = buildIndex(directories[d], watching);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t d = 0; d < directories.size(); ++d) {
+    if (publish(directories[d], nullptr, indexes[d]) == indexes[d]) {
+      ++m_misses;
+    }
+  }
+}
+
+void LookupCache::setValidationPeriod(const std::chrono::milliseconds& period) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_validation_period = period;
+}
+
+std::chrono::milliseconds LookupCache::validationPeriod() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_validation_period;
+}
+
+void LookupCache::setWatching(bool watching) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_watching = watching and Watcher::instance().isAvailable();
+  // the existing indexes are rebuilt with the new mode
+  m_indexes.clear();
+}
+
+bool LookupCache::watching() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_watching;
+}
+
+void LookupCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_locations.clear();
+  m_indexes.clear();
+}
+
+LookupCache::Statistics LookupCache::statistics() const {
+  return Statistics{m_hits.load(), m_misses.load(), m_invalidations.load()};
+}
+
+void LookupCache::resetStatistics() {
+  m_hits          = 0;
+  m_misses        = 0;
+  m_invalidations = 0;
+}
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
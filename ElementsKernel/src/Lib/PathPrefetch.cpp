@@ -0,0 +1,176 @@
+/**
+ * @file PathPrefetch.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathPrefetch.h"
+
+#include <fcntl.h>     // for open, posix_fadvise, readahead
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close, read
+
+#include <algorithm>  // for min, max
+#include <atomic>     // for atomic
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <memory>     // for make_shared
+#include <thread>     // for thread, hardware_concurrency
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ElementsKernel/Path.h"  // for Item
+
+using std::vector;
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+struct Prefetch::State {
+
+  explicit State(const vector<Item>& file_list)
+      : files{file_list}, next{0}, remaining{file_list.size()}, bytes{0}, errors{0}, stop{false} {}
+
+  const vector<Item>         files;
+  std::atomic<std::size_t>   next;
+  std::atomic<std::size_t>   remaining;
+  std::atomic<std::uint64_t> bytes;
+  std::atomic<std::size_t>   errors;
+  std::atomic<bool>          stop;
+};
+
+namespace {
+
+/// size of the blocks read ahead between two checks of the stop request
+constexpr std::size_t PREFETCH_CHUNK_SIZE{8 * 1024 * 1024};
+
+/// @return false if the file cannot be opened
+bool prefetchFile(const Item& file, std::atomic<std::uint64_t>& bytes, const std::atomic<bool>& stop) {
+
+  const int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat status;
+  if (::fstat(fd, &status) != 0 or not S_ISREG(status.st_mode)) {
+    ::close(fd);
+    return false;
+  }
+
+  const auto size = static_cast<std::uint64_t>(status.st_size);
+
+#if defined(__linux__)
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+  for (std::uint64_t offset = 0; offset < size and not stop; offset += PREFETCH_CHUNK_SIZE) {
+    const auto length = std::min<std::uint64_t>(PREFETCH_CHUNK_SIZE, size - offset);
+    ::readahead(fd, static_cast<off64_t>(offset), static_cast<std::size_t>(length));
+    bytes += length;
+  }
+#else
+  vector<char> buffer(1024 * 1024);
+  for (std::uint64_t offset = 0; offset < size and not stop;) {
+    const auto length = ::read(fd, buffer.data(), buffer.size());
+    if (length <= 0) {
+      break;
+    }
+    offset += static_cast<std::uint64_t>(length);
+    bytes += static_cast<std::uint64_t>(length);
+  }
+#endif
+
+  ::close(fd);
+
+  return true;
+}
+
+}  // namespace
+
+Prefetch::Prefetch(const vector<Item>& files, std::size_t thread_number)
+    : m_state{std::make_shared<State>(files)} {
+
+  if (thread_number == 0) {
+    thread_number = std::max(1U, std::thread::hardware_concurrency());
+  }
+  thread_number = std::min(thread_number, files.size());
+
+  for (std::size_t t = 0; t < thread_number; ++t) {
+    // the state is shared: the threads don't depend on the address of this object
+    auto state = m_state;
+    m_threads.emplace_back([state]() {
+      for (auto i = state->next++; i < state->files.size(); i = state->next++) {
+        const auto& file = state->files[i];
+        if (not file.empty() and not state->stop and not prefetchFile(file, state->bytes, state->stop)) {
+          ++state->errors;
+        }
+        --state->remaining;
+      }
+    });
+  }
+}
+
+Prefetch& Prefetch::operator=(Prefetch&& other) {
+  if (this != &other) {
+    stop();
+    m_state   = std::move(other.m_state);
+    m_threads = std::move(other.m_threads);
+  }
+  return *this;
+}
+
+Prefetch::~Prefetch() {
+  stop();
+}
+
+void Prefetch::stop() {
+  if (m_state != nullptr) {
+    m_state->stop = true;
+  }
+  wait();
+}
+
+void Prefetch::wait() {
+  for (auto& t : m_threads) {
+    t.join();
+  }
+  m_threads.clear();
+}
+
+bool Prefetch::done() const {
+  return m_state == nullptr or m_state->remaining == 0;
+}
+
+const vector<Item>& Prefetch::files() const {
+  // a moved-from handle has no state
+  static const vector<Item> no_files;
+  return m_state == nullptr ? no_files : m_state->files;
+}
+
+std::uint64_t Prefetch::byteNumber() const {
+  return m_state == nullptr ? 0 : m_state->bytes.load();
+}
+
+std::size_t Prefetch::errorNumber() const {
+  return m_state == nullptr ? 0 : m_state->errors.load();
+}
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
@@ -0,0 +1,313 @@
+/**
+ * @file PathResolver.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathResolver.h"
+
+#include <sys/stat.h>  // for stat
+
+#include <algorithm>  // for stable_sort
+#include <chrono>     // for steady_clock, duration_cast
+#include <cstdint>    // for int64_t
+#include <fstream>    // for ofstream
+#include <iomanip>    // for setw, setprecision
+#include <iostream>   // for cerr
+#include <mutex>      // for lock_guard
+#include <string>     // for string
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Logging.h"    // for Logging
+#include "ElementsKernel/Path.h"       // for Item, splitPath
+#include "ElementsKernel/PathIndex.h"  // for Index
+#include "ElementsKernel/System.h"     // for getEnv
+
+#include "ModificationTime.h"  // for modificationTime
+
+using std::string;
+using std::vector;
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+const string RESOLUTION_STRATEGY_VARIABLE{"ELEMENTS_RESOLUTION_STRATEGY"};
+const string RESOLUTION_PRIORITIES_VARIABLE{"ELEMENTS_RESOLUTION_PRIORITIES"};
+const string RESOLUTION_STATISTICS_VARIABLE{"ELEMENTS_RESOLUTION_STATISTICS"};
+
+namespace {
+
+auto log = Logging::getLogger("PathResolver");
+
+const vector<std::pair<ResolutionStrategy, string>> STRATEGY_NAMES{{ResolutionStrategy::first_match, "first-match"},
+                                                                   {ResolutionStrategy::all_matches, "all-matches"},
+                                                                   {ResolutionStrategy::newest, "newest"},
+                                                                   {ResolutionStrategy::priority_list, "priority-list"}};
+
+/// @return true if the location is the prefix or lies below it
+bool isBelow(const string& location, const string& prefix) {
+  return location.compare(0, prefix.size(), prefix) == 0 and
+         (location.size() == prefix.size() or location[prefix.size()] == '/' or
+          (not prefix.empty() and prefix.back() == '/'));
+}
+
+/// @return the locations sorted by the priority list
+vector<Item> prioritize(const vector<Item>& locations, const vector<Item>& priorities) {
+
+  vector<std::pair<std::size_t, Item>> ranked_locations;
+  ranked_locations.reserve(locations.size());
+
+  for (const auto& l : locations) {
+    const string location = l.string();
+    std::size_t  rank     = 0;
+    while (rank < priorities.size() and not isBelow(location, priorities[rank].string())) {
+      ++rank;
+    }
+    ranked_locations.emplace_back(rank, l);
+  }
+
+  std::stable_sort(ranked_locations.begin(), ranked_locations.end(),
+                   [](const std::pair<std::size_t, Item>& first, const std::pair<std::size_t, Item>& second) {
+                     return first.first < second.first;
+                   });
+
+  vector<Item> sorted_locations;
+  sorted_locations.reserve(ranked_locations.size());
+  for (const auto& r : ranked_locations) {
+    sorted_locations.emplace_back(r.second);
+  }
+
+  return sorted_locations;
+}
+
+}  // namespace
+
+string toString(ResolutionStrategy strategy) {
+  for (const auto& s : STRATEGY_NAMES) {
+    if (s.first == strategy) {
+      return s.second;
+    }
+  }
+  return "unknown";
+}
+
+ResolutionStrategy toResolutionStrategy(const string& name) {
+  for (const auto& s : STRATEGY_NAMES) {
+    if (s.second == name) {
+      return s.first;
+    }
+  }
+  throw Exception() << "Unknown path resolution strategy: \"" << name << "\"";
+}
+
+Resolver::Resolver(ResolutionStrategy strategy)
+    : m_strategy{strategy}, m_totals{0, 0, 0, std::chrono::nanoseconds{0}} {}
+
+Resolver::~Resolver() {
+
+  if (m_statistics_file.empty() or m_totals.lookups == 0) {
+    return;
+  }
+
+  if (m_statistics_file == "-") {
+    dump(std::cerr);
+  } else {
+    std::ofstream output(m_statistics_file, std::ios::app);
+    dump(output);
+  }
+}
+
+Resolver& Resolver::instance() {
+
+  static Resolver resolver;
+  static std::once_flag configured;
+
+  std::call_once(configured, []() {
+    string value;
+    if (System::getEnv(RESOLUTION_STRATEGY_VARIABLE, value) and not value.empty()) {
+      try {
+        resolver.setStrategy(toResolutionStrategy(value));
+      } catch (const Exception& e) {
+        log.warn() << e.what();
+      }
+    }
+    if (System::getEnv(RESOLUTION_PRIORITIES_VARIABLE, value) and not value.empty()) {
+      resolver.setPriorities(splitPath(value));
+    }
+    System::getEnv(RESOLUTION_STATISTICS_VARIABLE, resolver.m_statistics_file);
+  });
+
+  return resolver;
+}
+
+void Resolver::setStrategy(ResolutionStrategy strategy) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_strategy = strategy;
+}
+
+ResolutionStrategy Resolver::strategy() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_strategy;
+}
+
+void Resolver::setPriorities(const vector<Item>& priorities) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_priorities = priorities;
+}
+
+vector<Item> Resolver::priorities() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_priorities;
+}
+
+vector<Item> Resolver::resolve(const Item& file_name, const vector<Item>& locations) {
+
+  const auto start = std::chrono::steady_clock::now();
+
+  ResolutionStrategy strategy;
+  vector<Item>       priorities;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    strategy   = m_strategy;
+    priorities = m_priorities;
+  }
+
+  ResolutionRecord record{file_name.string(), strategy, 0, 0, 0, std::chrono::nanoseconds{0}};
+
+  // same check as existsInLocation: a path known to the index of the location is not looked up on the filesystem
+  auto probe = [&record, &file_name](const Item& location) {
+    ++record.probed_locations;
+    const auto index = Index::get(location, record.system_calls);
+    if (index != nullptr) {
+      const auto lookup = index->find(file_name.string());
+      if (lookup != Index::Lookup::unknown) {
+        return lookup == Index::Lookup::found;
+      }
+    }
+    ++record.system_calls;
+    struct stat status;
+    return ::stat((location / file_name).c_str(), &status) == 0;
+  };
+
+  // the index doesn't hold the modification times
+  auto probeStatus = [&record, &file_name](const Item& location, struct stat& status) {
+    ++record.probed_locations;
+    ++record.system_calls;
+    return ::stat((location / file_name).c_str(), &status) == 0;
+  };
+
+  vector<Item> matches;
+
+  switch (strategy) {
+  case ResolutionStrategy::first_match:
+  case ResolutionStrategy::priority_list: {
+    const auto sorted_locations =
+        (strategy == ResolutionStrategy::priority_list) ? prioritize(locations, priorities) : locations;
+    for (const auto& l : sorted_locations) {
+      if (probe(l)) {
+        matches.emplace_back(l / file_name);
+        break;
+      }
+    }
+    break;
+  }
+  case ResolutionStrategy::all_matches:
+    for (const auto& l : locations) {
+      if (probe(l)) {
+        matches.emplace_back(l / file_name);
+      }
+    }
+    break;
+  case ResolutionStrategy::newest: {
+    std::int64_t newest_time = 0;
+    struct stat  status;
+    for (const auto& l : locations) {
+      // the first of the matches with the same time is kept
+      if (probeStatus(l, status) and (matches.empty() or modificationTime(status) > newest_time)) {
+        matches.assign(1, l / file_name);
+        newest_time = modificationTime(status);
+      }
+    }
+    break;
+  }
+  }
+
+  record.match_number = matches.size();
+  record.duration     = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_totals.lookups;
+  m_totals.probed_locations += record.probed_locations;
+  m_totals.system_calls += record.system_calls;
+  m_totals.duration += record.duration;
+  if (m_records.size() == MAX_RESOLUTION_RECORD_NUMBER) {
+    m_records.pop_front();
+  }
+  m_records.push_back(std::move(record));
+
+  return matches;
+}
+
+Item Resolver::resolvePath(const Item& file_name, const vector<Item>& locations) {
+  const auto matches = resolve(file_name, locations);
+  return matches.empty() ? Item{} : matches.front();
+}
+
+Resolver::Totals Resolver::totals() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_totals;
+}
+
+vector<ResolutionRecord> Resolver::records() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return vector<ResolutionRecord>(m_records.cbegin(), m_records.cend());
+}
+
+void Resolver::resetStatistics() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_totals = Totals{0, 0, 0, std::chrono::nanoseconds{0}};
+  m_records.clear();
+}
+
+void Resolver::dump(std::ostream& out) const {
+
+  const auto totals          = this->totals();
+  const auto current_records = records();
+
+  out << "# Path resolution statistics (strategy: " << toString(strategy()) << ")" << std::endl;
+  out << std::fixed << std::setprecision(2) << "# lookups: " << totals.lookups
+      << ", probed locations: " << totals.probed_locations << ", system calls: " << totals.system_calls
+      << ", time: " << static_cast<double>(totals.duration.count()) / 1.0e3 << " us" << std::endl;
+  out << "# " << std::setw(13) << "strategy" << std::setw(8) << "probed" << std::setw(8) << "calls" << std::setw(8)
+      << "matches" << std::setw(12) << "time (us)"
+      << "  file" << std::endl;
+
+  for (const auto& r : current_records) {
+    out << "  " << std::setw(13) << toString(r.strategy) << std::setw(8) << r.probed_locations << std::setw(8)
+        << r.system_calls << std::setw(8) << r.match_number << std::setw(12)
+        << static_cast<double>(r.duration.count()) / 1.0e3 << "  " << r.file_name << std::endl;
+  }
+}
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
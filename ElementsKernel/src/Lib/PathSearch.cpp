@@ -21,9 +21,24 @@
 
 #include "ElementsKernel/PathSearch.h"  // for SearchType, etc
 
-#include <ostream>  // for operator<<, basic_ostream, etc
-#include <string>   // for string, char_traits
-#include <vector>   // for vector
+#include <dirent.h>    // for opendir, readdir, closedir
+#include <fnmatch.h>   // for fnmatch
+#include <sys/stat.h>  // for stat, lstat
+
+#include <algorithm>           // for sort, min, max
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <deque>               // for deque
+#include <memory>              // for unique_ptr
+#include <mutex>               // for mutex, lock_guard
+#include <ostream>             // for operator<<, basic_ostream, etc
+#include <regex>               // for regex, regex_match
+#include <set>                 // for set
+#include <string>              // for string, char_traits
+#include <thread>              // for thread
+#include <utility>             // for pair
+#include <vector>              // for vector
 
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem/operations.hpp>
@@ -43,9 +58,297 @@ namespace Elements {
 inline namespace Kernel {
 
 namespace {
+
 auto log = Logging::getLogger("PathSearch");
+
+/**
+ * Work-stealing walker of directory trees. Each thread owns a queue of
+ * directories: it takes the most recent one from its own queue
+ * (depth-first, good locality) and, when empty, the oldest one from the
+ * queue of another thread (the largest remaining sub-trees). The idle
+ * threads wait for new tasks or for the end of the walk.
+ */
+class TreeWalker {
+
+public:
+  TreeWalker(const string& pattern, const PathSearchOptions& options);
+
+  vector<Path::Item> run(const vector<Path::Item>& directories);
+
+private:
+  struct Task {
+    string      path;
+    std::size_t depth;
+    std::size_t root;
+  };
+
+  struct Queue {
+    std::mutex       mutex;
+    std::deque<Task> tasks;
+  };
+
+  bool matches(const char* name) const;
+  bool isNewDirectory(const string& path);
+  void push(std::size_t worker, Task task);
+  bool pop(std::size_t worker, Task& task);
+  void notifyIdle(bool all);
+  void work(std::size_t worker);
+  void process(std::size_t worker, const Task& task);
+
+  string                                 m_pattern;
+  PathSearchOptions                      m_options;
+  std::regex                             m_regex;
+  vector<std::unique_ptr<Queue>>         m_queues;
+  std::atomic<std::size_t>               m_pending;
+  std::atomic<std::size_t>               m_queued;
+  std::atomic<bool>                      m_stop;
+  std::mutex                             m_idle_mutex;
+  std::condition_variable                m_idle_condition;
+  std::mutex                             m_result_mutex;
+  vector<std::pair<std::size_t, string>> m_results;
+  std::mutex                             m_visited_mutex;
+  std::set<std::pair<dev_t, ino_t>>      m_visited;
+};
+
+TreeWalker::TreeWalker(const string& pattern, const PathSearchOptions& options)
+    : m_pattern{pattern}, m_options{options}, m_pending{0}, m_queued{0}, m_stop{false} {
+  if (m_options.match_type == MatchType::Regex) {
+    try {
+      m_regex = std::regex(m_pattern);
+    } catch (const std::regex_error& e) {
+      throw Exception() << "Invalid regular expression \"" << m_pattern << "\": " << e.what();
+    }
+  }
+}
+
+bool TreeWalker::matches(const char* name) const {
+
+  bool match = false;
+
+  switch (m_options.match_type) {
+  case MatchType::Exact:
+    match = (m_pattern == name);
+    break;
+  case MatchType::Glob:
+    match = (::fnmatch(m_pattern.c_str(), name, 0) == 0);
+    break;
+  case MatchType::Regex:
+    match = std::regex_match(name, m_regex);
+    break;
+  }
+
+  return match;
+}
+
+bool TreeWalker::isNewDirectory(const string& path) {
+
+  struct stat status;
+  if (::stat(path.c_str(), &status) != 0) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_visited_mutex);
+  return m_visited.emplace(status.st_dev, status.st_ino).second;
+}
+
+void TreeWalker::push(std::size_t worker, Task task) {
+  ++m_pending;
+  {
+    std::lock_guard<std::mutex> lock(m_queues[worker]->mutex);
+    // counted before the task can be popped by a thief: the counter never goes below 0
+    ++m_queued;
+    m_queues[worker]->tasks.emplace_back(std::move(task));
+  }
+  notifyIdle(false);
+}
+
+void TreeWalker::notifyIdle(bool all) {
+  // the waiting threads check their condition under the lock: no notification is lost
+  { std::lock_guard<std::mutex> lock(m_idle_mutex); }
+  if (all) {
+    m_idle_condition.notify_all();
+  } else {
+    m_idle_condition.notify_one();
+  }
+}
+
+bool TreeWalker::pop(std::size_t worker, Task& task) {
+
+  {
+    auto&                       own = *m_queues[worker];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (not own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      --m_queued;
+      return true;
+    }
+  }
+
+  for (std::size_t offset = 1; offset < m_queues.size(); ++offset) {
+    auto&                       victim = *m_queues[(worker + offset) % m_queues.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (not victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      --m_queued;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void TreeWalker::process(std::size_t worker, const Task& task) {
+
+  DIR* directory = ::opendir(task.path.c_str());
+  if (directory == nullptr) {
+    return;
+  }
+
+  while (not m_stop) {
+
+    const struct dirent* entry = ::readdir(directory);
+    if (entry == nullptr) {
+      break;
+    }
+
+    const string name{entry->d_name};
+    if (name == "." or name == "..") {
+      continue;
+    }
+
+    const string full_path = (task.path.back() == '/') ? task.path + name : task.path + '/' + name;
+
+    if (matches(entry->d_name)) {
+      std::lock_guard<std::mutex> lock(m_result_mutex);
+      // another thread may have found its match since the loop condition was checked
+      if (m_options.first_match_only and m_stop) {
+        break;
+      }
+      m_results.emplace_back(task.root, full_path);
+      if (m_options.first_match_only) {
+        m_stop = true;
+        notifyIdle(true);
+        break;
+      }
+    }
+
+    if (task.depth >= m_options.max_depth) {
+      continue;
+    }
+
+    // the type is given by readdir on most filesystems: no stat needed
+    bool        is_directory = (entry->d_type == DT_DIR);
+    struct stat status {};
+    if (entry->d_type == DT_UNKNOWN and ::lstat(full_path.c_str(), &status) == 0) {
+      is_directory = S_ISDIR(status.st_mode);
+    }
+    const bool is_link = (entry->d_type == DT_LNK) or (entry->d_type == DT_UNKNOWN and S_ISLNK(status.st_mode));
+    if (is_link and m_options.follow_symlinks and ::stat(full_path.c_str(), &status) == 0) {
+      is_directory = S_ISDIR(status.st_mode);
+    }
+
+    if (is_directory and (not m_options.follow_symlinks or isNewDirectory(full_path))) {
+      push(worker, Task{full_path, task.depth + 1, task.root});
+    }
+  }
+
+  ::closedir(directory);
+}
+
+void TreeWalker::work(std::size_t worker) {
+
+  Task task;
+
+  while (not m_stop) {
+    if (pop(worker, task)) {
+      process(worker, task);
+      if (--m_pending == 0) {
+        notifyIdle(true);
+      }
+    } else {
+      std::unique_lock<std::mutex> lock(m_idle_mutex);
+      m_idle_condition.wait(lock, [this]() {
+        return m_stop or m_pending == 0 or m_queued > 0;
+      });
+      if (m_pending == 0) {
+        break;
+      }
+    }
+  }
+}
+
+vector<Path::Item> TreeWalker::run(const vector<Path::Item>& directories) {
+
+  std::size_t thread_number = m_options.thread_number;
+  if (thread_number == 0) {
+    thread_number = std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  for (std::size_t t = 0; t < thread_number; ++t) {
+    m_queues.emplace_back(new Queue);
+  }
+
+  for (std::size_t root = 0; root < directories.size(); ++root) {
+    const string path = directories[root].string();
+    if (boost::filesystem::is_directory(directories[root]) and
+        (not m_options.follow_symlinks or isNewDirectory(path))) {
+      push(root % thread_number, Task{path, 0, root});
+    }
+  }
+
+  vector<std::thread> threads;
+  for (std::size_t t = 1; t < thread_number; ++t) {
+    threads.emplace_back(&TreeWalker::work, this, t);
+  }
+  work(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::sort(m_results.begin(), m_results.end());
+
+  vector<Path::Item> results;
+  results.reserve(m_results.size());
+  for (const auto& result : m_results) {
+    results.emplace_back(result.second);
+  }
+
+  return results;
+}
+
+/// split a path-like variable, keeping only the existing directories
+vector<Path::Item> getSearchDirectories(const string& path_like_env_variable) {
+
+  // get the multiple path from the environment variable
+  string multiple_path{};
+
+  Environment current_env;
+
+  if (current_env.hasKey(path_like_env_variable)) {
+    multiple_path = current_env[path_like_env_variable];
+  } else {
+    log.warn() << "Environment variable \"" << path_like_env_variable << "\" is not defined !";
+  }
+
+  // Tokenize the path elements
+  vector<string> path_elements;
+  boost::split(path_elements, multiple_path, boost::is_any_of(";:"));
+
+  vector<Path::Item> directories;
+  for (const string& path_element : path_elements) {
+    // Check if directory exists
+    if (boost::filesystem::exists(path_element) && boost::filesystem::is_directory(path_element)) {
+      directories.emplace_back(path_element);
+    }
+  }
+
+  return directories;
 }
 
+}  // namespace
+
 // template instantiations
 
 template vector<string>     pathSearch<string, directory_iterator>(const string& searched_name, string directory);
@@ -70,32 +373,30 @@ vector<Path::Item> pathSearchInEnvVariable(const string& file_name, const string
   // Placeholder for the to-be-returned search result
   vector<Path::Item> search_results{};
 
-  // get the multiple path from the environment variable
-  string multiple_path{};
-
-  Environment current_env;
-
-  if (current_env.hasKey(path_like_env_variable)) {
-    multiple_path = current_env[path_like_env_variable];
-  } else {
-    log.warn() << "Environment variable \"" << path_like_env_variable << "\" is not defined !";
-  }
-
-  // Tokenize the path elements
-  vector<string> path_elements;
-  boost::split(path_elements, multiple_path, boost::is_any_of(";:"));
-
   // Loop over all path elements
-  for (string path_element : path_elements) {
-    // Check if directory exists
-    if (boost::filesystem::exists(path_element) && boost::filesystem::is_directory(path_element)) {
-      // loop recursively inside directory
-      auto single_path_results = pathSearch(file_name, Path::Item{path_element}, search_type);
-      search_results.insert(search_results.end(), single_path_results.cbegin(), single_path_results.cend());
-    }
+  for (const auto& directory : getSearchDirectories(path_like_env_variable)) {
+    // loop recursively inside directory
+    auto single_path_results = pathSearch(file_name, directory, search_type);
+    search_results.insert(search_results.end(), single_path_results.cbegin(), single_path_results.cend());
   }
   return search_results;
 }
 
+vector<Path::Item> parallelPathSearch(const string& pattern, const vector<Path::Item>& directories,
+                                      const PathSearchOptions& options) {
+  TreeWalker walker{pattern, options};
+  return walker.run(directories);
+}
+
+vector<Path::Item> parallelPathSearch(const string& pattern, const Path::Item& directory,
+                                      const PathSearchOptions& options) {
+  return parallelPathSearch(pattern, vector<Path::Item>{directory}, options);
+}
+
+vector<Path::Item> pathSearchInEnvVariable(const string& pattern, const string& path_like_env_variable,
+                                           const PathSearchOptions& options) {
+  return parallelPathSearch(pattern, getSearchDirectories(path_like_env_variable), options);
+}
+
 }  // namespace Kernel
 }  // namespace Elements
@@ -0,0 +1,241 @@
+/**
+ * @file PathWatcher.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathWatcher.h"
+
+#if defined(__linux__)
+#include <fcntl.h>        // for O_CLOEXEC, O_NONBLOCK
+#include <poll.h>         // for poll, pollfd
+#include <sys/inotify.h>  // for inotify_init1, inotify_add_watch, inotify_rm_watch
+#include <unistd.h>       // for pipe2, read, write, close
+#endif
+
+#include <algorithm>  // for remove_if
+#include <cerrno>     // for errno, EINTR
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <mutex>      // for lock_guard
+#include <thread>     // for thread
+#include <vector>     // for vector
+
+#include "ElementsKernel/Path.h"  // for Item
+
+using std::vector;
+
+namespace Elements {
+inline namespace Kernel {
+namespace Path {
+
+namespace {
+
+#if defined(__linux__)
+/// the changes of the entries of the directory and of the directory itself
+constexpr std::uint32_t WATCH_MASK = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF |
+                                     IN_MOVE_SELF | IN_ONLYDIR;
+#endif
+
+/// watch identifier used for the notification of all the subscribers
+constexpr int ALL_WATCHES = -1;
+
+}  // namespace
+
+Watcher::Watcher() : m_inotify_fd{-1}, m_stop_fd{-1, -1}, m_last_subscription{0} {
+#if defined(__linux__)
+  m_inotify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (m_inotify_fd >= 0 and ::pipe2(m_stop_fd, O_CLOEXEC) != 0) {
+    ::close(m_inotify_fd);
+    m_inotify_fd = -1;
+  }
+#endif
+}
+
+Watcher::~Watcher() {
+#if defined(__linux__)
+  if (m_thread.joinable()) {
+    const char stop = 0;
+    while (::write(m_stop_fd[1], &stop, 1) < 0 and errno == EINTR) {
+    }
+    m_thread.join();
+  }
+  if (m_inotify_fd >= 0) {
+    ::close(m_inotify_fd);
+    ::close(m_stop_fd[0]);
+    ::close(m_stop_fd[1]);
+  }
+#endif
+}
+
+Watcher& Watcher::instance() {
+  static Watcher watcher;
+  return watcher;
+}
+
+bool Watcher::isAvailable() const {
+  return m_inotify_fd >= 0;
+}
+
+Watcher::Subscription Watcher::subscribe(const Item& directory, const Callback& callback) {
+
+  Subscription subscription = 0;
+
+#if defined(__linux__)
+  if (m_inotify_fd < 0) {
+    return subscription;
+  }
+
+  // the watch is added with the lock held: a concurrent unsubscribe could remove it otherwise
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const int watch = ::inotify_add_watch(m_inotify_fd, directory.c_str(), WATCH_MASK);
+  if (watch < 0) {
+    return subscription;
+  }
+
+  if (not m_thread.joinable()) {
+    m_thread = std::thread(&Watcher::run, this);
+  }
+
+  subscription = ++m_last_subscription;
+  m_subscribers[watch].push_back(Subscriber{subscription, directory, callback});
+  m_watches[subscription] = watch;
+#else
+  static_cast<void>(directory);
+  static_cast<void>(callback);
+#endif
+
+  return subscription;
+}
+
+void Watcher::unsubscribe(Subscription subscription) {
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto found = m_watches.find(subscription);
+  if (found == m_watches.end()) {
+    return;
+  }
+
+  const int watch = found->second;
+  m_watches.erase(found);
+
+  auto& subscribers = m_subscribers[watch];
+  subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                   [subscription](const Subscriber& s) {
+                                     return s.id == subscription;
+                                   }),
+                    subscribers.end());
+
+  if (subscribers.empty()) {
+    m_subscribers.erase(watch);
+#if defined(__linux__)
+    ::inotify_rm_watch(m_inotify_fd, watch);
+#endif
+  }
+}
+
+std::size_t Watcher::watchedDirectoryNumber() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_subscribers.size();
+}
+
+void Watcher::run() {
+#if defined(__linux__)
+
+  alignas(struct inotify_event) char buffer[4096];
+
+  struct pollfd fds[2];
+  fds[0] = {m_inotify_fd, POLLIN, 0};
+  fds[1] = {m_stop_fd[0], POLLIN, 0};
+
+  while (true) {
+
+    if (::poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+
+    if (fds[1].revents != 0) {
+      break;
+    }
+
+    const auto length = ::read(m_inotify_fd, buffer, sizeof(buffer));
+    if (length <= 0) {
+      continue;
+    }
+
+    const char* position = buffer;
+    while (position < buffer + length) {
+      const auto* event = reinterpret_cast<const struct inotify_event*>(position);
+      if ((event->mask & IN_Q_OVERFLOW) != 0) {
+        // some events are lost: everything may have changed
+        notify(ALL_WATCHES, false);
+      } else {
+        notify(event->wd, (event->mask & (IN_IGNORED | IN_MOVE_SELF)) != 0);
+      }
+      position += sizeof(struct inotify_event) + event->len;
+    }
+  }
+
+#endif
+}
+
+void Watcher::notify(int watch, bool dropped) {
+
+  vector<Subscriber> subscribers;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (watch == ALL_WATCHES) {
+      for (const auto& w : m_subscribers) {
+        subscribers.insert(subscribers.end(), w.second.cbegin(), w.second.cend());
+      }
+    } else {
+      auto found = m_subscribers.find(watch);
+      if (found == m_subscribers.end()) {
+        return;
+      }
+      subscribers = found->second;
+      if (dropped) {
+        // the directory is gone or has moved: the watch is meaningless
+        for (const auto& s : subscribers) {
+          m_watches.erase(s.id);
+        }
+        m_subscribers.erase(found);
+#if defined(__linux__)
+        ::inotify_rm_watch(m_inotify_fd, watch);
+#endif
+      }
+    }
+  }
+
+  // the callbacks may subscribe or unsubscribe: they are called without the lock
+  for (const auto& s : subscribers) {
+    s.callback(s.directory);
+  }
+}
+
+}  // namespace Path
+}  // namespace Kernel
+}  // namespace Elements
@@ -0,0 +1,278 @@
+/**
+ * @file PluginRegistry.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PluginRegistry.h"
+
+#include <dlfcn.h>  // for dlopen, dlsym, dlclose, dlerror
+
+#include <algorithm>      // for min
+#include <atomic>         // for atomic
+#include <cstddef>        // for size_t
+#include <iostream>       // for cerr, endl
+#include <memory>         // for shared_ptr, weak_ptr, make_shared
+#include <mutex>          // for mutex, lock_guard
+#include <string>         // for string
+#include <thread>         // for thread
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Hardware.h"   // for recommendedThreadNumber
+#include "ElementsKernel/Logging.h"    // for Logging
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+namespace System {
+
+namespace {
+
+auto log = Logging::getLogger("PluginRegistry");
+
+/// the file name given to dlopen, with the same rules as loadDynamicLib
+string pluginFileName(const string& name) {
+
+  if (name.find('/') != string::npos or name.find(SHLIB_SUFFIX) != string::npos) {
+    return name;
+  }
+
+  string file_name;
+  if (getEnv(name, file_name) and not file_name.empty()) {
+    if (file_name.find(SHLIB_SUFFIX) == string::npos) {
+      file_name += SHLIB_SUFFIX;
+    }
+    return file_name;
+  }
+
+  return "lib" + name + SHLIB_SUFFIX;
+}
+
+const string& emptyString() {
+  static const string empty;
+  return empty;
+}
+
+}  // namespace
+
+struct Plugin::Library {
+
+  Library(const string& library_name, const string& library_file_name, PluginBinding library_binding,
+          ImageHandle library_handle)
+      : name{library_name}, file_name{library_file_name}, binding{library_binding}, handle{library_handle} {}
+
+  ~Library() {
+    if (::dlclose(handle) != 0) {
+      const char* error = ::dlerror();
+      // the last plugins can be released during the static destruction, after the logger
+      std::cerr << "PluginRegistry: Cannot unload the plugin " << name << ": "
+                << (error != nullptr ? error : "unknown error") << std::endl;
+    }
+  }
+
+  Library(const Library&) = delete;
+  Library& operator=(const Library&) = delete;
+
+  const string        name;
+  const string        file_name;
+  const PluginBinding binding;
+  const ImageHandle   handle;
+
+  std::mutex                        mutex;
+  std::unordered_map<string, void*> symbols;
+};
+
+Plugin::Plugin(std::shared_ptr<Library> library) : m_library{std::move(library)} {}
+
+Plugin::operator bool() const {
+  return m_library != nullptr;
+}
+
+const string& Plugin::name() const {
+  return m_library != nullptr ? m_library->name : emptyString();
+}
+
+const string& Plugin::fileName() const {
+  return m_library != nullptr ? m_library->file_name : emptyString();
+}
+
+PluginBinding Plugin::binding() const {
+  return m_library != nullptr ? m_library->binding : PluginBinding::Lazy;
+}
+
+ImageHandle Plugin::handle() const {
+  return m_library != nullptr ? m_library->handle : nullptr;
+}
+
+void* Plugin::address(const string& symbol) const {
+
+  if (m_library == nullptr) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(m_library->mutex);
+
+  const auto found = m_library->symbols.find(symbol);
+  if (found != m_library->symbols.end()) {
+    return found->second;
+  }
+
+  // the missing symbols are cached as well
+  void* symbol_address = ::dlsym(m_library->handle, symbol.c_str());
+  m_library->symbols.emplace(symbol, symbol_address);
+
+  return symbol_address;
+}
+
+size_t Plugin::cachedSymbolNumber() const {
+
+  if (m_library == nullptr) {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(m_library->mutex);
+  return m_library->symbols.size();
+}
+
+struct PluginRegistry::Implementation {
+  mutable std::mutex                                         mutex;
+  std::unordered_map<string, std::weak_ptr<Plugin::Library>> libraries;
+};
+
+PluginRegistry::PluginRegistry() : m_implementation{new Implementation} {}
+
+PluginRegistry::~PluginRegistry() = default;
+
+PluginRegistry& PluginRegistry::instance() {
+  // never destroyed: the plugins can be released during the static destruction
+  static PluginRegistry* registry = new PluginRegistry;
+  return *registry;
+}
+
+Plugin PluginRegistry::load(const string& name, PluginBinding binding) {
+
+  auto& implementation = *m_implementation;
+
+  {
+    std::lock_guard<std::mutex> lock(implementation.mutex);
+    const auto                  found = implementation.libraries.find(name);
+    if (found != implementation.libraries.end()) {
+      if (auto library = found->second.lock()) {
+        return Plugin(library);
+      }
+    }
+  }
+
+  // the library is loaded without the lock, so that several plugins can be loaded concurrently
+  const string file_name = pluginFileName(name);
+  const int    mode      = (binding == PluginBinding::Now ? RTLD_NOW : RTLD_LAZY) | RTLD_LOCAL;
+
+  ImageHandle handle = ::dlopen(file_name.c_str(), mode);
+  if (handle == nullptr) {
+    const char* error = ::dlerror();
+    throw Exception() << "Cannot load the plugin " << name << ": " << (error != nullptr ? error : file_name);
+  }
+  auto library = std::make_shared<Plugin::Library>(name, file_name, binding, handle);
+
+  std::lock_guard<std::mutex> lock(implementation.mutex);
+
+  // another thread may have loaded the same plugin meanwhile. The extra reference of the loader is released with
+  // the local library
+  auto& entry = implementation.libraries[name];
+  if (auto loaded = entry.lock()) {
+    return Plugin(loaded);
+  }
+  entry = library;
+  log.debug() << "Loaded the plugin " << name << " from " << file_name;
+
+  return Plugin(library);
+}
+
+vector<Plugin> PluginRegistry::preload(const vector<string>& names, PluginBinding binding, size_t thread_number) {
+
+  vector<Plugin> plugins(names.size());
+  vector<string> errors(names.size());
+
+  if (thread_number == 0) {
+    thread_number = recommendedThreadNumber();
+  }
+  thread_number = std::min(thread_number, names.size());
+
+  // the plugins are taken one by one by the threads
+  std::atomic<size_t> next{0};
+  auto                work = [&]() {
+    for (size_t i = next++; i < names.size(); i = next++) {
+      try {
+        plugins[i] = load(names[i], binding);
+      } catch (const Exception& e) {
+        errors[i] = e.what();
+      }
+    }
+  };
+
+  vector<std::thread> threads;
+  for (size_t t = 1; t < thread_number; ++t) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  string message;
+  for (const auto& e : errors) {
+    if (not e.empty()) {
+      message += (message.empty() ? "" : "; ") + e;
+    }
+  }
+  if (not message.empty()) {
+    throw Exception() << message;
+  }
+
+  return plugins;
+}
+
+bool PluginRegistry::isLoaded(const string& name) const {
+
+  std::lock_guard<std::mutex> lock(m_implementation->mutex);
+
+  const auto found = m_implementation->libraries.find(name);
+  return found != m_implementation->libraries.end() and not found->second.expired();
+}
+
+size_t PluginRegistry::size() const {
+
+  std::lock_guard<std::mutex> lock(m_implementation->mutex);
+
+  size_t count = 0;
+  for (const auto& l : m_implementation->libraries) {
+    if (not l.second.expired()) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+}  // namespace System
+}  // namespace Elements
@@ -0,0 +1,384 @@
+/**
+ * @file Process.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/Process.h"
+
+#include <fcntl.h>     // for O_CLOEXEC, O_WRONLY, fcntl
+#include <poll.h>      // for poll, pollfd
+#include <spawn.h>     // for posix_spawn, posix_spawnp
+#include <sys/wait.h>  // for waitpid, WNOHANG
+#include <unistd.h>    // for pipe, read, close, environ
+
+#include <algorithm>  // for min
+#include <cerrno>     // for errno, EINTR
+#include <chrono>     // for steady_clock, milliseconds
+#include <csignal>    // for kill, SIGKILL, SIGPIPE, sigset_t
+#include <cstring>    // for strerror
+#include <string>     // for string
+#include <thread>     // for sleep_for
+#include <vector>     // for vector
+
+#include "ElementsKernel/Environment.h"  // for Environment::Block
+#include "ElementsKernel/Exception.h"    // for Exception
+
+using std::string;
+using std::vector;
+
+namespace Elements {
+namespace System {
+
+namespace {
+
+constexpr std::size_t READ_BUFFER_SIZE{65536};
+
+void closeDescriptor(int& descriptor) {
+  if (descriptor >= 0) {
+    ::close(descriptor);
+    descriptor = -1;
+  }
+}
+
+/// pipe whose ends are not inherited by the children
+void makePipe(int descriptors[2]) {
+#if defined(__linux__)
+  if (::pipe2(descriptors, O_CLOEXEC) != 0) {
+    throw Exception() << "Cannot create a pipe: " << std::strerror(errno);
+  }
+#else
+  if (::pipe(descriptors) != 0) {
+    throw Exception() << "Cannot create a pipe: " << std::strerror(errno);
+  }
+  ::fcntl(descriptors[0], F_SETFD, FD_CLOEXEC);
+  ::fcntl(descriptors[1], F_SETFD, FD_CLOEXEC);
+#endif
+}
+
+/// spawn file actions and attributes, released at the end of the scope
+struct SpawnSetup {
+
+  SpawnSetup() {
+    ::posix_spawn_file_actions_init(&actions);
+    ::posix_spawnattr_init(&attributes);
+  }
+
+  ~SpawnSetup() {
+    ::posix_spawn_file_actions_destroy(&actions);
+    ::posix_spawnattr_destroy(&attributes);
+  }
+
+  SpawnSetup(const SpawnSetup&) = delete;
+  SpawnSetup& operator=(const SpawnSetup&) = delete;
+
+  void redirect(Redirection redirection, int target, int pipe_descriptors[2]) {
+    switch (redirection) {
+    case Redirection::inherit:
+      break;
+    case Redirection::pipe:
+      makePipe(pipe_descriptors);
+      // the duplicated descriptor doesn't keep the close-on-exec flag
+      ::posix_spawn_file_actions_adddup2(&actions, pipe_descriptors[1], target);
+      break;
+    case Redirection::null:
+      ::posix_spawn_file_actions_addopen(&actions, target, "/dev/null", O_WRONLY, 0);
+      break;
+    }
+  }
+
+  posix_spawn_file_actions_t actions;
+  posix_spawnattr_t          attributes;
+};
+
+}  // namespace
+
+Process::Process(pid_t pid, int output_descriptor, int error_descriptor)
+    : m_pid{pid}
+    , m_output_descriptor{output_descriptor}
+    , m_error_descriptor{error_descriptor}
+    , m_finished{false}
+    , m_exit_code{-1} {}
+
+Process::Process(Process&& other)
+    : m_pid{other.m_pid}
+    , m_output_descriptor{other.m_output_descriptor}
+    , m_error_descriptor{other.m_error_descriptor}
+    , m_finished{other.m_finished}
+    , m_exit_code{other.m_exit_code} {
+  other.m_pid               = -1;
+  other.m_output_descriptor = -1;
+  other.m_error_descriptor  = -1;
+  other.m_finished          = true;
+}
+
+Process& Process::operator=(Process&& other) {
+  if (this != &other) {
+    closeDescriptors();
+    if (not m_finished) {
+      wait();
+    }
+    m_pid                     = other.m_pid;
+    m_output_descriptor       = other.m_output_descriptor;
+    m_error_descriptor        = other.m_error_descriptor;
+    m_finished                = other.m_finished;
+    m_exit_code               = other.m_exit_code;
+    other.m_pid               = -1;
+    other.m_output_descriptor = -1;
+    other.m_error_descriptor  = -1;
+    other.m_finished          = true;
+  }
+  return *this;
+}
+
+Process::~Process() {
+  closeDescriptors();
+  if (not m_finished) {
+    wait();
+  }
+}
+
+Process Process::spawn(const vector<string>& arguments, const SpawnOptions& options) {
+
+  if (arguments.empty()) {
+    throw Exception() << "Cannot spawn a process without command";
+  }
+
+  vector<char*> argv;
+  argv.reserve(arguments.size() + 1);
+  for (const auto& a : arguments) {
+    argv.emplace_back(const_cast<char*>(a.c_str()));
+  }
+  argv.emplace_back(nullptr);
+
+  // like a plain posix_spawn, the child inherits the current process environment, including the raw changes
+  char* const* const envp = (options.environment != nullptr) ? options.environment->envp() : environ;
+
+  SpawnSetup setup;
+  int        output_pipe[2] = {-1, -1};
+  int        error_pipe[2]  = {-1, -1};
+
+  try {
+    setup.redirect(options.standard_output, STDOUT_FILENO, output_pipe);
+    setup.redirect(options.standard_error, STDERR_FILENO, error_pipe);
+  } catch (const Exception&) {
+    closeDescriptor(output_pipe[0]);
+    closeDescriptor(output_pipe[1]);
+    throw;
+  }
+
+  // the child starts with no blocked signal and the default SIGPIPE handling, even if the parent ignores it
+  sigset_t signals;
+  sigemptyset(&signals);
+  ::posix_spawnattr_setsigmask(&setup.attributes, &signals);
+  sigaddset(&signals, SIGPIPE);
+  ::posix_spawnattr_setsigdefault(&setup.attributes, &signals);
+  short flags = POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF;
+#if defined(POSIX_SPAWN_USEVFORK)
+  flags |= POSIX_SPAWN_USEVFORK;
+#endif
+  ::posix_spawnattr_setflags(&setup.attributes, flags);
+
+  pid_t     pid   = -1;
+  const int error = options.search_path
+                        ? ::posix_spawnp(&pid, argv[0], &setup.actions, &setup.attributes, argv.data(), envp)
+                        : ::posix_spawn(&pid, argv[0], &setup.actions, &setup.attributes, argv.data(), envp);
+
+  closeDescriptor(output_pipe[1]);
+  closeDescriptor(error_pipe[1]);
+
+  if (error != 0) {
+    closeDescriptor(output_pipe[0]);
+    closeDescriptor(error_pipe[0]);
+    throw Exception() << "Cannot spawn " << arguments[0] << ": " << std::strerror(error);
+  }
+
+  return Process(pid, output_pipe[0], error_pipe[0]);
+}
+
+ProcessResult Process::run(const vector<string>& arguments, std::chrono::milliseconds timeout,
+                           const Environment::Block* environment) {
+
+  SpawnOptions options;
+  options.standard_output = Redirection::pipe;
+  options.standard_error  = Redirection::pipe;
+  options.environment     = environment;
+
+  return spawn(arguments, options).communicate(timeout);
+}
+
+pid_t Process::pid() const {
+  return m_pid;
+}
+
+int Process::outputDescriptor() const {
+  return m_output_descriptor;
+}
+
+int Process::errorDescriptor() const {
+  return m_error_descriptor;
+}
+
+bool Process::tryWait() {
+
+  if (m_finished) {
+    return true;
+  }
+
+  int   status = 0;
+  pid_t result;
+  do {
+    result = ::waitpid(m_pid, &status, WNOHANG);
+  } while (result == -1 and errno == EINTR);
+
+  if (result == 0) {
+    return false;
+  }
+
+  m_finished = true;
+  if (result == m_pid) {
+    if (WIFEXITED(status)) {
+      m_exit_code = WEXITSTATUS(status);
+    } else if (WIFSIGNALED(status)) {
+      m_exit_code = 128 + WTERMSIG(status);
+    }
+  }
+
+  return true;
+}
+
+bool Process::waitFor(std::chrono::milliseconds timeout) {
+
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  // most of the short commands are over within the first sleeps
+  std::chrono::microseconds delay{50};
+  while (not tryWait()) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(delay, deadline - now));
+    delay = std::min(delay * 2, std::chrono::microseconds{5000});
+  }
+
+  return true;
+}
+
+int Process::wait() {
+
+  if (not m_finished) {
+    int   status = 0;
+    pid_t result;
+    do {
+      result = ::waitpid(m_pid, &status, 0);
+    } while (result == -1 and errno == EINTR);
+
+    m_finished = true;
+    if (result == m_pid) {
+      if (WIFEXITED(status)) {
+        m_exit_code = WEXITSTATUS(status);
+      } else if (WIFSIGNALED(status)) {
+        m_exit_code = 128 + WTERMSIG(status);
+      }
+    }
+  }
+
+  return m_exit_code;
+}
+
+bool Process::finished() const {
+  return m_finished;
+}
+
+int Process::exitCode() const {
+  return m_exit_code;
+}
+
+void Process::kill(int signal_number) {
+  if (not m_finished and m_pid > 0) {
+    ::kill(m_pid, signal_number);
+  }
+}
+
+ProcessResult Process::communicate(std::chrono::milliseconds timeout) {
+
+  ProcessResult result{-1, "", "", false};
+
+  const bool has_deadline = timeout.count() > 0;
+  const auto deadline     = std::chrono::steady_clock::now() + timeout;
+
+  auto remaining = [has_deadline, &deadline]() {
+    const auto left =
+        std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+    return has_deadline ? static_cast<int>(std::max<decltype(left)>(left, 0)) : -1;
+  };
+
+  vector<char> buffer(READ_BUFFER_SIZE);
+
+  while (m_output_descriptor >= 0 or m_error_descriptor >= 0) {
+
+    pollfd descriptors[2] = {{m_output_descriptor, POLLIN, 0}, {m_error_descriptor, POLLIN, 0}};
+
+    // the negative descriptors are ignored by poll
+    const int ready = ::poll(descriptors, 2, remaining());
+    if (ready == -1 and errno == EINTR) {
+      continue;
+    }
+    if (ready <= 0) {
+      result.timed_out = (ready == 0);
+      break;
+    }
+
+    int*         process_descriptors[2] = {&m_output_descriptor, &m_error_descriptor};
+    std::string* texts[2]               = {&result.output, &result.error};
+    for (std::size_t i = 0; i < 2; ++i) {
+      if (descriptors[i].revents == 0) {
+        continue;
+      }
+      const ssize_t count = ::read(*process_descriptors[i], buffer.data(), buffer.size());
+      if (count > 0) {
+        texts[i]->append(buffer.data(), static_cast<std::size_t>(count));
+      } else if (count == 0 or errno != EINTR) {
+        closeDescriptor(*process_descriptors[i]);
+      }
+    }
+  }
+
+  if (not result.timed_out and has_deadline) {
+    result.timed_out = not waitFor(std::chrono::milliseconds{std::max(remaining(), 0)});
+  }
+
+  if (result.timed_out) {
+    kill(SIGKILL);
+    closeDescriptors();
+  }
+
+  result.exit_code = wait();
+
+  return result;
+}
+
+void Process::closeDescriptors() {
+  closeDescriptor(m_output_descriptor);
+  closeDescriptor(m_error_descriptor);
+}
+
+}  // namespace System
+}  // namespace Elements
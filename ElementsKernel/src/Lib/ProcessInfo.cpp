@@ -0,0 +1,428 @@
+/**
+ * @file ProcessInfo.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/ProcessInfo.h"
+
+#include <fcntl.h>         // for open, O_RDONLY, O_CLOEXEC, O_DIRECTORY
+#include <sys/resource.h>  // for getrlimit, rlimit, RLIMIT_*
+#include <sys/syscall.h>   // for SYS_getdents64
+#include <unistd.h>        // for read, close, sysconf, getpid, syscall
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t, int64_t
+#include <cstdio>   // for snprintf
+#include <cstdlib>  // for strtoull, strtoll
+#include <cstring>  // for strlen, strchr, strrchr, strncmp, memchr
+
+#include "ElementsKernel/Exception.h"  // for Exception
+
+using std::int64_t;
+using std::size_t;
+using std::uint64_t;
+
+namespace Elements {
+namespace System {
+
+namespace {
+
+/// large enough for /proc/self/status, which is the largest of the files
+constexpr size_t BUFFER_SIZE{4096};
+
+/**
+ * @brief
+ *   read a small file at once
+ * @return the number of characters, the buffer being terminated by a null character. -1 on failure
+ */
+ssize_t readFile(const char* file_name, char* buffer, size_t size) {
+
+  const int descriptor = ::open(file_name, O_RDONLY | O_CLOEXEC);
+  if (descriptor < 0) {
+    return -1;
+  }
+
+  size_t  length = 0;
+  ssize_t count  = 0;
+  while (length + 1 < size and (count = ::read(descriptor, buffer + length, size - 1 - length)) > 0) {
+    length += static_cast<size_t>(count);
+  }
+  ::close(descriptor);
+
+  if (count < 0) {
+    return -1;
+  }
+  buffer[length] = '\0';
+
+  return static_cast<ssize_t>(length);
+}
+
+/// value of a "Key: value" line, like "VmRSS:     1234 kB". The key must be at the beginning of a line
+bool findValue(const char* buffer, const char* key, uint64_t& value) {
+
+  const size_t key_length = std::strlen(key);
+
+  for (const char* line = buffer; line != nullptr and *line != '\0';) {
+    if (std::strncmp(line, key, key_length) == 0 and line[key_length] == ':') {
+      value = std::strtoull(line + key_length + 1, nullptr, 10);
+      return true;
+    }
+    line = std::strchr(line, '\n');
+    if (line != nullptr) {
+      ++line;
+    }
+  }
+
+  return false;
+}
+
+/// the status file gives the sizes in kB
+uint64_t findSize(const char* buffer, const char* key) {
+  uint64_t value = 0;
+  return findValue(buffer, key, value) ? value << 10 : 0;
+}
+
+/// number of the fields of /proc/self/stat which are parsed
+constexpr size_t STAT_FIELD_NUMBER{24};
+
+/**
+ * @brief
+ *   the numeric fields of /proc/self/stat
+ * @details
+ *   The second field is the command name between parentheses, which may
+ *   contain spaces: the fields are counted from the last parenthesis.
+ *   field[i] is the field i + 1 of proc(5), e.g. field[13] is utime.
+ */
+bool readStat(int64_t (&field)[STAT_FIELD_NUMBER]) {
+
+  char buffer[1024];
+  if (readFile("/proc/self/stat", buffer, sizeof(buffer)) <= 0) {
+    return false;
+  }
+
+  const char* current = std::strrchr(buffer, ')');
+  if (current == nullptr) {
+    return false;
+  }
+  // skips the state, the third field
+  current += 2;
+  while (*current != '\0' and *current != ' ') {
+    ++current;
+  }
+
+  for (size_t i = 0; i < STAT_FIELD_NUMBER; ++i) {
+    field[i] = 0;
+  }
+  for (size_t i = 3; i < STAT_FIELD_NUMBER; ++i) {
+    char* end;
+    field[i] = std::strtoll(current, &end, 10);
+    if (end == current) {
+      return false;
+    }
+    current = end;
+  }
+
+  return true;
+}
+
+double ticksToSeconds(int64_t ticks) {
+  static const long ticks_per_second = ::sysconf(_SC_CLK_TCK);
+  return static_cast<double>(ticks) / static_cast<double>(ticks_per_second > 0 ? ticks_per_second : 100);
+}
+
+bool readMemory(MemoryUsage& memory) {
+
+  char buffer[BUFFER_SIZE];
+  if (readFile("/proc/self/status", buffer, sizeof(buffer)) <= 0) {
+    return false;
+  }
+
+  memory.virtual_size       = findSize(buffer, "VmSize");
+  memory.peak_virtual_size  = findSize(buffer, "VmPeak");
+  memory.resident_size      = findSize(buffer, "VmRSS");
+  memory.peak_resident_size = findSize(buffer, "VmHWM");
+  memory.data_size          = findSize(buffer, "VmData");
+  memory.stack_size         = findSize(buffer, "VmStk");
+  memory.swap_size          = findSize(buffer, "VmSwap");
+
+  return true;
+}
+
+bool readIo(IoCounters& io) {
+
+  char buffer[1024];
+  if (readFile("/proc/self/io", buffer, sizeof(buffer)) <= 0) {
+    return false;
+  }
+
+  return findValue(buffer, "rchar", io.read_characters) and findValue(buffer, "wchar", io.written_characters) and
+         findValue(buffer, "syscr", io.read_calls) and findValue(buffer, "syscw", io.write_calls) and
+         findValue(buffer, "read_bytes", io.read_bytes) and findValue(buffer, "write_bytes", io.written_bytes) and
+         findValue(buffer, "cancelled_write_bytes", io.cancelled_written_bytes);
+}
+
+bool readTimes(CpuTimes& times) {
+
+  int64_t field[STAT_FIELD_NUMBER];
+  if (not readStat(field)) {
+    return false;
+  }
+
+  times.minor_page_faults = static_cast<uint64_t>(field[9]);
+  times.major_page_faults = static_cast<uint64_t>(field[11]);
+  times.user_time         = ticksToSeconds(field[13]);
+  times.system_time       = ticksToSeconds(field[14]);
+
+  return true;
+}
+
+/// the entries of /proc/self/fd, listed with getdents64 into a buffer on the stack
+int64_t countOpenFileDescriptors() {
+
+  const int descriptor = ::open("/proc/self/fd", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (descriptor < 0) {
+    return -1;
+  }
+
+  struct LinuxDirent64 {
+    uint64_t       d_ino;
+    int64_t        d_off;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[1];
+  };
+
+  alignas(LinuxDirent64) char buffer[BUFFER_SIZE];
+  int64_t                     count = 0;
+  for (long size = ::syscall(SYS_getdents64, descriptor, buffer, sizeof(buffer)); size > 0;
+       size      = ::syscall(SYS_getdents64, descriptor, buffer, sizeof(buffer))) {
+    for (long offset = 0; offset < size;) {
+      const auto entry = reinterpret_cast<const LinuxDirent64*>(buffer + offset);
+      if (entry->d_name[0] != '.') {
+        ++count;
+      }
+      offset += entry->d_reclen;
+    }
+  }
+  ::close(descriptor);
+
+  // the descriptor of the listing itself
+  return count - 1;
+}
+
+bool readBasics(ProcessBasics& basics) {
+
+  int64_t field[STAT_FIELD_NUMBER];
+  if (not readStat(field)) {
+    return false;
+  }
+  const int64_t descriptor_number = countOpenFileDescriptors();
+  if (descriptor_number < 0) {
+    return false;
+  }
+
+  basics.process_id                  = ::getpid();
+  basics.parent_process_id           = field[3];
+  basics.priority                    = field[17];
+  basics.nice                        = field[18];
+  basics.thread_number               = static_cast<uint64_t>(field[19]);
+  basics.open_file_descriptor_number = static_cast<uint64_t>(descriptor_number);
+
+  return true;
+}
+
+uint64_t softLimit(int resource) {
+  struct rlimit limit;
+  if (::getrlimit(resource, &limit) != 0 or limit.rlim_cur == RLIM_INFINITY) {
+    return UNLIMITED;
+  }
+  return static_cast<uint64_t>(limit.rlim_cur);
+}
+
+/**
+ * @brief
+ *   read a memory limit of a control group
+ * @return false if the file cannot be read. The limit is UNLIMITED for "max" or for the huge v1 default
+ */
+bool readMemoryLimit(const char* file_name, uint64_t& limit) {
+
+  char buffer[64];
+  if (readFile(file_name, buffer, sizeof(buffer)) <= 0) {
+    return false;
+  }
+
+  char*          end;
+  const uint64_t value = std::strtoull(buffer, &end, 10);
+  limit                = (end != buffer and value < (UINT64_C(1) << 62)) ? value : UNLIMITED;
+
+  return true;
+}
+
+/**
+ * @brief
+ *   find the control group of the process in the content of /proc/self/cgroup
+ * @details
+ *   the lines are "hierarchy-id:controllers:path". The v2 hierarchy has the "0::path" line and the v1 memory hierarchy
+ *   has "memory" in its comma separated controllers
+ * @return false if there is no such line. The path is not null terminated
+ */
+bool findControlGroup(const char* content, bool unified, const char*& path, size_t& length) {
+
+  for (const char* line = content; *line != '\0';) {
+    const char* line_end = std::strchr(line, '\n');
+    if (line_end == nullptr) {
+      line_end = line + std::strlen(line);
+    }
+    const char* first  = static_cast<const char*>(std::memchr(line, ':', static_cast<size_t>(line_end - line)));
+    const char* second = nullptr;
+    if (first != nullptr) {
+      second = static_cast<const char*>(std::memchr(first + 1, ':', static_cast<size_t>(line_end - first - 1)));
+    }
+    if (second != nullptr) {
+      bool found = false;
+      if (unified) {
+        found = first - line == 1 and *line == '0' and second == first + 1;
+      } else {
+        for (const char* controller = first + 1; controller < second and not found;) {
+          const char* controller_end = static_cast<const char*>(
+              std::memchr(controller, ',', static_cast<size_t>(second - controller)));
+          if (controller_end == nullptr) {
+            controller_end = second;
+          }
+          found      = controller_end - controller == 6 and std::strncmp(controller, "memory", 6) == 0;
+          controller = controller_end + 1;
+        }
+      }
+      if (found) {
+        path   = second + 1;
+        length = static_cast<size_t>(line_end - path);
+        return true;
+      }
+    }
+    line = *line_end == '\n' ? line_end + 1 : line_end;
+  }
+
+  return false;
+}
+
+/**
+ * @brief
+ *   memory limit of the control group of the process, for the v2 or the v1 hierarchy
+ * @details
+ *   the group is resolved from /proc/self/cgroup. The root files are used when the group of the process is not
+ *   visible, e.g. in a container without a control group namespace
+ */
+uint64_t controlGroupMemoryLimit() {
+
+  uint64_t limit = UNLIMITED;
+
+  char content[BUFFER_SIZE];
+  if (readFile("/proc/self/cgroup", content, sizeof(content)) > 0) {
+    char        file_name[BUFFER_SIZE + 64];
+    const char* path;
+    size_t      length;
+    if (findControlGroup(content, true, path, length) and
+        std::snprintf(file_name, sizeof(file_name), "/sys/fs/cgroup%.*s/memory.max", static_cast<int>(length), path) >
+            0 and
+        readMemoryLimit(file_name, limit)) {
+      return limit;
+    }
+    if (findControlGroup(content, false, path, length) and
+        std::snprintf(file_name, sizeof(file_name), "/sys/fs/cgroup/memory%.*s/memory.limit_in_bytes",
+                      static_cast<int>(length), path) > 0 and
+        readMemoryLimit(file_name, limit)) {
+      return limit;
+    }
+  }
+
+  if (readMemoryLimit("/sys/fs/cgroup/memory.max", limit) or
+      readMemoryLimit("/sys/fs/cgroup/memory/memory.limit_in_bytes", limit)) {
+    return limit;
+  }
+
+  return UNLIMITED;
+}
+
+bool readQuota(ResourceQuota& quota) {
+
+  quota.address_space          = softLimit(RLIMIT_AS);
+  quota.data_size              = softLimit(RLIMIT_DATA);
+  quota.stack_size             = softLimit(RLIMIT_STACK);
+  quota.file_descriptor_number = softLimit(RLIMIT_NOFILE);
+  quota.cpu_time               = softLimit(RLIMIT_CPU);
+  quota.control_group_memory   = controlGroupMemoryLimit();
+
+  return true;
+}
+
+bool readRemainingTime(RemainingTime& remain_time) {
+
+  const uint64_t limit = softLimit(RLIMIT_CPU);
+  if (limit == UNLIMITED) {
+    remain_time.cpu_time = -1.0;
+    return true;
+  }
+
+  CpuTimes times;
+  if (not readTimes(times)) {
+    return false;
+  }
+  const double remaining = static_cast<double>(limit) - times.user_time - times.system_time;
+  remain_time.cpu_time   = remaining > 0.0 ? remaining : 0.0;
+
+  return true;
+}
+
+}  // namespace
+
+bool processInfo(InfoType type, ProcessInfo& info) noexcept {
+
+  switch (type) {
+  case InfoType::NoFetch:
+    return true;
+  case InfoType::Memory:
+    return readMemory(info.memory);
+  case InfoType::IO:
+    return readIo(info.io);
+  case InfoType::Times:
+    return readTimes(info.times);
+  case InfoType::ProcessBasics:
+    return readBasics(info.basics);
+  case InfoType::Quota:
+    return readQuota(info.quota);
+  case InfoType::RemainTime:
+    return readRemainingTime(info.remain_time);
+  default:
+    return false;
+  }
+}
+
+ProcessInfo processInfo(InfoType type) {
+
+  ProcessInfo info{};
+  if (not processInfo(type, info)) {
+    throw Exception() << "The process information of type " << static_cast<int>(type) << " is not available";
+  }
+
+  return info;
+}
+
+}  // namespace System
+}  // namespace Elements
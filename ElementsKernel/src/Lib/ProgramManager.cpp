@@ -36,16 +36,18 @@
 #include <boost/filesystem/operations.hpp>       // for filesystem::complete, exists
 #include <boost/program_options.hpp>             // for program_options
 
-#include "ElementsKernel/Configuration.h"  // for getConfigurationPath
-#include "ElementsKernel/Path.h"           // for Path::VARIABLE, multiPathAppend, PATH_SEP
-#include "ElementsKernel/Program.h"        // for Program
-                                           // for Path::Item
-#include "ElementsKernel/Exception.h"      // for Exception
-#include "ElementsKernel/Exit.h"           // for ExitCode
-#include "ElementsKernel/Logging.h"        // for Logging
-#include "ElementsKernel/ModuleInfo.h"     // for getExecutablePath
-#include "ElementsKernel/System.h"         // for backTrace
-#include "ElementsKernel/Unused.h"         // for ELEMENTS_UNUSED
+#include "ElementsKernel/Configuration.h"             // for getConfigurationLocations
+#include "ElementsKernel/Path.h"                      // for Path::VARIABLE, multiPathRange, PATH_SEP
+#include "ElementsKernel/Program.h"                   // for Program
+                                                      // for Path::Item
+#include "ElementsKernel/Exception.h"                 // for Exception
+#include "ElementsKernel/Exit.h"                      // for ExitCode
+#include "ElementsKernel/FloatingPointEnvironment.h"  // for FloatingPointEnvironment
+#include "ElementsKernel/Logging.h"                   // for Logging
+#include "ElementsKernel/ModuleInfo.h"                // for getExecutablePath
+#include "ElementsKernel/PathResolver.h"              // for Path::Resolver
+#include "ElementsKernel/System.h"                    // for backTrace
+#include "ElementsKernel/Unused.h"                    // for ELEMENTS_UNUSED
 
 #include "OptionException.h"  // local exception for unrecognized options
 
@@ -89,8 +91,9 @@ const Path::Item& ProgramManager::getProgramName() const {
 
 /**
  * @brief Get default config file
- * @todo check whether priotities are correct if more than one
- * config file is found in pathSearchInEnvVariable
+ * @details the candidates are selected by the Path::Resolver strategy
+ *   (see ELEMENTS_RESOLUTION_STRATEGY). If more than one is found,
+ *   the first one is used.
  * */
 const Path::Item ProgramManager::getDefaultConfigFile(const Path::Item& program_name, const string& module_name) {
   Path::Item default_config_file{};
@@ -99,17 +102,29 @@ const Path::Item ProgramManager::getDefaultConfigFile(const Path::Item& program_
   Path::Item conf_name(program_name);
   conf_name.replace_extension("conf");
 
+  const auto locations = getConfigurationLocations();
+  auto&      resolver  = Path::Resolver::instance();
+
+  auto resolve = [&resolver, &locations](const Path::Item& file_name) {
+    const auto candidates = resolver.resolve(file_name, locations);
+    if (candidates.size() > 1) {
+      log.warn() << candidates.size() << " " << file_name << " configuration files found. Using "
+                 << candidates.front();
+    }
+    return candidates.empty() ? Path::Item{} : candidates.front();
+  };
+
   // Construct and return the full path
-  default_config_file = getConfigurationPath(conf_name.string(), false);
+  default_config_file = resolve(conf_name);
   if (default_config_file.empty()) {
     log.warn() << "The " << conf_name << " default configuration file cannot be found in:";
-    for (auto loc : getConfigurationLocations()) {
+    for (const auto& loc : locations) {
       log.warn() << " " << loc;
     }
     if (not module_name.empty()) {
       conf_name = Path::Item{module_name} / conf_name;
       log.warn() << "Trying " << conf_name << ".";
-      default_config_file = getConfigurationPath(conf_name.string(), false);
+      default_config_file = resolve(conf_name);
     }
   }
 
@@ -189,7 +204,10 @@ const VariablesMap ProgramManager::getProgramOptions(int argc, char* argv[]) {
   OptionsDescription cmd_and_file_generic_options{};
   cmd_and_file_generic_options.add_options()("log-level", value<string>()->default_value(default_log_level),
                                              "Log level: FATAL, ERROR, WARN, INFO (default), DEBUG")(
-      "log-file", value<Path::Item>(), "Name of a log file");
+      "log-file", value<Path::Item>(), "Name of a log file")(
+      "fp-mode", value<string>(),
+      "Floating point mode, comma separated: ftz, daz, denormals (ftz and daz), "
+      "invalid, divbyzero, overflow, underflow, inexact, traps (invalid, divbyzero and overflow)");
 
   // Group all the generic options, for help output. Note that we add the
   // options one by one to avoid having empty lines between the groups
@@ -404,13 +422,13 @@ void ProgramManager::bootstrapEnvironment(char* arg0) {
   }
 
   using Path::joinPath;
-  using Path::multiPathAppend;
+  using Path::multiPathRange;
 
   for (const auto& v : Path::VARIABLE) {
     if (m_env[v.second].exists()) {
-      m_env[v.second] += Path::PATH_SEP + joinPath(multiPathAppend(local_search_paths, Path::SUFFIXES.at(v.first)));
+      m_env[v.second] += Path::PATH_SEP + joinPath(multiPathRange(local_search_paths, Path::SUFFIXES.at(v.first)));
     } else {
-      m_env[v.second] = joinPath(multiPathAppend(local_search_paths, Path::SUFFIXES.at(v.first)));
+      m_env[v.second] = joinPath(multiPathRange(local_search_paths, Path::SUFFIXES.at(v.first)));
     }
   }
 }
@@ -448,6 +466,11 @@ void ProgramManager::setup(int argc, char* argv[]) {
   // setup the logging
   Logging::setLevel(logging_level);
 
+  // setup the floating point environment. The threads started by the program inherit it.
+  if (m_variables_map.count("fp-mode")) {
+    FloatingPointEnvironment::fromString(m_variables_map["fp-mode"].as<string>()).apply();
+  }
+
   logHeader(m_program_name.string());
   // log all program options
   logAllOptions();
@@ -458,6 +481,10 @@ void ProgramManager::tearDown(const ExitCode& c) {
 
   log.debug() << "# Exit Code: " << int(c);
 
+  const auto totals = Path::Resolver::instance().totals();
+  log.debug() << "# Path resolutions: " << totals.lookups << " (" << totals.probed_locations << " probed locations, "
+              << totals.system_calls << " system calls)";
+
   logFooter(m_program_name.string());
 }
 
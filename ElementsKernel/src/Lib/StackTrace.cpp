@@ -0,0 +1,358 @@
+/**
+ * @file StackTrace.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/StackTrace.h"
+
+#include <cxxabi.h>    // for __cxa_demangle
+#include <dlfcn.h>     // for dladdr, Dl_info
+#include <execinfo.h>  // for backtrace
+#include <unistd.h>    // for write
+
+#if defined(__linux__)
+#include <elf.h>   // for ET_DYN
+#include <link.h>  // for ElfW
+#endif
+
+#include <algorithm>      // for min
+#include <atomic>         // for atomic
+#include <chrono>         // for seconds
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uintptr_t
+#include <cstdlib>        // for free, strtoul
+#include <cstring>        // for memmove
+#include <map>            // for map
+#include <memory>         // for unique_ptr
+#include <mutex>          // for mutex, lock_guard
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Process.h"    // for Process
+
+#include "LoaderState.h"  // for LoaderState, currentLoaderState
+
+using std::size_t;
+using std::string;
+using std::uintptr_t;
+using std::vector;
+
+namespace Elements {
+namespace System {
+
+namespace {
+
+/// the first call of backtrace loads libgcc, which is not async-signal-safe: it is done at load time
+bool loadUnwinder() {
+  void* addresses[1];
+  return ::backtrace(addresses, 1) >= 0;
+}
+
+const bool unwinder_loaded = loadUnwinder();
+
+struct CachedFrame {
+  StackFrame frame;
+  bool       has_lines;
+};
+
+struct SymbolCache {
+  std::mutex                             mutex;
+  std::unordered_map<void*, CachedFrame> frames;
+#ifndef __APPLE__
+  LoaderState state{0, 0};
+#endif
+};
+
+/// the addresses of an unloaded library can be reused by another one. The cache lock must be held
+void checkLoaderState(SymbolCache& cache) {
+#ifndef __APPLE__
+  const LoaderState state = currentLoaderState();
+  if (not(state == cache.state)) {
+    cache.frames.clear();
+    cache.state = state;
+  }
+#else
+  static_cast<void>(cache);
+#endif
+}
+
+/// never destroyed: the traces can be symbolized during the static destruction
+SymbolCache& symbolCache() {
+  static SymbolCache* cache = new SymbolCache;
+  return *cache;
+}
+
+/// set when addr2line cannot be run, to avoid trying again
+std::atomic<bool> addr2line_missing{false};
+
+/// hexadecimal digits of the value, without leading zeros, in a buffer of at least 17 characters
+size_t formatHexadecimal(uintptr_t value, char* buffer) {
+  char   digits[2 * sizeof(uintptr_t)];
+  size_t count = 0;
+  do {
+    digits[count++] = "0123456789abcdef"[value & 0xF];
+    value >>= 4;
+  } while (value != 0);
+  for (size_t i = 0; i < count; ++i) {
+    buffer[i] = digits[count - 1 - i];
+  }
+  return count;
+}
+
+/// same output as the stream operator: 0x7f... or 0 for the null pointer
+string formatPointer(const void* pointer) {
+  if (pointer == nullptr) {
+    return "0";
+  }
+  char buffer[2 * sizeof(uintptr_t)];
+  return "0x" + string(buffer, formatHexadecimal(reinterpret_cast<uintptr_t>(pointer), buffer));
+}
+
+/**
+ * @brief
+ *   resolve the function and the library of an address
+ * @param offset
+ *   receives the address to look up in the DWARF information of the library
+ */
+StackFrame resolveSymbol(void* address, uintptr_t& offset) {
+
+  StackFrame frame{address, nullptr, "", "", "", 0};
+  offset = 0;
+
+  Dl_info info;
+  if (::dladdr(address, &info) == 0 or info.dli_fname == nullptr or info.dli_fname[0] == '\0') {
+    return frame;
+  }
+
+  frame.library        = info.dli_fname;
+  frame.symbol_address = info.dli_saddr;
+
+  if (info.dli_sname != nullptr and info.dli_sname[0] != '\0') {
+    int                                    status;
+    std::unique_ptr<char, decltype(free)*> demangled(abi::__cxa_demangle(info.dli_sname, 0, 0, &status), free);
+    frame.function = (status == 0) ? demangled.get() : info.dli_sname;
+  } else {
+    frame.function = "local";
+  }
+
+  // the program counter is the return address: the call is just before
+  offset = reinterpret_cast<uintptr_t>(address) - 1;
+#if defined(__linux__)
+  // the position independent objects are looked up relative to their load address
+  const auto header = static_cast<const ElfW(Ehdr)*>(info.dli_fbase);
+  if (header != nullptr and header->e_type == ET_DYN) {
+    offset -= reinterpret_cast<uintptr_t>(info.dli_fbase);
+  }
+#endif
+
+  return frame;
+}
+
+/**
+ * @brief
+ *   fill the source file and line of the frames of a library with a single addr2line run
+ * @details
+ *   The names of the functions which are not exported are taken from
+ *   the DWARF information as well.
+ */
+void lookupLines(const string& library, const vector<uintptr_t>& offsets, const vector<StackFrame*>& frames) {
+
+#if defined(__linux__)
+  if (addr2line_missing) {
+    return;
+  }
+
+  vector<string> arguments{"addr2line", "-f", "-C", "-e", library};
+  for (const auto o : offsets) {
+    char buffer[2 * sizeof(uintptr_t)];
+    arguments.emplace_back("0x" + string(buffer, formatHexadecimal(o, buffer)));
+  }
+
+  ProcessResult result;
+  try {
+    result = Process::run(arguments, std::chrono::seconds{30});
+  } catch (const Exception&) {
+    addr2line_missing = true;
+    return;
+  }
+
+  if (result.exit_code != 0) {
+    return;
+  }
+
+  // two lines per address: the function and "file:line" or "file:line (discriminator n)". The unknown ones are
+  // "??" and "??:0" or "??:?"
+  size_t start = 0;
+  for (auto frame : frames) {
+    const auto function_end = result.output.find('\n', start);
+    if (function_end == string::npos) {
+      break;
+    }
+    const auto end = result.output.find('\n', function_end + 1);
+    if (end == string::npos) {
+      break;
+    }
+    const string function = result.output.substr(start, function_end - start);
+    string       location = result.output.substr(function_end + 1, end - function_end - 1);
+    start                 = end + 1;
+
+    if (frame->function == "local" and function != "??") {
+      frame->function = function;
+    }
+
+    const auto discriminator = location.find(" (");
+    if (discriminator != string::npos) {
+      location.resize(discriminator);
+    }
+    const auto separator = location.rfind(':');
+    if (separator == string::npos or location.compare(0, separator, "??") == 0) {
+      continue;
+    }
+    frame->file = location.substr(0, separator);
+    frame->line = static_cast<unsigned>(std::strtoul(location.c_str() + separator + 1, nullptr, 10));
+  }
+#else
+  static_cast<void>(library);
+  static_cast<void>(offsets);
+  static_cast<void>(frames);
+#endif
+}
+
+}  // namespace
+
+StackTrace::StackTrace() noexcept : m_addresses{}, m_size{0} {}
+
+__attribute__((noinline)) void StackTrace::capture(size_t skip, size_t depth) noexcept {
+
+  // the frame of this function is dropped as well
+  const size_t dropped = skip + 1;
+  const size_t wanted  = std::min(MAX_STACK_DEPTH, dropped + std::min(depth, MAX_STACK_DEPTH));
+  const int    count   = ::backtrace(m_addresses, static_cast<int>(wanted));
+  const size_t size    = count > 0 ? static_cast<size_t>(count) : 0;
+
+  if (size <= dropped) {
+    m_size = 0;
+  } else {
+    m_size = std::min(size - dropped, depth);
+    std::memmove(m_addresses, m_addresses + dropped, m_size * sizeof(void*));
+  }
+}
+
+size_t StackTrace::size() const noexcept {
+  return m_size;
+}
+
+void* StackTrace::operator[](size_t level) const noexcept {
+  return level < m_size ? m_addresses[level] : nullptr;
+}
+
+void StackTrace::write(int file_descriptor) const noexcept {
+
+  char buffer[2 * sizeof(uintptr_t) + 3] = {'0', 'x'};
+
+  for (size_t i = 0; i < m_size; ++i) {
+    size_t length    = 2 + formatHexadecimal(reinterpret_cast<uintptr_t>(m_addresses[i]), buffer + 2);
+    buffer[length++] = '\n';
+    if (::write(file_descriptor, buffer, length) < 0) {
+      return;
+    }
+  }
+}
+
+vector<StackFrame> StackTrace::symbolize(bool with_lines) const {
+
+  vector<StackFrame> frames(m_size);
+  vector<size_t>     missing;
+
+  auto& cache = symbolCache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    checkLoaderState(cache);
+    for (size_t i = 0; i < m_size; ++i) {
+      const auto found = cache.frames.find(m_addresses[i]);
+      if (found != cache.frames.end() and (found->second.has_lines or not with_lines)) {
+        frames[i] = found->second.frame;
+      } else {
+        missing.emplace_back(i);
+      }
+    }
+  }
+
+  if (missing.empty()) {
+    return frames;
+  }
+
+  // the resolution is done without the lock
+  std::map<string, std::pair<vector<uintptr_t>, vector<StackFrame*>>> libraries;
+  for (const auto i : missing) {
+    uintptr_t offset;
+    frames[i] = resolveSymbol(m_addresses[i], offset);
+    if (with_lines and not frames[i].library.empty()) {
+      auto& library = libraries[frames[i].library];
+      library.first.emplace_back(offset);
+      library.second.emplace_back(&frames[i]);
+    }
+  }
+
+  for (const auto& l : libraries) {
+    lookupLines(l.first, l.second.first, l.second.second);
+  }
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  // the frames resolved before a change of the loader are not kept
+  checkLoaderState(cache);
+  for (const auto i : missing) {
+    cache.frames[m_addresses[i]] = CachedFrame{frames[i], with_lines};
+  }
+
+  return frames;
+}
+
+size_t StackTrace::symbolCacheSize() {
+  auto&                       cache = symbolCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.frames.size();
+}
+
+void StackTrace::clearSymbolCache() {
+  auto&                       cache = symbolCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.frames.clear();
+}
+
+string formatStackFrame(size_t level, const StackFrame& frame) {
+
+  string text = "#" + std::to_string(level);
+  if (text.size() < 4) {
+    text.resize(4, ' ');
+  }
+
+  text += formatPointer(frame.symbol_address) + " " + frame.function + "  [" + frame.library + "]";
+  if (not frame.file.empty()) {
+    text += " " + frame.file + ":" + std::to_string(frame.line);
+  }
+
+  return text;
+}
+
+}  // namespace System
+}  // namespace Elements
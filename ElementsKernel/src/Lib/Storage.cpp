@@ -20,44 +20,26 @@
 
 #include "ElementsKernel/Storage.h"
 
-#include <cmath>    // for pow, round, log10
-#include <cstddef>  // for size_t
-#include <cstdint>  // for int64_t
-#include <map>      // for map
-#include <string>   // for string
+#include <algorithm>  // for min
+#include <array>      // for array
+#include <cmath>      // for llround
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int64_t, uint64_t
+#include <cstring>    // for strncmp, strlen
+#include <limits>     // for numeric_limits
+#include <string>     // for string
 
 using std::int64_t;
-using std::map;
-using std::pow;
 using std::size_t;
+using std::uint64_t;
 
 namespace Elements {
 inline namespace Kernel {
 namespace Units {
 
-map<StorageType, std::string> StorageShortName{{StorageType::Byte, "B"},
-                                               {StorageType::KiloByte, "KiB"},
-                                               {StorageType::MegaByte, "MiB"},
-                                               {StorageType::GigaByte, "GiB"},
-                                               {StorageType::TeraByte, "TiB"},
-                                               {StorageType::PetaByte, "PiB"},
-                                               {StorageType::MetricKiloByte, "KB"},
-                                               {StorageType::MetricMegaByte, "MB"},
-                                               {StorageType::MetricGigaByte, "GB"},
-                                               {StorageType::MetricTeraByte, "TB"},
-                                               {StorageType::MetricPetaByte, "PB"}};
-
-map<StorageType, int64_t> StorageFactor{{StorageType::Byte, 1},
-                                        {StorageType::KiloByte, pow(2, 10)},
-                                        {StorageType::MegaByte, pow(2, 20)},
-                                        {StorageType::GigaByte, pow(2, 30)},
-                                        {StorageType::TeraByte, pow(2, 40)},
-                                        {StorageType::PetaByte, pow(2, 50)},
-                                        {StorageType::MetricKiloByte, pow(10, 3)},
-                                        {StorageType::MetricMegaByte, pow(10, 6)},
-                                        {StorageType::MetricGigaByte, pow(10, 9)},
-                                        {StorageType::MetricTeraByte, pow(10, 12)},
-                                        {StorageType::MetricPetaByte, pow(10, 15)}};
+const StorageTable<std::string> StorageShortName{STORAGE_SHORT_NAME_TABLE};
+
+const StorageTable<int64_t> StorageFactor{STORAGE_FACTOR_TABLE};
 
 // explicit instantiation: without the template<>. Otherwise this is a template specialization
 template double roundToDigits<double>(const double& value, const size_t& max_digits);
@@ -67,6 +49,225 @@ template double  storageConvert<double>(const double& size, StorageType source_u
 template float   storageConvert<float>(const float& size, StorageType source_unit, StorageType target_unit);
 template int64_t storageConvert<int64_t>(const int64_t& size, StorageType source_unit, StorageType target_unit);
 
+namespace {
+
+constexpr std::array<StorageType, 5> BINARY_UNITS{{StorageType::PetaByte, StorageType::TeraByte, StorageType::GigaByte,
+                                                   StorageType::MegaByte, StorageType::KiloByte}};
+constexpr std::array<StorageType, 5> METRIC_UNITS{{StorageType::MetricPetaByte, StorageType::MetricTeraByte,
+                                                   StorageType::MetricGigaByte, StorageType::MetricMegaByte,
+                                                   StorageType::MetricKiloByte}};
+
+uint64_t absoluteValue(int64_t value) {
+  return value < 0 ? uint64_t{0} - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+}
+
+bool isBlank(char c) {
+  return c == ' ' or c == '\t';
+}
+
+bool isDigit(char c) {
+  return c >= '0' and c <= '9';
+}
+
+}  // namespace
+
+StorageType bestStorageUnit(int64_t size_in_bytes, bool metric) noexcept {
+
+  const uint64_t size  = absoluteValue(size_in_bytes);
+  const auto&    units = metric ? METRIC_UNITS : BINARY_UNITS;
+
+  for (const auto u : units) {
+    if (size >= static_cast<uint64_t>(storageFactor(u))) {
+      return u;
+    }
+  }
+
+  return StorageType::Byte;
+}
+
+size_t formatStorage(int64_t size_in_bytes, StorageType unit, char* buffer, size_t buffer_size,
+                     size_t max_digits) noexcept {
+
+  constexpr size_t max_fraction_digits{18};
+
+  const uint64_t factor = static_cast<uint64_t>(storageFactor(unit));
+  const size_t   digits = (unit == StorageType::Byte) ? 0 : std::min(max_digits, max_fraction_digits);
+
+  uint64_t integer_part = absoluteValue(size_in_bytes) / factor;
+  uint64_t remainder    = absoluteValue(size_in_bytes) % factor;
+
+  // long division: the remainder is always smaller than 2^50 and
+  // cannot overflow when multiplied by 10.
+  std::array<char, max_fraction_digits> fraction{};
+  for (size_t i = 0; i < digits; ++i) {
+    remainder *= 10;
+    fraction[i] = static_cast<char>('0' + remainder / factor);
+    remainder %= factor;
+  }
+
+  // round to the nearest value and propagate the carry
+  if (2 * remainder >= factor) {
+    size_t i     = digits;
+    bool   carry = true;
+    while (carry and i > 0) {
+      --i;
+      if (fraction[i] == '9') {
+        fraction[i] = '0';
+      } else {
+        ++fraction[i];
+        carry = false;
+      }
+    }
+    if (carry) {
+      ++integer_part;
+    }
+  }
+
+  std::array<char, 20> integer_digits{};
+  size_t               integer_length = 0;
+  do {
+    integer_digits[integer_length++] = static_cast<char>('0' + integer_part % 10);
+    integer_part /= 10;
+  } while (integer_part != 0);
+
+  const char*  name        = storageShortName(unit);
+  const size_t name_length = std::strlen(name);
+  const size_t length      = (size_in_bytes < 0 ? 1 : 0) + integer_length + (digits > 0 ? digits + 1 : 0) + 1 +
+                        name_length;
+
+  if (buffer == nullptr or length >= buffer_size) {
+    if (buffer != nullptr and buffer_size > 0) {
+      buffer[0] = '\0';
+    }
+    return 0;
+  }
+
+  char* pos = buffer;
+  if (size_in_bytes < 0) {
+    *pos++ = '-';
+  }
+  while (integer_length > 0) {
+    *pos++ = integer_digits[--integer_length];
+  }
+  if (digits > 0) {
+    *pos++ = '.';
+    for (size_t i = 0; i < digits; ++i) {
+      *pos++ = fraction[i];
+    }
+  }
+  *pos++ = ' ';
+  for (size_t i = 0; i < name_length; ++i) {
+    *pos++ = name[i];
+  }
+  *pos = '\0';
+
+  return length;
+}
+
+size_t formatStorage(int64_t size_in_bytes, char* buffer, size_t buffer_size, size_t max_digits,
+                     bool metric) noexcept {
+  return formatStorage(size_in_bytes, bestStorageUnit(size_in_bytes, metric), buffer, buffer_size, max_digits);
+}
+
+bool parseStorage(const char* text, size_t length, int64_t& size_in_bytes) noexcept {
+
+  constexpr size_t  max_fraction_digits{18};
+  constexpr int64_t max_value = std::numeric_limits<int64_t>::max();
+
+  if (text == nullptr) {
+    return false;
+  }
+
+  const char* pos = text;
+  const char* end = text + length;
+
+  while (pos != end and isBlank(*pos)) {
+    ++pos;
+  }
+
+  bool negative = false;
+  if (pos != end and (*pos == '-' or *pos == '+')) {
+    negative = (*pos == '-');
+    ++pos;
+  }
+
+  bool    has_digits   = false;
+  int64_t integer_part = 0;
+  while (pos != end and isDigit(*pos)) {
+    const int64_t digit = *pos - '0';
+    if (integer_part > (max_value - digit) / 10) {
+      return false;
+    }
+    integer_part = integer_part * 10 + digit;
+    has_digits   = true;
+    ++pos;
+  }
+
+  int64_t fraction_part   = 0;
+  size_t  fraction_digits = 0;
+  if (pos != end and *pos == '.') {
+    ++pos;
+    while (pos != end and isDigit(*pos)) {
+      // the digits beyond the int64_t precision are not significant
+      if (fraction_digits < max_fraction_digits) {
+        fraction_part = fraction_part * 10 + (*pos - '0');
+        ++fraction_digits;
+      }
+      has_digits = true;
+      ++pos;
+    }
+  }
+
+  if (not has_digits) {
+    return false;
+  }
+
+  while (pos != end and isBlank(*pos)) {
+    ++pos;
+  }
+
+  const char* name_end = end;
+  while (name_end != pos and isBlank(*(name_end - 1))) {
+    --name_end;
+  }
+  const size_t name_length = static_cast<size_t>(name_end - pos);
+
+  StorageType unit  = StorageType::Byte;
+  bool        found = (name_length == 0);
+  for (size_t i = 0; i < STORAGE_SHORT_NAME_TABLE.size() and not found; ++i) {
+    const char* name = STORAGE_SHORT_NAME_TABLE[i];
+    if (std::strlen(name) == name_length and std::strncmp(name, pos, name_length) == 0) {
+      unit  = static_cast<StorageType>(i);
+      found = true;
+    }
+  }
+
+  if (not found) {
+    return false;
+  }
+
+  const int64_t factor = storageFactor(unit);
+  if (integer_part > max_value / factor) {
+    return false;
+  }
+
+  const int64_t fraction_bytes = std::llround(static_cast<long double>(fraction_part) * static_cast<long double>(factor) /
+                                              static_cast<long double>(DECIMAL_POWER_TABLE[fraction_digits]));
+
+  if (integer_part * factor > max_value - fraction_bytes) {
+    return false;
+  }
+
+  const int64_t value = integer_part * factor + fraction_bytes;
+  size_in_bytes       = negative ? -value : value;
+
+  return true;
+}
+
+bool parseStorage(const std::string& text, int64_t& size_in_bytes) noexcept {
+  return parseStorage(text.data(), text.size(), size_in_bytes);
+}
+
 }  // namespace Units
 }  // namespace Kernel
 }  // namespace Elements
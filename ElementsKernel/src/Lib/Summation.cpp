@@ -0,0 +1,94 @@
+/**
+ * @file Summation.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/Summation.h"
+
+#include <algorithm>     // for min, max
+#include <cstddef>       // for size_t
+#include <system_error>  // for system_error
+#include <thread>        // for thread, hardware_concurrency
+#include <vector>        // for vector
+
+using std::size_t;
+
+namespace Elements {
+
+// explicit instantiation: without the template<>. Otherwise this is a template specialization
+template class CompensatedSum<double>;
+template class CompensatedSum<float>;
+
+namespace {
+
+/// below this number of elements per thread, the threads cost more than they bring
+constexpr size_t MIN_CHUNK_SIZE{1 << 16};
+
+template <typename T>
+T parallelSumImpl(const T* data, size_t size, size_t thread_number) {
+
+  if (thread_number == 0) {
+    thread_number = std::max(1U, std::thread::hardware_concurrency());
+  }
+  thread_number = std::max(size_t{1}, std::min(thread_number, size / MIN_CHUNK_SIZE));
+
+  if (thread_number == 1) {
+    return blockedKahanSum(data, data + size);
+  }
+
+  const size_t             chunk_size = (size + thread_number - 1) / thread_number;
+  std::vector<T>           partial_sums(thread_number, T{0});
+  std::vector<std::thread> threads;
+  threads.reserve(thread_number - 1);
+
+  // the calling thread takes the last chunk, and the chunks of the threads which cannot be started
+  size_t started = 0;
+  try {
+    for (; started + 1 < thread_number; ++started) {
+      const size_t t = started;
+      threads.emplace_back([data, chunk_size, t, &partial_sums]() {
+        partial_sums[t] = blockedKahanSum(data + t * chunk_size, data + (t + 1) * chunk_size);
+      });
+    }
+  } catch (const std::system_error&) {
+    // out of resources: the threads already started are still joined below
+  }
+  for (size_t t = started; t + 1 < thread_number; ++t) {
+    partial_sums[t] = blockedKahanSum(data + t * chunk_size, data + (t + 1) * chunk_size);
+  }
+  partial_sums[thread_number - 1] = blockedKahanSum(data + (thread_number - 1) * chunk_size, data + size);
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return kahanSum(partial_sums.cbegin(), partial_sums.cend());
+}
+
+}  // namespace
+
+double parallelSum(const double* data, size_t size, size_t thread_number) {
+  return parallelSumImpl(data, size, thread_number);
+}
+
+float parallelSum(const float* data, size_t size, size_t thread_number) {
+  return parallelSumImpl(data, size, thread_number);
+}
+
+}  // namespace Elements
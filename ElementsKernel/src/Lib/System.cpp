@@ -23,26 +23,37 @@
 #include <dlfcn.h>     // for Dl_info, dladdr, dlclose, etc
 #include <execinfo.h>  // for backtrace
 #include <sys/utsname.h>
-#include <unistd.h>  // for environ
+#include <unistd.h>    // for environ
 
-#include <array>    // for array
-#include <cstdlib>  // for free, getenv, malloc, etc
+#include <algorithm>      // for min, max
+#include <array>          // for array
+#include <cstdlib>        // for free, getenv, malloc, etc
+#include <deque>          // for deque
 #include <iomanip>
 #include <iostream>
-#include <new>  // for new
+#include <new>            // for new
 #include <sstream>
-#include <string>    // for string
-#include <typeinfo>  // for type_info
-#include <vector>    // for vector
+#include <string>         // for string
+#include <typeinfo>       // for type_info
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair, move
+#include <vector>         // for vector
+
+#include <boost/functional/hash.hpp>      // for hash
+#include <boost/thread/locks.hpp>         // for shared_lock, unique_lock
+#include <boost/thread/shared_mutex.hpp>  // for shared_mutex
+#include <boost/utility/string_view.hpp>  // for string_view
 
 #include <cerrno>   // for errno
 #include <climits>  // for HOST_NAME_MAX
 #include <cstddef>  // for size_t
 #include <cstring>  // for strnlen, strerror
 
+#include "ElementsKernel/EnvironmentSnapshot.h"  // for EnvironmentSnapshot
 #include "ElementsKernel/FuncPtrCast.h"
-#include "ElementsKernel/ModuleInfo.h"  // for ImageHandle
-#include "ElementsKernel/Unused.h"      // for ELEMENTS_UNUSED
+#include "ElementsKernel/ModuleInfo.h"           // for ImageHandle
+#include "ElementsKernel/StackTrace.h"           // for StackTrace
+#include "ElementsKernel/Unused.h"               // for ELEMENTS_UNUSED
 
 using std::size_t;
 using std::string;
@@ -57,10 +68,14 @@ namespace System {
 
 namespace {
 
+/// the errno value which tells getErrorString to use the message of dlerror
+constexpr unsigned int DL_ERROR{0xAFFEDEAD};
+
 unsigned long doLoad(const string& name, ImageHandle* handle) {
-  void* mh = ::dlopen(name.length() == 0 ? 0 : name.c_str(), RTLD_LAZY | RTLD_GLOBAL);
-  *handle  = mh;
-  if (0 == *handle) {
+  *handle = ::dlopen(name.length() == 0 ? nullptr : name.c_str(), RTLD_LAZY | RTLD_GLOBAL);
+  if (nullptr == *handle) {
+    // dlopen doesn't set errno: its value could even be taken for a success
+    errno = static_cast<int>(DL_ERROR);
     return getLastError();
   }
   return 1;
@@ -105,7 +120,7 @@ unsigned long loadDynamicLib(const string& name, ImageHandle* handle) {
       res = loadWithoutEnvironment(dllName, handle);
     }
     if (res != 1) {
-      errno = static_cast<int>(0xAFFEDEAD);
+      errno = static_cast<int>(DL_ERROR);
     }
   }
   return res;
@@ -113,8 +128,8 @@ unsigned long loadDynamicLib(const string& name, ImageHandle* handle) {
 
 /// unload dynamic link library
 unsigned long unloadDynamicLib(ImageHandle handle) {
-  ::dlclose(handle);
-  if (0) {
+  if (::dlclose(handle) != 0) {
+    errno = static_cast<int>(DL_ERROR);
     return getLastError();
   }
   return 1;
@@ -125,7 +140,7 @@ unsigned long getProcedureByName(ImageHandle handle, const string& name, EntryPo
 #if defined(__linux__)
   *pFunction = FuncPtrCast<EntryPoint>(::dlsym(handle, name.c_str()));
   if (0 == *pFunction) {
-    errno = static_cast<int>(0xAFFEDEAD);
+    errno = static_cast<int>(DL_ERROR);
     return 0;
   }
 #elif defined(__APPLE__)
@@ -136,7 +151,7 @@ unsigned long getProcedureByName(ImageHandle handle, const string& name, EntryPo
     *pFunction   = (EntryPoint)::dlsym(handle, sname.c_str());
   }
   if (0 == *pFunction) {
-    errno = static_cast<int>(0xAFFEDEAD);
+    errno = static_cast<int>(DL_ERROR);
     std::cout << "Elements::System::getProcedureByName>" << getLastErrorString() << std::endl;
     return 0;
   }
@@ -166,7 +181,7 @@ const string getErrorString(unsigned long error) {
   string errString = "";
   char*  cerrString(0);
   // Remember: for linux dl* routines must be handled differently!
-  if (error == 0xAFFEDEAD) {
+  if (error == DL_ERROR) {
     cerrString = reinterpret_cast<char*>(::dlerror());
     if (0 == cerrString) {
       cerrString = std::strerror(static_cast<int>(error));
@@ -187,7 +202,31 @@ const string typeinfoName(const std::type_info& tinfo) {
   return typeinfoName(tinfo.name());
 }
 
-const string typeinfoName(const char* class_name) {
+namespace {
+
+/// mangled and demangled names
+using TypeName = std::pair<string, string>;
+
+/// at most this number of name addresses are kept: the other ones only use the content index
+constexpr std::size_t MAX_TYPE_NAME_ADDRESSES{4096};
+
+/// demangled type names, keyed by the mangled ones. Nothing is ever removed
+struct TypeNameCache {
+  boost::shared_mutex mutex;
+  /// the deque doesn't move its elements: the keys of the index point into them
+  std::deque<TypeName>                                                                     names;
+  std::unordered_map<boost::string_view, const TypeName*, boost::hash<boost::string_view>> index;
+  /// the std::type_info names are static: the same address is mostly passed again
+  std::unordered_map<const char*, const TypeName*> addresses;
+};
+
+/// never destroyed: the names can still be needed during the static destruction
+TypeNameCache& typeNameCache() {
+  static TypeNameCache* cache = new TypeNameCache;
+  return *cache;
+}
+
+string demangle(const char* class_name) {
   string result;
   if (strnlen(class_name, 1024) == 1) {
     // See http://www.realitydiluted.com/mirrors/reality.sgi.com/dehnert_engr/cxx/abi.pdf
@@ -274,51 +313,106 @@ const string typeinfoName(const char* class_name) {
   return result;
 }
 
-/// Host name
-const string& hostName() {
-  static string host{};
-  if (host.empty()) {
-    std::array<char, HOST_NAME_MAX + 1> buffer;
-    ::gethostname(buffer.data(), HOST_NAME_MAX);
-    host = buffer.data();
+}  // namespace
+
+const string typeinfoName(const char* class_name) {
+
+  auto&           cache = typeNameCache();
+  const TypeName* entry = nullptr;
+
+  {
+    boost::shared_lock<boost::shared_mutex> lock(cache.mutex);
+    // the address may have been reused for another name: the content is compared as well
+    const auto found_address = cache.addresses.find(class_name);
+    if (found_address != cache.addresses.end() and found_address->second->first == class_name) {
+      return found_address->second->second;
+    }
+    const auto found = cache.index.find(boost::string_view{class_name});
+    if (found != cache.index.end()) {
+      entry = found->second;
+    }
   }
-  return host;
+
+  // the demangling is done without the lock
+  string result;
+  if (entry == nullptr) {
+    result = demangle(class_name);
+  }
+
+  boost::unique_lock<boost::shared_mutex> lock(cache.mutex);
+  if (entry == nullptr) {
+    // another thread may have added the same name meanwhile
+    const auto found = cache.index.find(boost::string_view{class_name});
+    if (found != cache.index.end()) {
+      entry = found->second;
+    } else {
+      cache.names.emplace_back(class_name, std::move(result));
+      entry = &cache.names.back();
+      cache.index.emplace(boost::string_view{entry->first}, entry);
+    }
+  }
+  if (cache.addresses.size() < MAX_TYPE_NAME_ADDRESSES or cache.addresses.count(class_name) != 0) {
+    cache.addresses[class_name] = entry;
+  }
+
+  return entry->second;
 }
 
-/// OS name
-const string& osName() {
-  static string  osname = "";
+namespace {
+
+/// the identification of the host, which doesn't change during the run
+struct HostInformation {
+  string host_name;
+  string os_name{"UNKNOWN"};
+  string os_version{"UNKNOWN"};
+  string machine_type{"UNKNOWN"};
+};
+
+HostInformation readHostInformation() {
+
+  HostInformation information;
+
+  std::array<char, HOST_NAME_MAX + 1> buffer{};
+  if (::gethostname(buffer.data(), HOST_NAME_MAX) == 0) {
+    information.host_name = buffer.data();
+  }
+
   struct utsname ut;
   if (::uname(&ut) == 0) {
-    osname = ut.sysname;
-  } else {
-    osname = "UNKNOWN";
+    information.os_name      = ut.sysname;
+    information.os_version   = ut.release;
+    information.machine_type = ut.machine;
   }
-  return osname;
+
+  return information;
 }
 
-/// OS version
-const string& osVersion() {
-  static string  osver = "UNKNOWN";
-  struct utsname ut;
+/// read once. The initialization of the static local variable is thread-safe
+const HostInformation& hostInformation() {
+  static const HostInformation information = readHostInformation();
+  return information;
+}
 
-  if (uname(&ut) == 0) {
-    osver = ut.release;
-  }
+}  // namespace
 
-  return osver;
+/// Host name
+const string& hostName() {
+  return hostInformation().host_name;
 }
 
-/// Machine type
-const string& machineType() {
-  static string  mach = "UNKNOWN";
-  struct utsname ut;
+/// OS name
+const string& osName() {
+  return hostInformation().os_name;
+}
 
-  if (uname(&ut) == 0) {
-    mach = ut.machine;
-  }
+/// OS version
+const string& osVersion() {
+  return hostInformation().os_version;
+}
 
-  return mach;
+/// Machine type
+const string& machineType() {
+  return hostInformation().machine_type;
 }
 
 string getEnv(const string& var) {
@@ -373,11 +467,15 @@ int setEnv(const string& name, const string& value, bool overwrite) {
     over = 0;
   }
 
-  return ::setenv(name.c_str(), value.c_str(), over);
+  return EnvironmentSnapshot::update(name, [&name, &value, over]() {
+    return ::setenv(name.c_str(), value.c_str(), over);
+  });
 }
 
 int unSetEnv(const string& name) {
-  return ::unsetenv(name.c_str());
+  return EnvironmentSnapshot::update(name, [&name]() {
+    return ::unsetenv(name.c_str());
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -394,30 +492,18 @@ __attribute__((noinline)) int backTrace(ELEMENTS_UNUSED std::shared_ptr<void*> a
   }
 }
 
-const vector<string> backTrace(const int depth, const int offset) {
+__attribute__((noinline)) const vector<string> backTrace(const int depth, const int offset) {
 
-  // Always hide the first two levels of the stack trace (that's us)
-  const int      total_offset = offset + STACK_OFFSET;
-  const int      total_depth  = depth + total_offset;
-  vector<string> trace{};
+  StackTrace stack;
+  // Always hide this level of the stack trace (that's us). Only the requested frames are symbolized
+  stack.capture(static_cast<size_t>(std::max(offset, 0)) + 1, static_cast<size_t>(std::max(depth, 0)));
 
-  std::shared_ptr<void*> addresses{new (std::nothrow) void*[static_cast<std::size_t>(total_depth)],
-                                   std::default_delete<void*[]>()};
-
-  if (addresses.get() != nullptr) {
-
-    int count = backTrace(addresses, total_depth);
+  const auto     frames = stack.symbolize();
+  vector<string> trace{};
 
-    for (int i = total_offset; i < count; ++i) {
-      void*  addr = 0;
-      string fnc;
-      string lib;
-      if (getStackLevel(addresses.get()[i], addr, fnc, lib)) {
-        std::ostringstream ost;
-        ost << "#" << std::setw(3) << std::setiosflags(std::ios::left) << i - total_offset + 1;
-        ost << std::hex << addr << std::dec << " " << fnc << "  [" << lib << "]";
-        trace.emplace_back(ost.str());
-      }
+  for (size_t i = 0; i < frames.size(); ++i) {
+    if (not frames[i].library.empty()) {
+      trace.emplace_back(formatStackFrame(i + 1, frames[i]));
     }
   }
 
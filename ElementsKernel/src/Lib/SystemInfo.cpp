@@ -0,0 +1,106 @@
+/**
+ * @file SystemInfo.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/SystemInfo.h"
+
+#include <unistd.h>  // for sysconf
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <string>   // for string
+
+#include "ElementsKernel/Hardware.h"  // for cpuTopology
+#include "ElementsKernel/System.h"    // for hostName, osName, osVersion, machineType
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+namespace System {
+
+namespace {
+
+/// the names of the SimdFeature bits, in the same order
+const char* const simd_names[] = {"sse2",    "sse3", "ssse3",  "sse4.1", "sse4.2",   "avx",      "avx2",    "fma",
+                                  "avx512f", "neon", "popcnt", "bmi2",   "avx512dq", "avx512bw", "avx512vl"};
+
+size_t configuration(int name) {
+  const long value = ::sysconf(name);
+  return value > 0 ? static_cast<size_t>(value) : 0;
+}
+
+SystemInfo readSystemInfo() {
+
+  SystemInfo info{hostName(), osName(), osVersion(), machineType(), 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+  const auto& topology = cpuTopology();
+
+  info.cpu_number       = configuration(_SC_NPROCESSORS_ONLN);
+  info.numa_node_number = topology.numa_nodes.size();
+  info.page_size        = configuration(_SC_PAGESIZE);
+#if defined(_SC_PHYS_PAGES)
+  info.physical_memory = configuration(_SC_PHYS_PAGES) * info.page_size;
+#endif
+  info.simd_features = topology.isa_features;
+
+  unsigned level = 1;
+  for (auto size : {&info.l1_data_cache_size, &info.l2_cache_size, &info.l3_cache_size}) {
+    const auto cache = topology.dataCache(level++);
+    if (cache != nullptr) {
+      *size = cache->size;
+      if (info.cache_line_size == 0) {
+        info.cache_line_size = cache->line_size;
+      }
+    }
+  }
+
+  return info;
+}
+
+}  // namespace
+
+bool SystemInfo::hasSimd(SimdFeature feature) const {
+  return (simd_features & static_cast<std::uint32_t>(feature)) != 0;
+}
+
+string SystemInfo::simdFeatureNames() const {
+
+  string names;
+  for (size_t bit = 0; bit < sizeof(simd_names) / sizeof(simd_names[0]); ++bit) {
+    if ((simd_features >> bit) & 1U) {
+      if (not names.empty()) {
+        names += ' ';
+      }
+      names += simd_names[bit];
+    }
+  }
+
+  return names;
+}
+
+const SystemInfo& systemInfo() {
+  static const SystemInfo info = readSystemInfo();
+  return info;
+}
+
+}  // namespace System
+}  // namespace Elements
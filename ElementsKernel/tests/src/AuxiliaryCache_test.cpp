@@ -0,0 +1,300 @@
+/**
+ * @file AuxiliaryCache_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/AuxiliaryCache.h"  // header to test
+
+#include <chrono>   // for milliseconds
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <thread>   // for thread, sleep_for
+#include <vector>   // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream, ifstream
+#include <boost/filesystem/operations.hpp>  // for create_directory, exists, file_size
+#include <boost/test/unit_test.hpp>         // for boost unit test macros
+
+#include "ElementsKernel/Auxiliary.h"  // for getAuxiliaryPath
+#include "ElementsKernel/Path.h"       // for Path::Item
+#include "ElementsKernel/Temporary.h"  // for TempDir, TempEnv
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Path::Item;
+
+namespace {
+
+void writeFile(const Item& file_path, const string& content) {
+  boost::filesystem::ofstream ofs(file_path, std::ios::binary);
+  ofs << content;
+}
+
+string readFile(const Item& file_path) {
+  string                      content(boost::filesystem::file_size(file_path), '\0');
+  boost::filesystem::ifstream ifs(file_path, std::ios::binary);
+  ifs.read(&content[0], static_cast<std::streamsize>(content.size()));
+  return content;
+}
+
+/// the modification times of the files have a coarse resolution on some filesystems
+void waitForClockTick() {
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+}
+
+}  // namespace
+
+struct AuxiliaryCache_Fixture {
+
+  TempDir m_top_dir{"AuxiliaryCache_test-%%%%%%%"};
+  Item    m_source_dir{m_top_dir.path() / "storage"};
+  Item    m_cache_dir{m_top_dir.path() / "cache"};
+
+  AuxiliaryCache_Fixture() {
+    boost::filesystem::create_directory(m_source_dir);
+    for (const auto& name : {"first.fits", "second.fits", "third.fits"}) {
+      writeFile(m_source_dir / name, string(1000, name[0]));
+    }
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(AuxiliaryCache_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(Copy_test, AuxiliaryCache_Fixture) {
+
+  AuxiliaryCache cache(m_cache_dir);
+
+  const Item source     = m_source_dir / "first.fits";
+  const Item local_file = cache.get(source);
+
+  BOOST_CHECK(local_file != source);
+  BOOST_CHECK_EQUAL(local_file.filename(), source.filename());
+  BOOST_CHECK_EQUAL(local_file.parent_path().parent_path(), m_cache_dir);
+  BOOST_CHECK_EQUAL(readFile(local_file), readFile(source));
+  BOOST_CHECK_EQUAL(cache.statistics().copies, 1);
+
+  BOOST_CHECK_EQUAL(cache.get(source), local_file);
+  BOOST_CHECK_EQUAL(cache.statistics().hits, 1);
+  BOOST_CHECK_EQUAL(cache.size(), 1000);
+
+  // another user of the same directory finds the copy
+  AuxiliaryCache other_cache(m_cache_dir);
+  BOOST_CHECK_EQUAL(other_cache.get(source), local_file);
+  BOOST_CHECK_EQUAL(other_cache.statistics().hits, 1);
+  BOOST_CHECK_EQUAL(other_cache.statistics().copies, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(LocalCopy_test, AuxiliaryCache_Fixture) {
+
+  AuxiliaryCache cache(m_cache_dir);
+
+  const Item source     = m_source_dir / "first.fits";
+  const Item local_file = cache.get(source);
+
+  // a recent copy of an unchanged source is returned without reading the entry again
+  boost::filesystem::remove(local_file.parent_path() / ".source");
+  BOOST_CHECK_EQUAL(cache.get(source), local_file);
+  BOOST_CHECK_EQUAL(cache.statistics().hits, 1);
+  BOOST_CHECK_EQUAL(cache.statistics().copies, 1);
+
+  // a changed source is checked and copied again
+  waitForClockTick();
+  writeFile(source, "new content");
+  BOOST_CHECK_EQUAL(cache.get(source), local_file);
+  BOOST_CHECK_EQUAL(readFile(local_file), "new content");
+  BOOST_CHECK_EQUAL(cache.statistics().copies, 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(Validation_test, AuxiliaryCache_Fixture) {
+
+  const Item source     = m_source_dir / "first.fits";
+  const Item local_file = AuxiliaryCache(m_cache_dir).get(source);
+
+  boost::filesystem::ifstream old_input(local_file, std::ios::binary);
+
+  // a changed source is copied again
+  waitForClockTick();
+  writeFile(source, "new content");
+
+  AuxiliaryCache cache(m_cache_dir);
+  BOOST_CHECK_EQUAL(cache.get(source), local_file);
+  BOOST_CHECK_EQUAL(readFile(local_file), "new content");
+  BOOST_CHECK_EQUAL(cache.statistics().copies, 1);
+
+  // the replaced file is still readable by its users
+  string old_content;
+  BOOST_CHECK(std::getline(old_input, old_content));
+  BOOST_CHECK_EQUAL(old_content, string(1000, 'f'));
+
+  // a corrupted copy is detected by the first check of another user
+  writeFile(local_file, "bad content");
+
+  AuxiliaryCache other_cache(m_cache_dir);
+  BOOST_CHECK_EQUAL(other_cache.get(source), local_file);
+  BOOST_CHECK_EQUAL(readFile(local_file), "new content");
+  BOOST_CHECK_EQUAL(other_cache.statistics().copies, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(Eviction_test, AuxiliaryCache_Fixture) {
+
+  AuxiliaryCache cache(m_cache_dir, 2500, std::chrono::milliseconds(0));
+
+  const Item first = cache.get(m_source_dir / "first.fits");
+  waitForClockTick();
+  const Item second = cache.get(m_source_dir / "second.fits");
+  waitForClockTick();
+
+  // the first file becomes the most recently used
+  cache.get(m_source_dir / "first.fits");
+  waitForClockTick();
+
+  const Item third = cache.get(m_source_dir / "third.fits");
+
+  BOOST_CHECK_EQUAL(cache.statistics().evictions, 1);
+  BOOST_CHECK(cache.size() <= cache.maxSize());
+  BOOST_CHECK(boost::filesystem::exists(first));
+  BOOST_CHECK(not boost::filesystem::exists(second));
+  BOOST_CHECK(boost::filesystem::exists(third));
+
+  // the lock file of the evicted entry is removed as well
+  const string second_key = second.parent_path().filename().string();
+  BOOST_CHECK(not boost::filesystem::exists(m_cache_dir / (second_key + ".lock")));
+  BOOST_CHECK(boost::filesystem::exists(m_cache_dir / (first.parent_path().filename().string() + ".lock")));
+}
+
+BOOST_FIXTURE_TEST_CASE(MinimumAge_test, AuxiliaryCache_Fixture) {
+
+  AuxiliaryCache cache(m_cache_dir, 2500);
+  BOOST_CHECK(cache.minAge() == DEFAULT_AUX_CACHE_MIN_AGE);
+
+  const Item first  = cache.get(m_source_dir / "first.fits");
+  const Item second = cache.get(m_source_dir / "second.fits");
+  const Item third  = cache.get(m_source_dir / "third.fits");
+
+  // the files just returned are kept above the limit
+  BOOST_CHECK_EQUAL(cache.statistics().evictions, 0);
+  BOOST_CHECK_EQUAL(cache.size(), 3000);
+  BOOST_CHECK(boost::filesystem::exists(first));
+  BOOST_CHECK(boost::filesystem::exists(second));
+  BOOST_CHECK(boost::filesystem::exists(third));
+
+  // they are evicted once old enough
+  waitForClockTick();
+  AuxiliaryCache young_cache(m_cache_dir, 2500, std::chrono::milliseconds(10));
+  young_cache.get(m_source_dir / "first.fits");
+  waitForClockTick();
+  young_cache.get(m_source_dir / "second.fits");
+  BOOST_CHECK_EQUAL(young_cache.statistics().copies, 0);
+
+  // a copy triggers the eviction
+  writeFile(m_source_dir / "second.fits", string(1000, 'n'));
+  young_cache.get(m_source_dir / "second.fits");
+  BOOST_CHECK_EQUAL(young_cache.statistics().evictions, 1);
+  BOOST_CHECK(not boost::filesystem::exists(third));
+  BOOST_CHECK(boost::filesystem::exists(first));
+}
+
+BOOST_FIXTURE_TEST_CASE(Fallback_test, AuxiliaryCache_Fixture) {
+
+  // too large for the cache
+  AuxiliaryCache small_cache(m_cache_dir, 100);
+  BOOST_CHECK_EQUAL(small_cache.get(m_source_dir / "first.fits"), m_source_dir / "first.fits");
+
+  // not a regular file
+  AuxiliaryCache cache(m_cache_dir);
+  BOOST_CHECK_EQUAL(cache.get(m_source_dir), m_source_dir);
+  BOOST_CHECK_EQUAL(cache.get(m_source_dir / "missing.fits"), m_source_dir / "missing.fits");
+
+  // the cache directory cannot be created
+  const Item blocking_file = m_top_dir.path() / "blocking";
+  writeFile(blocking_file, "");
+  AuxiliaryCache broken_cache(blocking_file / "cache");
+  BOOST_CHECK_EQUAL(broken_cache.get(m_source_dir / "first.fits"), m_source_dir / "first.fits");
+  BOOST_CHECK_EQUAL(broken_cache.statistics().failures, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(ConcurrentUsers_test, AuxiliaryCache_Fixture) {
+
+  // each user has its own instance, as separate processes would
+  constexpr size_t user_number{8};
+
+  vector<Item>        local_files(user_number);
+  vector<size_t>      copies(user_number);
+  vector<std::thread> users;
+
+  for (size_t u = 0; u < user_number; ++u) {
+    users.emplace_back([this, u, &local_files, &copies]() {
+      AuxiliaryCache cache(m_cache_dir);
+      local_files[u] = cache.get(m_source_dir / "first.fits");
+      copies[u]      = cache.statistics().copies;
+    });
+  }
+  for (auto& u : users) {
+    u.join();
+  }
+
+  size_t total_copies = 0;
+  for (size_t u = 0; u < user_number; ++u) {
+    BOOST_CHECK_EQUAL(local_files[u], local_files[0]);
+    total_copies += copies[u];
+  }
+  BOOST_CHECK_EQUAL(total_copies, 1);
+  BOOST_CHECK_EQUAL(readFile(local_files[0]), string(1000, 'f'));
+}
+
+BOOST_FIXTURE_TEST_CASE(Environment_test, AuxiliaryCache_Fixture) {
+
+  auto env = TempEnv();
+
+  if (Environment::hasKey(AUX_CACHE_DIR_VARIABLE)) {
+    env.unSet(AUX_CACHE_DIR_VARIABLE);
+  }
+  BOOST_CHECK(AuxiliaryCache::fromEnvironment() == nullptr);
+
+  env[AUX_CACHE_DIR_VARIABLE]  = m_cache_dir.string();
+  env[AUX_CACHE_SIZE_VARIABLE] = "1 MiB";
+
+  auto cache = AuxiliaryCache::fromEnvironment();
+  BOOST_REQUIRE(cache != nullptr);
+  BOOST_CHECK_EQUAL(cache->directory(), m_cache_dir);
+  BOOST_CHECK_EQUAL(cache->maxSize(), 1024 * 1024);
+  BOOST_CHECK_EQUAL(AuxiliaryCache::fromEnvironment(), cache);
+
+  // the auxiliary files are served from the cache
+  env["ELEMENTS_AUX_PATH"] = m_source_dir.string();
+
+  const Item local_file = getAuxiliaryPath("second.fits");
+  BOOST_CHECK_EQUAL(local_file.parent_path().parent_path(), m_cache_dir);
+  BOOST_CHECK_EQUAL(readFile(local_file), string(1000, 's'));
+
+  BOOST_CHECK_EQUAL(getAuxiliaryPaths({"second.fits"}).at("second.fits"), local_file);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------
+
+}  // namespace Elements
@@ -25,8 +25,8 @@
 #include <string>     // for std::string
 #include <vector>     // for std::vector
 
-#include <boost/filesystem/fstream.hpp>     // for ofstream
-#include <boost/filesystem/operations.hpp>  // for exists
+#include <boost/filesystem/fstream.hpp>     // for ofstream, ifstream
+#include <boost/filesystem/operations.hpp>  // for exists, file_size
 #include <boost/test/unit_test.hpp>         // for boost unit test macros
 
 #include "ElementsKernel/Path.h"       // for joinPath, Path::Item
@@ -170,6 +170,73 @@ BOOST_FIXTURE_TEST_CASE(NamespaceAlias_test, Auxiliary_Fixture) {
   BOOST_CHECK_EQUAL(Auxiliary::getVariableName(), "ELEMENTS_AUX_PATH");
 
   Path::Item make_template = Auxiliary::getPath("ElementsKernel/templates/Makefile.in");
+
+  auto make_templates = Auxiliary::getPaths({"ElementsKernel/templates/Makefile.in"});
+
+  BOOST_CHECK_EQUAL(make_templates.at("ElementsKernel/templates/Makefile.in"), make_template);
+}
+
+BOOST_FIXTURE_TEST_CASE(getAuxiliaryPaths_test, Auxiliary_Fixture) {
+
+  const vector<string> file_names{"ElementsKernel/templates/Makefile.in", "ElementsKernel/templates/CMakeLists.txt.in"};
+
+  for (const bool parallel : {false, true}) {
+
+    auto found_paths = getAuxiliaryPaths(file_names, true, parallel);
+
+    BOOST_CHECK_EQUAL(found_paths.size(), file_names.size());
+    for (const auto& name : file_names) {
+      BOOST_CHECK_EQUAL(found_paths.at(name), getAuxiliaryPath(name));
+    }
+  }
+
+  BOOST_CHECK_THROW(getAuxiliaryPaths({"ElementsKernel/templates/Makefile.in", "NonExistingFile.txt"}), Exception);
+
+  auto found_paths = getAuxiliaryPaths({"NonExistingFile.txt"}, false);
+
+  BOOST_CHECK(found_paths.at("NonExistingFile.txt").empty());
+}
+
+BOOST_AUTO_TEST_CASE(prefetchAuxiliaryFiles_test) {
+
+  const string make_template_stem{"ElementsKernel/templates/Makefile.in"};
+
+  auto prefetch = prefetchAuxiliaryFiles({make_template_stem});
+  prefetch.wait();
+
+  BOOST_CHECK(prefetch.done());
+  BOOST_CHECK_EQUAL(prefetch.errorNumber(), 0);
+  BOOST_CHECK_EQUAL(prefetch.files().size(), 1);
+  BOOST_CHECK_EQUAL(prefetch.files()[0], getAuxiliaryPath(make_template_stem));
+  BOOST_CHECK_EQUAL(prefetch.byteNumber(), boost::filesystem::file_size(getAuxiliaryPath(make_template_stem)));
+
+  BOOST_CHECK_THROW(prefetchAuxiliaryFiles({make_template_stem, "NonExistingFile.txt"}), Exception);
+
+  // the missing files are skipped
+  auto partial_prefetch = Auxiliary::prefetch({make_template_stem, "NonExistingFile.txt"}, false);
+  partial_prefetch.wait();
+
+  BOOST_CHECK_EQUAL(partial_prefetch.errorNumber(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(mapAuxiliaryFile_test) {
+
+  const string make_template_stem{"ElementsKernel/templates/Makefile.in"};
+
+  auto mapping = mapAuxiliaryFile(make_template_stem);
+
+  BOOST_CHECK_EQUAL(mapping->path(), getAuxiliaryPath(make_template_stem));
+  BOOST_CHECK_EQUAL(mapping->size(), boost::filesystem::file_size(getAuxiliaryPath(make_template_stem)));
+
+  string                      content(mapping->size(), '\0');
+  boost::filesystem::ifstream ifs(getAuxiliaryPath(make_template_stem));
+  ifs.read(&content[0], static_cast<std::streamsize>(content.size()));
+  BOOST_CHECK_EQUAL(string(mapping->data(), mapping->size()), content);
+
+  // the mapping is shared
+  BOOST_CHECK_EQUAL(Auxiliary::map(make_template_stem), mapping);
+
+  BOOST_CHECK_THROW(mapAuxiliaryFile("NonExistingFile.txt"), Exception);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,76 @@
+/**
+ * @file Benchmark.h
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#ifndef ELEMENTSKERNEL_TESTS_SRC_BENCHMARK_H_
+#define ELEMENTSKERNEL_TESTS_SRC_BENCHMARK_H_
+
+#include <chrono>    // for steady_clock
+#include <cstddef>   // for size_t
+#include <iomanip>   // for setprecision
+#include <iostream>  // for cout
+#include <string>    // for string
+#include <utility>   // for forward
+
+namespace Elements {
+namespace Benchmark {
+
+/**
+ * @brief measure the mean duration of a call
+ * @param iterations
+ *   the number of calls
+ * @param func
+ *   the measured callable. It gets the index of the call.
+ * @return the mean duration in nanoseconds
+ */
+template <typename F>
+double nanoSecondsPerCall(std::size_t iterations, F&& func) {
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < iterations; ++i) {
+    func(i);
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) /
+         static_cast<double>(iterations);
+}
+
+/// @return the mean duration of a call in microseconds
+template <typename F>
+double microSecondsPerCall(std::size_t iterations, F&& func) {
+  return nanoSecondsPerCall(iterations, std::forward<F>(func)) / 1.0e3;
+}
+
+/**
+ * @brief print the duration of a new implementation next to the reference one
+ * @param name
+ *   the name of the measured operation
+ * @param unit
+ *   the time unit of both durations
+ */
+inline void report(const std::string& name, double new_time, double old_time, const std::string& unit = "ns") {
+  std::cout << std::fixed << std::setprecision(2) << name << ": " << new_time << " " << unit
+            << "/op (reference: " << old_time << " " << unit << "/op)" << std::endl;
+}
+
+}  // namespace Benchmark
+}  // namespace Elements
+
+#endif  // ELEMENTSKERNEL_TESTS_SRC_BENCHMARK_H_
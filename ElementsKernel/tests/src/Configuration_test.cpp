@@ -134,6 +134,28 @@ BOOST_FIXTURE_TEST_CASE(getFromLocationsExist_test, Configuration_Fixture) {
                                 m_target_real_item_list.end());
 }
 
+BOOST_FIXTURE_TEST_CASE(mapConfigurationFile_test, Configuration_Fixture) {
+
+  auto env = TempEnv();
+
+  env["ELEMENTS_CONF_PATH"] = Path::join(m_real_item_list);
+
+  {
+    boost::filesystem::ofstream ofs(m_real_item_list[2] / "Mapped.conf");
+    ofs << "option = 1";
+  }
+
+  auto mapping = mapConfigurationFile("Mapped.conf");
+
+  BOOST_CHECK_EQUAL(mapping->path(), m_real_item_list[2] / "Mapped.conf");
+  BOOST_CHECK_EQUAL(string(mapping->data(), mapping->size()), "option = 1");
+
+  // the mapping is shared
+  BOOST_CHECK_EQUAL(Configuration::map("Mapped.conf"), mapping);
+
+  BOOST_CHECK_THROW(mapConfigurationFile("NonExistingFile.conf"), Exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,140 @@
+/**
+ * @file EnvironmentSnapshotBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/EnvironmentSnapshot.h"
+
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <iomanip>    // for setprecision
+#include <iostream>   // for cout
+#include <string>     // for string
+#include <thread>     // for thread, hardware_concurrency
+#include <vector>     // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Environment.h"  // for Environment
+#include "ElementsKernel/System.h"       // for getEnv
+
+#include "Benchmark.h"  // for nanoSecondsPerCall, microSecondsPerCall, report
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+using Benchmark::microSecondsPerCall;
+using Benchmark::nanoSecondsPerCall;
+using Benchmark::report;
+
+namespace {
+
+constexpr size_t iterations{1 << 18};
+
+const std::vector<string> names{"PATH", "HOME", "ELEMENTS_AUX_PATH", "ELEMENTS_CONF_PATH", "Kd8s7a3mvJs"};
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(EnvironmentSnapshotBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(Lookup_test) {
+
+  size_t length    = 0;
+  size_t reference = 0;
+
+  double snapshot_time = nanoSecondsPerCall(iterations, [&length](size_t i) {
+    length += EnvironmentSnapshot::get(names[i % names.size()]).size();
+  });
+  double getenv_time = nanoSecondsPerCall(iterations, [&reference](size_t i) {
+    reference += System::getEnv(names[i % names.size()]).size();
+  });
+
+  report("snapshot lookup", snapshot_time, getenv_time);
+
+  const Environment env;
+  double            environment_time = nanoSecondsPerCall(iterations, [&env, &length](size_t i) {
+    length -= env.get(names[i % names.size()]).size();
+  });
+
+  report("Environment::get", environment_time, getenv_time);
+
+  BOOST_CHECK_EQUAL(length, 0);
+  BOOST_CHECK(reference > 0);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelLookup_test) {
+
+  auto work = []() {
+    size_t length = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+      length += EnvironmentSnapshot::get(names[i % names.size()]).size();
+    }
+    return length;
+  };
+
+  const size_t reference   = work();
+  const size_t max_threads = std::max(2U, std::thread::hardware_concurrency());
+  double       single_time = 0.0;
+
+  for (size_t thread_number = 1; thread_number <= max_threads; thread_number *= 2) {
+
+    std::vector<size_t>      lengths(thread_number, 0);
+    std::vector<std::thread> threads;
+
+    // the threads are started and joined in the measured call
+    const double call_time = microSecondsPerCall(1, [&](size_t) {
+      for (size_t t = 0; t < thread_number; ++t) {
+        threads.emplace_back([&lengths, &work, t]() {
+          lengths[t] = work();
+        });
+      }
+      for (auto& t : threads) {
+        t.join();
+      }
+    });
+    const double elapsed = call_time / 1.0e6;
+
+    for (const auto l : lengths) {
+      BOOST_CHECK_EQUAL(l, reference);
+    }
+
+    if (thread_number == 1) {
+      single_time = elapsed;
+    }
+    std::cout << std::fixed << std::setprecision(2) << "snapshot lookups with " << thread_number
+              << " threads: " << static_cast<double>(thread_number * iterations) / elapsed / 1.0e6
+              << " Mop/s (speedup: " << single_time * static_cast<double>(thread_number) / elapsed << ")"
+              << std::endl;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
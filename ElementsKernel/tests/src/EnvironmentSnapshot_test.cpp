@@ -0,0 +1,191 @@
+/**
+ * @file EnvironmentSnapshot_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/EnvironmentSnapshot.h"  // header to test
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <cstdlib>  // for getenv, setenv, unsetenv
+#include <string>   // for string, to_string
+#include <thread>   // for thread, yield
+#include <vector>   // for vector
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/Environment.h"  // for Environment
+#include "ElementsKernel/Path.h"         // for getLocationsFromEnv
+#include "ElementsKernel/System.h"       // for setEnv, unSetEnv
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+BOOST_AUTO_TEST_SUITE(EnvironmentSnapshot_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Lookup_test) {
+
+  const string path{std::getenv("PATH")};
+
+  string value;
+  BOOST_CHECK(EnvironmentSnapshot::lookup("PATH", value));
+  BOOST_CHECK_EQUAL(value, path);
+  BOOST_CHECK_EQUAL(EnvironmentSnapshot::get("PATH"), path);
+  BOOST_CHECK(EnvironmentSnapshot::hasKey("PATH"));
+  BOOST_CHECK(EnvironmentSnapshot::size() >= 1);
+
+  value = "unchanged";
+  BOOST_CHECK(not EnvironmentSnapshot::lookup("Ksd7ss8kKdi", value));
+  BOOST_CHECK_EQUAL(value, "unchanged");
+  BOOST_CHECK_EQUAL(EnvironmentSnapshot::get("Ksd7ss8kKdi", "default"), "default");
+  BOOST_CHECK(not EnvironmentSnapshot::hasKey("Ksd7ss8kKdi"));
+}
+
+BOOST_AUTO_TEST_CASE(Update_test) {
+
+  const string name{"Kd7dbcs3nf8a"};
+  const size_t generation = EnvironmentSnapshot::generation();
+
+  // the modifications through the System functions are published
+  System::setEnv(name, "first:second");
+  BOOST_CHECK_EQUAL(EnvironmentSnapshot::get(name), "first:second");
+  BOOST_CHECK(EnvironmentSnapshot::generation() > generation);
+
+  const auto locations = Path::getLocationsFromEnv(name);
+  BOOST_REQUIRE_EQUAL(locations.size(), 2);
+  BOOST_CHECK_EQUAL(locations[1], Path::Item{"second"});
+
+  System::unSetEnv(name);
+  BOOST_CHECK(not EnvironmentSnapshot::hasKey(name));
+
+  // and through the Environment class
+  {
+    Environment env;
+    env[name] = "third";
+    BOOST_CHECK_EQUAL(EnvironmentSnapshot::get(name), "third");
+    BOOST_CHECK_EQUAL(env.get(name), "third");
+  }
+  BOOST_CHECK(not EnvironmentSnapshot::hasKey(name));
+
+  // the raw modifications are only seen after a refresh
+  ::setenv(name.c_str(), "raw", 1);
+  BOOST_CHECK(not EnvironmentSnapshot::hasKey(name));
+  EnvironmentSnapshot::refresh();
+  BOOST_CHECK_EQUAL(EnvironmentSnapshot::get(name), "raw");
+  ::unsetenv(name.c_str());
+  EnvironmentSnapshot::refresh();
+  BOOST_CHECK(not EnvironmentSnapshot::hasKey(name));
+}
+
+BOOST_AUTO_TEST_CASE(RawChange_test) {
+
+  const string name{"Pq8dh3kxm2Ta"};
+
+  // System::getEnv reads the process environment, the Environment class reads the snapshot
+  ::setenv(name.c_str(), "raw", 1);
+  BOOST_CHECK(System::isEnvSet(name));
+  BOOST_CHECK_EQUAL(System::getEnv(name), "raw");
+  BOOST_CHECK(not Environment::hasKey(name));
+  EnvironmentSnapshot::refresh();
+  BOOST_CHECK_EQUAL(Environment().get(name), "raw");
+
+  // the value to restore is read from the process environment
+  ::setenv(name.c_str(), "newer raw", 1);
+  {
+    Environment env;
+    env[name] = "changed";
+    BOOST_CHECK_EQUAL(System::getEnv(name), "changed");
+    BOOST_CHECK_EQUAL(Environment().get(name), "changed");
+  }
+  BOOST_CHECK_EQUAL(System::getEnv(name), "newer raw");
+  BOOST_CHECK_EQUAL(Environment().get(name), "newer raw");
+
+  System::unSetEnv(name);
+  BOOST_CHECK(std::getenv(name.c_str()) == nullptr);
+  BOOST_CHECK(not System::isEnvSet(name));
+  BOOST_CHECK(not Environment::hasKey(name));
+}
+
+BOOST_AUTO_TEST_CASE(Concurrency_test) {
+
+  // the readers must always see a consistent value while the writer changes it
+  const string     name{"Lsk3jd8ahx7d"};
+  constexpr size_t update_number{500};
+  constexpr size_t reader_number{8};
+
+  System::setEnv(name, "0:0");
+
+  std::atomic<bool>   done{false};
+  std::atomic<size_t> errors{0};
+  std::atomic<size_t> reads{0};
+
+  std::vector<std::thread> readers;
+  for (size_t t = 0; t < reader_number; ++t) {
+    readers.emplace_back([&name, &done, &errors, &reads]() {
+      string value;
+      while (not done) {
+        if (not EnvironmentSnapshot::lookup(name, value)) {
+          continue;
+        }
+        // both halves are written together
+        const auto separator = value.find(':');
+        if (separator == string::npos or value.substr(0, separator) != value.substr(separator + 1)) {
+          ++errors;
+        }
+        ++reads;
+      }
+    });
+  }
+
+  // the updates start once the readers are running
+  while (reads.load() == 0) {
+    std::this_thread::yield();
+  }
+
+  for (size_t i = 1; i <= update_number; ++i) {
+    const string counter = std::to_string(i);
+    if (i % 10 == 0) {
+      System::unSetEnv(name);
+    } else {
+      System::setEnv(name, counter + ":" + counter);
+    }
+  }
+
+  done = true;
+  for (auto& t : readers) {
+    t.join();
+  }
+
+  System::unSetEnv(name);
+
+  BOOST_CHECK_EQUAL(errors.load(), 0);
+  BOOST_CHECK(reads.load() > 0);
+  BOOST_CHECK(not EnvironmentSnapshot::hasKey(name));
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
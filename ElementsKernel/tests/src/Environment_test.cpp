@@ -21,6 +21,7 @@
 
 #include "ElementsKernel/Environment.h"  // for Environment
 
+#include <cstddef>    // for size_t
 #include <iostream>   // for interactive testing
 #include <stdexcept>  // for out_of_range
 #include <string>
@@ -369,6 +370,80 @@ BOOST_AUTO_TEST_CASE(CheckCommit_test) {
   BOOST_CHECK(getEnv("dkdd") == "beta");
 }
 
+BOOST_AUTO_TEST_CASE(Overlay_test) {
+
+  const string var_name{"Kdj3dmslqp7"};
+  const string original_path = getEnv("PATH");
+
+  {
+    Environment local{Environment::overlay};
+
+    BOOST_CHECK(local.mode() == Environment::overlay);
+
+    local[var_name] = "toto";
+    local["PATH"] += ":ddgfhdf";
+
+    // only the overlay sees the changes
+    BOOST_CHECK_EQUAL(local[var_name].value(), "toto");
+    BOOST_CHECK(local[var_name].exists());
+    BOOST_CHECK_EQUAL(local["PATH"].value(), original_path + ":ddgfhdf");
+    BOOST_CHECK(not isEnvSet(var_name));
+    BOOST_CHECK_EQUAL(getEnv("PATH"), original_path);
+
+    local.unSet("PATH");
+    BOOST_CHECK(not local["PATH"].exists());
+    BOOST_CHECK(isEnvSet("PATH"));
+    BOOST_CHECK_THROW(local.unSet("PATH"), std::out_of_range);
+
+    BOOST_CHECK(local.generateScript(Environment::sh).find("unset PATH") != string::npos);
+  }
+
+  BOOST_CHECK(not isEnvSet(var_name));
+  BOOST_CHECK_EQUAL(getEnv("PATH"), original_path);
+}
+
+BOOST_AUTO_TEST_CASE(OverlayBlock_test) {
+
+  const string var_name{"Kdj3dmslqp8"};
+
+  Environment local{Environment::overlay};
+  local[var_name] = "toto";
+  local.unSet("PATH");
+
+  const auto block = local.block();
+  const auto envp  = block.envp();
+
+  bool        found = false;
+  std::size_t count = 0;
+  for (; envp[count] != nullptr; ++count) {
+    const string entry{envp[count]};
+    BOOST_CHECK(entry.compare(0, 5, "PATH=") != 0);
+    found = found or entry == var_name + "=toto";
+  }
+
+  BOOST_CHECK(found);
+  BOOST_CHECK_EQUAL(count, block.entries().size());
+}
+
+BOOST_AUTO_TEST_CASE(OverlayCommit_test) {
+
+  const string var_name{"Kdj3dmslqp9"};
+
+  {
+    Environment local{Environment::overlay};
+    local[var_name] = "alpha";
+    BOOST_CHECK(not isEnvSet(var_name));
+    local.commit();
+    BOOST_CHECK_EQUAL(getEnv(var_name), "alpha");
+    BOOST_CHECK_EQUAL(local[var_name].value(), "alpha");
+  }
+
+  // the committed changes are kept
+  BOOST_CHECK_EQUAL(getEnv(var_name), "alpha");
+
+  unSetEnv(var_name);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 //-----------------------------------------------------------------------------
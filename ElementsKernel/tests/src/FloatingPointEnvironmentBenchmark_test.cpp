@@ -0,0 +1,110 @@
+/**
+ * @file FloatingPointEnvironmentBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/FloatingPointEnvironment.h"
+
+#include <cstddef>   // for size_t
+#include <iomanip>   // for setprecision
+#include <iostream>  // for cout
+#include <limits>    // for numeric_limits
+#include <vector>    // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "Benchmark.h"  // for nanoSecondsPerCall
+
+using std::size_t;
+
+namespace Elements {
+
+using Benchmark::nanoSecondsPerCall;
+
+namespace {
+
+constexpr size_t element_number{1 << 12};
+constexpr size_t iterations{1 << 10};
+
+/**
+ * A damped recursion whose values decay into the denormal range and
+ * stay there: every multiplication has a denormal operand and result.
+ */
+double denormalLoop(std::vector<double>& values, double& nanoseconds_per_operation) {
+
+  const double start_value = std::numeric_limits<double>::min() * 64.0;
+  for (auto& v : values) {
+    v = start_value;
+  }
+
+  const double pass_time = nanoSecondsPerCall(iterations, [&values, start_value](size_t) {
+    for (auto& v : values) {
+      v = v * 0.9375 + start_value * 1.0e-10;
+    }
+  });
+  nanoseconds_per_operation = pass_time / static_cast<double>(element_number);
+
+  double sum = 0.0;
+  for (const auto v : values) {
+    sum += v;
+  }
+  return sum;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(FloatingPointEnvironmentBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(DenormalSpeedup_test) {
+
+  std::vector<double> values(element_number);
+
+  double denormal_time = 0.0;
+  double flushed_time  = 0.0;
+
+  const double denormal_sum = denormalLoop(values, denormal_time);
+  double       flushed_sum  = 0.0;
+  {
+    FloatingPointEnvironmentGuard guard{FloatingPointEnvironment::fromString("denormals")};
+    flushed_sum = denormalLoop(values, flushed_time);
+  }
+
+  std::cout << std::fixed << std::setprecision(2) << "denormal loop: " << denormal_time
+            << " ns/op, with flush-to-zero: " << flushed_time << " ns/op (speedup: " << denormal_time / flushed_time
+            << ")" << std::endl;
+
+  // the loop converges to a denormal value, which is flushed to zero with FTZ/DAZ
+  BOOST_CHECK(denormal_sum > 0.0);
+  BOOST_CHECK(denormal_sum < std::numeric_limits<double>::min());
+  if (hasDenormalControl()) {
+    BOOST_CHECK(flushed_sum <= 0.0);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,132 @@
+/**
+ * @file FloatingPointEnvironment_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/FloatingPointEnvironment.h"  // The interface to test
+
+#include <cfenv>   // for FE_INVALID, FE_DIVBYZERO, FE_OVERFLOW
+#include <limits>  // for numeric_limits
+#include <thread>  // for thread
+
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Exception.h"  // for Exception
+
+namespace Elements {
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_SUITE(FloatingPointEnvironment_test)
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(FromString_test) {
+
+  auto env = FloatingPointEnvironment::fromString("denormals, invalid,divbyzero");
+  BOOST_CHECK(env.flushToZero());
+  BOOST_CHECK(env.denormalsAreZero());
+  BOOST_CHECK_EQUAL(env.traps(), FE_INVALID | FE_DIVBYZERO);
+  BOOST_CHECK_EQUAL(env.toString(), "ftz,daz,invalid,divbyzero");
+
+  auto traps = FloatingPointEnvironment::fromString("ftz,traps");
+  BOOST_CHECK(traps.flushToZero());
+  BOOST_CHECK(not traps.denormalsAreZero());
+  BOOST_CHECK_EQUAL(traps.traps(), FE_INVALID | FE_DIVBYZERO | FE_OVERFLOW);
+
+  auto read_back = FloatingPointEnvironment::fromString(traps.toString());
+  BOOST_CHECK_EQUAL(read_back.toString(), traps.toString());
+
+  BOOST_CHECK_EQUAL(FloatingPointEnvironment::fromString("default").toString(), "default");
+  BOOST_CHECK_EQUAL(FloatingPointEnvironment::fromString("").toString(), "default");
+
+  BOOST_CHECK_THROW(FloatingPointEnvironment::fromString("ftz,fast"), Exception);
+}
+
+BOOST_AUTO_TEST_CASE(FlushToZero_test) {
+
+  const bool initial_ftz = isFlushToZero();
+  const bool initial_daz = isDenormalsAreZero();
+
+  volatile double smallest = std::numeric_limits<double>::min();
+
+  {
+    FloatingPointEnvironmentGuard guard{FloatingPointEnvironment{true, true}};
+    if (hasDenormalControl()) {
+      BOOST_CHECK(isFlushToZero());
+      BOOST_CHECK(isDenormalsAreZero());
+      // the result would be a denormal number
+      volatile double result = smallest / 4.0;
+      BOOST_CHECK(result <= 0.0);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(isFlushToZero(), initial_ftz);
+  BOOST_CHECK_EQUAL(isDenormalsAreZero(), initial_daz);
+
+  if (not initial_ftz) {
+    volatile double result = smallest / 4.0;
+    BOOST_CHECK(result > 0.0);
+  }
+
+  const bool previous = setFlushToZero(true);
+  BOOST_CHECK_EQUAL(previous, initial_ftz);
+  BOOST_CHECK_EQUAL(setFlushToZero(initial_ftz), hasDenormalControl());
+}
+
+BOOST_AUTO_TEST_CASE(Traps_test) {
+
+  const int initial_traps = floatingPointTraps();
+
+  if (initial_traps >= 0) {
+    {
+      FloatingPointEnvironmentGuard guard{FloatingPointEnvironment{false, false, FE_DIVBYZERO | FE_INVALID}};
+      BOOST_CHECK_EQUAL(floatingPointTraps(), FE_DIVBYZERO | FE_INVALID);
+      BOOST_CHECK_EQUAL(FloatingPointEnvironment::current().traps(), FE_DIVBYZERO | FE_INVALID);
+    }
+    BOOST_CHECK_EQUAL(floatingPointTraps(), initial_traps);
+
+    const int previous = enableFloatingPointTraps(FE_OVERFLOW);
+    BOOST_CHECK_EQUAL(previous, initial_traps);
+    BOOST_CHECK((floatingPointTraps() & FE_OVERFLOW) != 0);
+    disableFloatingPointTraps(FE_OVERFLOW);
+    BOOST_CHECK_EQUAL(floatingPointTraps(), initial_traps);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ThreadInheritance_test) {
+
+  FloatingPointEnvironmentGuard guard{FloatingPointEnvironment{true, true}};
+
+  bool thread_ftz = false;
+  bool thread_daz = false;
+
+  std::thread worker([&thread_ftz, &thread_daz]() {
+    thread_ftz = isFlushToZero();
+    thread_daz = isDenormalsAreZero();
+  });
+  worker.join();
+
+  BOOST_CHECK_EQUAL(thread_ftz, isFlushToZero());
+  BOOST_CHECK_EQUAL(thread_daz, isDenormalsAreZero());
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,146 @@
+/**
+ * @file Hardware_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/Hardware.h"  // header to test
+
+#include <unistd.h>  // for sysconf
+
+#include <algorithm>  // for find
+#include <cstddef>    // for size_t
+#include <set>        // for set
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/SystemInfo.h"  // for systemInfo
+
+using std::size_t;
+
+namespace Elements {
+
+using System::cpuTopology;
+
+BOOST_AUTO_TEST_SUITE(Hardware_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Topology_test) {
+
+  const auto& topology = cpuTopology();
+
+  BOOST_CHECK_EQUAL(&cpuTopology(), &topology);
+  BOOST_CHECK_EQUAL(topology.logicalCpuNumber(), static_cast<size_t>(::sysconf(_SC_NPROCESSORS_ONLN)));
+  BOOST_CHECK(topology.core_number >= 1);
+  BOOST_CHECK(topology.core_number <= topology.logicalCpuNumber());
+  BOOST_CHECK(topology.package_number >= 1);
+  BOOST_CHECK(topology.package_number <= topology.core_number);
+  BOOST_CHECK(topology.threadsPerCore() >= 1);
+
+  std::set<size_t> ids;
+  for (const auto& c : topology.cpus) {
+    ids.insert(c.id);
+  }
+  BOOST_CHECK_EQUAL(ids.size(), topology.cpus.size());
+}
+
+BOOST_AUTO_TEST_CASE(Caches_test) {
+
+  const auto& topology = cpuTopology();
+
+  for (const auto& c : topology.caches) {
+    BOOST_CHECK(c.level >= 1);
+    BOOST_CHECK(c.size > 0);
+  }
+
+  const auto l1 = topology.dataCache(1);
+  const auto l2 = topology.dataCache(2);
+  if (l1 != nullptr and l2 != nullptr) {
+    BOOST_CHECK(l1->type != System::CacheType::Instruction);
+    BOOST_CHECK(l2->size >= l1->size);
+    BOOST_CHECK_EQUAL(System::systemInfo().l1_data_cache_size, l1->size);
+  }
+  BOOST_CHECK(topology.dataCache(100) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(NumaNodes_test) {
+
+  const auto& topology = cpuTopology();
+
+  BOOST_REQUIRE(not topology.numa_nodes.empty());
+  BOOST_CHECK_EQUAL(System::systemInfo().numa_node_number, topology.numa_nodes.size());
+
+  // every processor belongs to one of the nodes
+  for (const auto& c : topology.cpus) {
+    bool found = false;
+    for (const auto& n : topology.numa_nodes) {
+      found = found or (n.id == c.numa_node and std::find(n.cpus.begin(), n.cpus.end(), c.id) != n.cpus.end());
+    }
+    BOOST_CHECK(found);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InstructionSets_test) {
+
+  using System::SimdFeature;
+  using System::simdFeatures;
+
+  const auto& topology = cpuTopology();
+
+  BOOST_CHECK_EQUAL(System::systemInfo().simd_features, topology.isa_features);
+  BOOST_CHECK(topology.hasFeatures(0));
+
+#if defined(__x86_64__)
+  BOOST_CHECK(topology.hasFeatures(simdFeatures(SimdFeature::SSE2)));
+  BOOST_CHECK(not topology.vendor.empty());
+#endif
+
+  // AVX2 needs the AVX register state, and the AVX-512 extensions the foundation
+  if (topology.hasFeatures(simdFeatures(SimdFeature::AVX2))) {
+    BOOST_CHECK(topology.hasFeatures(simdFeatures(SimdFeature::AVX)));
+  }
+  if (topology.hasFeatures(simdFeatures(SimdFeature::AVX512BW))) {
+    BOOST_CHECK(topology.hasFeatures(simdFeatures(SimdFeature::AVX512F, SimdFeature::AVX)));
+  }
+
+  // the builtin detection of the compiler agrees
+#if defined(__x86_64__) and defined(__GNUC__)
+  __builtin_cpu_init();
+  BOOST_CHECK_EQUAL(topology.hasFeatures(simdFeatures(SimdFeature::AVX2)), __builtin_cpu_supports("avx2") != 0);
+  BOOST_CHECK_EQUAL(topology.hasFeatures(simdFeatures(SimdFeature::SSE4_2)), __builtin_cpu_supports("sse4.2") != 0);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(ThreadNumber_test) {
+
+  const auto cpus = System::availableCpus();
+  BOOST_REQUIRE(not cpus.empty());
+
+  const auto thread_number = System::recommendedThreadNumber();
+  BOOST_CHECK(thread_number >= 1);
+  BOOST_CHECK(thread_number <= cpus.size());
+  BOOST_CHECK(thread_number <= cpuTopology().core_number);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,170 @@
+/**
+ * @file MappedFile_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/MappedFile.h"  // header to test
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uintptr_t
+#include <memory>   // for shared_ptr
+#include <string>   // for string
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_symlink, rename
+#include <boost/test/unit_test.hpp>         // for boost unit test macros
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Path.h"       // for Path::Item
+#include "ElementsKernel/Temporary.h"  // for TempDir
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Path::Item;
+
+namespace {
+
+string fileContent(size_t size) {
+  string content(size, ' ');
+  for (size_t i = 0; i < size; ++i) {
+    content[i] = static_cast<char>('a' + i % 26);
+  }
+  return content;
+}
+
+void writeFile(const Item& file_path, const string& content) {
+  boost::filesystem::ofstream ofs(file_path, std::ios::binary);
+  ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+}  // namespace
+
+struct MappedFile_Fixture {
+
+  TempDir m_top_dir{"MappedFile_test-%%%%%%%"};
+  Item    m_small_file{m_top_dir.path() / "small.txt"};
+  Item    m_large_file{m_top_dir.path() / "large.bin"};
+  string  m_small_content{fileContent(1000)};
+  string  m_large_content{fileContent(2 * HUGE_PAGE_SIZE + 123)};
+
+  MappedFile_Fixture() {
+    writeFile(m_small_file, m_small_content);
+    writeFile(m_large_file, m_large_content);
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(MappedFile_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(Content_test, MappedFile_Fixture) {
+
+  MappedFile small_mapping(m_small_file);
+
+  BOOST_CHECK_EQUAL(small_mapping.path(), m_small_file);
+  BOOST_CHECK_EQUAL(small_mapping.size(), m_small_content.size());
+  BOOST_CHECK_EQUAL(string(small_mapping.data(), small_mapping.size()), m_small_content);
+  BOOST_CHECK(not small_mapping.hugePages());
+
+  // the large mappings are aligned on the huge pages
+  MappedFile large_mapping(m_large_file);
+
+  BOOST_CHECK_EQUAL(large_mapping.size(), m_large_content.size());
+  BOOST_CHECK(string(large_mapping.data(), large_mapping.size()) == m_large_content);
+  if (large_mapping.hugePages()) {
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(large_mapping.data()) % HUGE_PAGE_SIZE, 0);
+  }
+
+  const Item empty_file = m_top_dir.path() / "empty.txt";
+  writeFile(empty_file, "");
+
+  MappedFile empty_mapping(empty_file);
+  BOOST_CHECK(empty_mapping.empty());
+  BOOST_CHECK(empty_mapping.data() == nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(Errors_test, MappedFile_Fixture) {
+
+  BOOST_CHECK_THROW(MappedFile(m_top_dir.path() / "missing.txt"), Exception);
+  BOOST_CHECK_THROW(MappedFile(m_top_dir.path()), Exception);
+  BOOST_CHECK_THROW(MappedFile::get(m_top_dir.path() / "missing.txt"), Exception);
+}
+
+BOOST_FIXTURE_TEST_CASE(Registry_test, MappedFile_Fixture) {
+
+  const size_t initial_size = MappedFile::registrySize();
+
+  auto mapping = MappedFile::get(m_small_file);
+  BOOST_CHECK_EQUAL(MappedFile::get(m_small_file), mapping);
+  BOOST_CHECK_EQUAL(MappedFile::registrySize(), initial_size + 1);
+
+  // the same file through another path
+  const Item link = m_top_dir.path() / "link.txt";
+  boost::filesystem::create_symlink(m_small_file, link);
+  BOOST_CHECK_EQUAL(MappedFile::get(link), mapping);
+
+  // a replaced file is mapped again. The former mapping is still valid.
+  const Item new_file = m_top_dir.path() / "new.txt";
+  writeFile(new_file, "new content");
+  boost::filesystem::rename(new_file, m_small_file);
+
+  auto new_mapping = MappedFile::get(m_small_file);
+  BOOST_CHECK(new_mapping != mapping);
+  BOOST_CHECK_EQUAL(string(new_mapping->data(), new_mapping->size()), "new content");
+  BOOST_CHECK_EQUAL(string(mapping->data(), mapping->size()), m_small_content);
+
+  // the mappings are released with their last user
+  mapping.reset();
+  new_mapping.reset();
+  BOOST_CHECK_EQUAL(MappedFile::registrySize(), initial_size);
+}
+
+BOOST_FIXTURE_TEST_CASE(Concurrency_test, MappedFile_Fixture) {
+
+  constexpr size_t thread_number{8};
+
+  vector<std::shared_ptr<const MappedFile>> mappings(thread_number);
+  vector<std::thread>                       threads;
+
+  for (size_t t = 0; t < thread_number; ++t) {
+    threads.emplace_back([this, t, &mappings]() {
+      mappings[t] = MappedFile::get(m_large_file);
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (const auto& m : mappings) {
+    BOOST_CHECK_EQUAL(m, mappings[0]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------
+
+}  // namespace Elements
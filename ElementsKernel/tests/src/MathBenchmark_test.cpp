@@ -0,0 +1,291 @@
+/**
+ * @file MathBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include <algorithm>  // for transform
+#include <cmath>      // for llround
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int64_t, uint64_t
+#include <cstdlib>    // for getenv
+#include <fstream>    // for ofstream
+#include <iomanip>    // for setprecision
+#include <iostream>   // for cout
+#include <string>     // for string
+#include <vector>     // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Number.h"   // for numberCast
+#include "ElementsKernel/Real.h"     // for isEqual, almostEqual2sComplement
+#include "ElementsKernel/Storage.h"  // for storageConvert
+
+#include "Benchmark.h"  // for nanoSecondsPerCall
+
+using std::int64_t;
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Benchmark::nanoSecondsPerCall;
+
+namespace {
+
+/// number of calls for the scalar measurements
+constexpr size_t iterations{1 << 20};
+/// size of the arrays for the bulk measurements
+constexpr size_t element_number{1 << 12};
+/// number of passes over the arrays for the bulk measurements
+constexpr size_t repetitions{1 << 8};
+
+/// environment variable giving the name of the JSON output file
+const string JSON_OUTPUT_VARIABLE{"ELEMENTS_MATH_BENCHMARK_OUTPUT"};
+const string JSON_OUTPUT_DEFAULT{"MathBenchmark.json"};
+
+struct Measurement {
+  string name;
+  double scalar;
+  double bulk;
+};
+
+vector<Measurement>& measurements() {
+  static vector<Measurement> all_measurements;
+  return all_measurements;
+}
+
+void record(const string& name, double scalar, double bulk) {
+  measurements().push_back(Measurement{name, scalar, bulk});
+  std::cout << std::fixed << std::setprecision(3) << name << ": " << scalar << " ns/op (scalar), " << bulk
+            << " ns/op (bulk)" << std::endl;
+}
+
+/// time a function called on each index
+template <typename F>
+double scalarTime(F&& func) {
+  return nanoSecondsPerCall(iterations, [&func](size_t i) {
+    func(i % element_number);
+  });
+}
+
+/// time a function processing the whole arrays, per element
+template <typename F>
+double bulkTime(F&& func) {
+  const double pass_time = nanoSecondsPerCall(repetitions, [&func](size_t) {
+    func();
+  });
+  return pass_time / static_cast<double>(element_number);
+}
+
+/// pseudo-random values and the same values shifted by a few ULPs for every other element
+template <typename T>
+void fillValues(vector<T>& left, vector<T>& right) {
+  left.resize(element_number);
+  right.resize(element_number);
+  std::uint64_t state = 1;
+  for (size_t i = 0; i < element_number; ++i) {
+    state    = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    left[i]  = static_cast<T>(static_cast<double>(state >> 11) / static_cast<double>(1ULL << 33));
+    right[i] = (i % 2 == 0) ? left[i] : left[i] * static_cast<T>(1.001);
+  }
+}
+
+/// writes the measurements as JSON when the test program ends
+struct JsonWriter {
+  ~JsonWriter() {
+    const char*  env_file_name = std::getenv(JSON_OUTPUT_VARIABLE.c_str());
+    const string file_name     = (env_file_name != nullptr) ? string{env_file_name} : JSON_OUTPUT_DEFAULT;
+
+    std::ofstream output{file_name};
+    output << std::fixed << std::setprecision(3) << "{\n"
+           << "  \"benchmark\": \"MathBenchmark\",\n"
+           << "  \"unit\": \"ns/op\",\n"
+           << "  \"results\": [";
+    const auto& all_measurements = measurements();
+    for (size_t i = 0; i < all_measurements.size(); ++i) {
+      output << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << all_measurements[i].name
+             << "\", \"scalar\": " << all_measurements[i].scalar << ", \"bulk\": " << all_measurements[i].bulk
+             << "}";
+    }
+    output << "\n  ]\n}\n";
+  }
+};
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_TEST_GLOBAL_FIXTURE(JsonWriter);
+
+BOOST_AUTO_TEST_SUITE(MathBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(IsEqual_test) {
+
+  vector<double> left;
+  vector<double> right;
+  fillValues(left, right);
+
+  size_t scalar_count = 0;
+  size_t bulk_count   = 0;
+
+  const double scalar = scalarTime([&](size_t i) {
+    scalar_count += isEqual(left[i], right[i]) ? 1 : 0;
+  });
+  const double bulk = bulkTime([&]() {
+    for (size_t i = 0; i < element_number; ++i) {
+      bulk_count += isEqual(left[i], right[i]) ? 1 : 0;
+    }
+  });
+
+  record("isEqual<double>", scalar, bulk);
+
+  // half of the pairs are equal
+  BOOST_CHECK_EQUAL(scalar_count, iterations / 2);
+  BOOST_CHECK_EQUAL(bulk_count, repetitions * element_number / 2);
+}
+
+BOOST_AUTO_TEST_CASE(AlmostEqual2sComplement_test) {
+
+  vector<float> float_left;
+  vector<float> float_right;
+  fillValues(float_left, float_right);
+  vector<double> double_left;
+  vector<double> double_right;
+  fillValues(double_left, double_right);
+
+  size_t scalar_count = 0;
+  size_t bulk_count   = 0;
+
+  double scalar = scalarTime([&](size_t i) {
+    scalar_count += almostEqual2sComplement(float_left[i], float_right[i], 4) ? 1 : 0;
+  });
+  double bulk = bulkTime([&]() {
+    for (size_t i = 0; i < element_number; ++i) {
+      bulk_count += almostEqual2sComplement(float_left[i], float_right[i], 4) ? 1 : 0;
+    }
+  });
+
+  record("almostEqual2sComplement<float>", scalar, bulk);
+
+  BOOST_CHECK_EQUAL(scalar_count, iterations / 2);
+  BOOST_CHECK_EQUAL(bulk_count, repetitions * element_number / 2);
+
+  scalar_count = 0;
+  bulk_count   = 0;
+
+  scalar = scalarTime([&](size_t i) {
+    scalar_count += almostEqual2sComplement(double_left[i], double_right[i], 4) ? 1 : 0;
+  });
+  bulk = bulkTime([&]() {
+    for (size_t i = 0; i < element_number; ++i) {
+      bulk_count += almostEqual2sComplement(double_left[i], double_right[i], 4) ? 1 : 0;
+    }
+  });
+
+  record("almostEqual2sComplement<double>", scalar, bulk);
+
+  BOOST_CHECK_EQUAL(scalar_count, iterations / 2);
+  BOOST_CHECK_EQUAL(bulk_count, repetitions * element_number / 2);
+}
+
+BOOST_AUTO_TEST_CASE(NumberCast_test) {
+
+  vector<double> values;
+  vector<double> unused;
+  fillValues(values, unused);
+  vector<int64_t> results(element_number);
+
+  int64_t scalar_sum = 0;
+
+  const double scalar = scalarTime([&](size_t i) {
+    scalar_sum += numberCast<int64_t>(values[i]);
+  });
+  const double bulk = bulkTime([&]() {
+    std::transform(values.cbegin(), values.cend(), results.begin(), [](const double& value) {
+      return numberCast<int64_t>(value);
+    });
+  });
+
+  record("numberCast<int64_t>(double)", scalar, bulk);
+
+  for (size_t i = 0; i < element_number; ++i) {
+    BOOST_CHECK_EQUAL(results[i], std::llround(values[i]));
+  }
+  BOOST_CHECK(scalar_sum > 0);
+}
+
+BOOST_AUTO_TEST_CASE(StorageConvert_test) {
+
+  using Kernel::Units::storageConvert;
+  using Kernel::Units::StorageType;
+
+  vector<double> values;
+  vector<double> unused;
+  fillValues(values, unused);
+  vector<int64_t> sizes(element_number);
+  std::transform(values.cbegin(), values.cend(), sizes.begin(), [](const double& value) {
+    return static_cast<int64_t>(value * 1024.0);
+  });
+  vector<int64_t> results(element_number);
+
+  int64_t scalar_sum = 0;
+
+  double scalar = scalarTime([&](size_t i) {
+    scalar_sum += storageConvert(sizes[i], StorageType::Byte, StorageType::MegaByte);
+  });
+  double bulk = bulkTime([&]() {
+    std::transform(sizes.cbegin(), sizes.cend(), results.begin(), [](const int64_t& size) {
+      return storageConvert(size, StorageType::Byte, StorageType::MegaByte);
+    });
+  });
+
+  record("storageConvert<int64_t>", scalar, bulk);
+
+  BOOST_CHECK_EQUAL(results[0], storageConvert(sizes[0], StorageType::Byte, StorageType::MegaByte));
+  BOOST_CHECK(scalar_sum > 0);
+
+  vector<double> double_results(element_number);
+  double         double_sum = 0.0;
+
+  scalar = scalarTime([&](size_t i) {
+    double_sum += storageConvert(values[i], StorageType::MegaByte, StorageType::MetricGigaByte);
+  });
+  bulk = bulkTime([&]() {
+    std::transform(values.cbegin(), values.cend(), double_results.begin(), [](const double& value) {
+      return storageConvert(value, StorageType::MegaByte, StorageType::MetricGigaByte);
+    });
+  });
+
+  record("storageConvert<double>", scalar, bulk);
+
+  BOOST_CHECK(
+      isEqual(double_results[0], storageConvert(values[0], StorageType::MegaByte, StorageType::MetricGigaByte)));
+  BOOST_CHECK(double_sum > 0.0);
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
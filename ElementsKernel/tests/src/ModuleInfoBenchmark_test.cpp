@@ -0,0 +1,124 @@
+/**
+ * @file ModuleInfoBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/ModuleInfo.h"
+
+#include <cstddef>  // for size_t
+#include <fstream>  // for ifstream
+#include <sstream>  // for istringstream
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include <boost/filesystem/operations.hpp>  // for exists
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Path.h"  // for Path::Item
+
+#include "Benchmark.h"  // for microSecondsPerCall, report
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+using Benchmark::microSecondsPerCall;
+using Benchmark::report;
+
+namespace {
+
+constexpr size_t iterations{1 << 10};
+
+/// the former implementation, which parses /proc/self/maps and checks each file
+std::vector<Path::Item> legacyLinkedModulePaths() {
+
+  std::vector<Path::Item> linked_modules;
+
+  std::ifstream maps_str("/proc/self/maps");
+
+  string line;
+  while (std::getline(maps_str, line)) {
+    string             address;
+    string             perms;
+    string             offset;
+    string             dev;
+    string             pathname;
+    unsigned           inode;
+    std::istringstream iss(line);
+    if (not(iss >> address >> perms >> offset >> dev >> inode >> pathname)) {
+      continue;
+    }
+    if (perms == "r-xp" and boost::filesystem::exists(pathname)) {
+      linked_modules.emplace_back(Path::Item(pathname));
+    }
+  }
+
+  return linked_modules;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(ModuleInfoBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(LinkedModulePaths_test) {
+
+  size_t count     = 0;
+  size_t reference = 0;
+
+  const double new_time = microSecondsPerCall(iterations, [&count](size_t) {
+    count += System::linkedModulePaths().size();
+  });
+  const double entries_time = microSecondsPerCall(iterations, [&count](size_t) {
+    count -= System::linkedModuleEntries().size();
+  });
+  const double old_time = microSecondsPerCall(iterations, [&reference](size_t) {
+    reference += legacyLinkedModulePaths().size();
+  });
+
+  report("linkedModulePaths", new_time, old_time, "us");
+  report("linkedModuleEntries", entries_time, old_time, "us");
+
+  BOOST_CHECK_EQUAL(count, 0);
+  BOOST_CHECK(reference > 0);
+
+  // the same modules are found
+  const auto paths        = System::linkedModulePaths();
+  const auto legacy_paths = legacyLinkedModulePaths();
+  for (const auto& p : legacy_paths) {
+    bool found = false;
+    for (const auto& n : paths) {
+      found = found or boost::filesystem::equivalent(p, n);
+    }
+    BOOST_CHECK_MESSAGE(found, p.string() << " is not listed");
+  }
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -21,10 +21,15 @@
 
 #include "ElementsKernel/ModuleInfo.h"  // header file to test
 
+#include <dlfcn.h>   // for dlopen, dlclose
 #include <libgen.h>  // for basename
 
+#include <algorithm>  // for find_if
+#include <cstddef>    // for size_t
 #include <iostream>
 #include <string>
+#include <thread>  // for thread
+#include <vector>  // for vector
 
 #include <boost/test/unit_test.hpp>  // for the boost test macros
 
@@ -118,6 +123,78 @@ BOOST_AUTO_TEST_CASE(linkedModulePaths_test) {
   BOOST_CHECK(linked_module_path.size() > 0);
 }
 
+BOOST_AUTO_TEST_CASE(linkedModuleEntries_test) {
+
+  const auto modules = System::linkedModuleEntries();
+  BOOST_REQUIRE(not modules.empty());
+
+  // the first one is the executable
+  BOOST_CHECK_EQUAL(modules.front().path, System::getExecutablePath().string());
+
+  // the code of this library is within its segments
+  const auto address = reinterpret_cast<const char*>(&System::linkedModuleEntries);
+  const auto kernel  = std::find_if(modules.begin(), modules.end(), [address](const System::LinkedModule& m) {
+    return address >= static_cast<const char*>(m.address) and address < static_cast<const char*>(m.address) + m.size;
+  });
+  BOOST_REQUIRE(kernel != modules.end());
+  BOOST_CHECK(kernel->path.find("libElementsKernel") != string::npos);
+  if (not kernel->build_id.empty()) {
+    BOOST_CHECK_EQUAL(kernel->build_id.find_first_not_of("0123456789abcdef"), string::npos);
+    BOOST_CHECK_EQUAL(kernel->build_id.size() % 2, 0);
+  }
+
+  BOOST_CHECK_EQUAL(System::linkedModules().size(), modules.size());
+  BOOST_CHECK_EQUAL(System::linkedModulePaths().size(), modules.size());
+}
+
+BOOST_AUTO_TEST_CASE(linkedModulesReload_test) {
+
+  auto hasResolv = [](const std::vector<string>& modules) {
+    return std::find_if(modules.begin(), modules.end(), [](const string& m) {
+             return m.find("libresolv") != string::npos;
+           }) != modules.end();
+  };
+
+  const auto before = System::linkedModules();
+  if (hasResolv(before)) {
+    return;
+  }
+
+  void* handle = ::dlopen("libresolv.so.2", RTLD_LAZY | RTLD_LOCAL);
+  if (handle == nullptr) {
+    return;
+  }
+
+  // the cache follows the loader
+  const auto after = System::linkedModules();
+  BOOST_CHECK(hasResolv(after));
+  BOOST_CHECK_EQUAL(after.size(), before.size() + 1);
+
+  ::dlclose(handle);
+}
+
+BOOST_AUTO_TEST_CASE(linkedModulesThreads_test) {
+
+  const auto reference = System::linkedModules();
+
+  std::vector<std::size_t> sizes(4, 0);
+  std::vector<std::thread> threads;
+  for (auto& s : sizes) {
+    threads.emplace_back([&s]() {
+      for (std::size_t i = 0; i < 100; ++i) {
+        s = System::linkedModules().size();
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (const auto s : sizes) {
+    BOOST_CHECK_EQUAL(s, reference.size());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 //-----------------------------------------------------------------------------
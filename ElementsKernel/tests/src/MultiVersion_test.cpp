@@ -0,0 +1,118 @@
+/**
+ * @file MultiVersion_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/MultiVersion.h"  // header to test
+
+#include <cstddef>  // for size_t
+#include <numeric>  // for iota
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Hardware.h"   // for cpuTopology
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+using System::MultiVersion;
+using System::SimdFeature;
+using System::simdFeatures;
+
+namespace {
+
+#if defined(__x86_64__) and defined(__GNUC__)
+__attribute__((target("avx2,fma"))) double sumAvx2(const double* data, size_t size) {
+  double sum = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    sum += data[i];
+  }
+  return sum;
+}
+#endif
+
+double sumDefault(const double* data, size_t size) {
+  double sum = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    sum += data[i];
+  }
+  return sum;
+}
+
+double sumNothing(const double*, size_t) {
+  return -1.0;
+}
+
+using Sum = MultiVersion<double(const double*, size_t)>;
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MultiVersion_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Selection_test) {
+
+  const Sum::Version avx512{simdFeatures(SimdFeature::AVX512F), sumNothing, "avx512"};
+  const Sum::Version avx2{simdFeatures(SimdFeature::AVX2, SimdFeature::FMA), sumNothing, "avx2"};
+  const Sum::Version fallback{0, sumDefault, "default"};
+
+  BOOST_CHECK_EQUAL(string(Sum({avx512, avx2, fallback}, 0).selected().name), "default");
+  BOOST_CHECK_EQUAL(string(Sum({avx512, avx2, fallback}, simdFeatures(SimdFeature::AVX2)).selected().name),
+                    "default");
+  BOOST_CHECK_EQUAL(
+      string(Sum({avx512, avx2, fallback}, simdFeatures(SimdFeature::AVX2, SimdFeature::FMA)).selected().name),
+      "avx2");
+  BOOST_CHECK_EQUAL(string(Sum({avx512, avx2, fallback}, ~0U).selected().name), "avx512");
+
+  // the order is the preference
+  BOOST_CHECK_EQUAL(string(Sum({fallback, avx512}, ~0U).selected().name), "default");
+
+  BOOST_CHECK_THROW(Sum({avx512, avx2}, 0), Exception);
+}
+
+BOOST_AUTO_TEST_CASE(Call_test) {
+
+  std::vector<double> data(1000);
+  std::iota(data.begin(), data.end(), 1.0);
+
+  const Sum sum{
+#if defined(__x86_64__) and defined(__GNUC__)
+      {simdFeatures(SimdFeature::AVX2, SimdFeature::FMA), sumAvx2, "avx2"},
+#endif
+      {0, sumDefault, "default"}};
+
+  BOOST_CHECK_EQUAL(sum(data.data(), data.size()), 500500.0);
+
+  if (System::cpuTopology().hasFeatures(simdFeatures(SimdFeature::AVX2, SimdFeature::FMA))) {
+    BOOST_CHECK_EQUAL(string(sum.selected().name), "avx2");
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,296 @@
+/**
+ * @file PathBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/Path.h"
+
+#include <algorithm>      // for transform, for_each, copy_if
+#include <cstddef>        // for size_t, ptrdiff_t
+#include <map>            // for map
+#include <string>         // for string, to_string
+#include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
+
+#include <boost/algorithm/string.hpp>       // for split, join, is_any_of
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directories
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/PathIndex.h"  // for Index
+#include "ElementsKernel/Temporary.h"  // for TempDir
+
+#include "Benchmark.h"  // for microSecondsPerCall, report
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Benchmark::microSecondsPerCall;
+using Benchmark::report;
+
+using Path::Item;
+
+namespace {
+
+constexpr size_t location_number{16};
+constexpr size_t file_number{256};
+constexpr size_t iterations{16};
+
+constexpr size_t entry_number{512};
+constexpr size_t string_iterations{256};
+
+/// a PATH-like variable with hundreds of entries, a quarter of them duplicated
+string longPathVariable() {
+  vector<string> entries;
+  for (size_t e = 0; e < entry_number; ++e) {
+    entries.emplace_back("/opt/euclid/Project" + std::to_string(e % (entry_number * 3 / 4)) +
+                         "/1.0/InstallArea/x86_64");
+  }
+  return boost::algorithm::join(entries, Path::PATH_SEP);
+}
+
+/// the former implementations, based on boost::split, boost::algorithm::join and eager copies
+vector<Item> legacySplitPath(const string& path_string) {
+  vector<string> str_list;
+  boost::split(str_list, path_string, boost::is_any_of(Path::PATH_SEP));
+  vector<Item> found_list(str_list.size());
+  std::transform(str_list.cbegin(), str_list.cend(), found_list.begin(), [](const string& s) {
+    return Item{s};
+  });
+  return found_list;
+}
+
+template <typename T>
+string legacyJoinPath(const vector<T>& path_list) {
+  vector<string> elems(path_list.size());
+  std::transform(path_list.cbegin(), path_list.cend(), elems.begin(), [](const T& s) {
+    return Item{s}.string();
+  });
+  return boost::algorithm::join(elems, Path::PATH_SEP);
+}
+
+template <typename T, typename U>
+vector<Item> legacyMultiPathAppend(const vector<T>& initial_locations, const vector<U>& suffixes) {
+  vector<Item> result(initial_locations.size() * suffixes.size());
+  auto         pos = result.begin();
+  std::for_each(initial_locations.cbegin(), initial_locations.cend(), [&pos, &suffixes](const T& l) {
+    std::transform(suffixes.cbegin(), suffixes.cend(), pos, [l](const U& s) {
+      return Item{l} / s;
+    });
+    pos += static_cast<std::ptrdiff_t>(suffixes.size());
+  });
+  return result;
+}
+
+template <typename T>
+vector<Item> legacyRemoveDuplicates(const vector<T>& path_list) {
+  std::unordered_set<string> s;
+  vector<Item>               output(path_list.size());
+  auto end = std::copy_if(path_list.cbegin(), path_list.cend(), output.begin(), [&s](const T& i) {
+    return s.insert(Item{i}.string()).second;
+  });
+  output.erase(end, output.end());
+  return output;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(PathBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(BatchLookup_test) {
+
+  // the files are spread over the second half of the locations, as in a
+  // long ELEMENTS_AUX_PATH where most of the projects don't provide the file
+  TempDir        top_dir{"PathBenchmark_test-%%%%%%%"};
+  vector<Item>   locations;
+  vector<string> file_names;
+
+  for (size_t l = 0; l < location_number; ++l) {
+    locations.emplace_back(top_dir.path() / ("location" + std::to_string(l)));
+    boost::filesystem::create_directories(locations.back() / "Module");
+  }
+  for (size_t f = 0; f < file_number; ++f) {
+    file_names.emplace_back("Module/file" + std::to_string(f) + ".txt");
+    boost::filesystem::ofstream ofs(locations[location_number / 2 + f % (location_number / 2)] / file_names.back());
+  }
+
+  std::map<string, Item> single_paths;
+  std::map<string, Item> batch_paths;
+  std::map<string, Item> parallel_paths;
+
+  const double single_time = microSecondsPerCall(iterations, [&](size_t) {
+    for (const auto& file_name : file_names) {
+      single_paths[file_name] = Path::getPathFromLocations(file_name, locations);
+    }
+  });
+  const double batch_time = microSecondsPerCall(iterations, [&](size_t) {
+    batch_paths = Path::getPathsFromLocations(file_names, locations);
+  });
+  const double parallel_time = microSecondsPerCall(iterations, [&](size_t) {
+    parallel_paths = Path::getPathsFromLocations(file_names, locations, true);
+  });
+
+  report("getPathsFromLocations", batch_time, single_time, "us");
+  report("getPathsFromLocations (parallel)", parallel_time, single_time, "us");
+
+  BOOST_CHECK(batch_paths == single_paths);
+  BOOST_CHECK(parallel_paths == single_paths);
+}
+
+BOOST_AUTO_TEST_CASE(IndexedLookup_test) {
+
+  TempDir        top_dir{"PathBenchmark_test-%%%%%%%"};
+  vector<Item>   locations;
+  vector<string> file_names;
+
+  for (size_t l = 0; l < location_number; ++l) {
+    locations.emplace_back(top_dir.path() / ("location" + std::to_string(l)));
+    boost::filesystem::create_directories(locations.back() / "Module");
+  }
+  for (size_t f = 0; f < file_number; ++f) {
+    file_names.emplace_back("Module/file" + std::to_string(f) + ".txt");
+    boost::filesystem::ofstream ofs(locations[location_number / 2 + f % (location_number / 2)] / file_names.back());
+  }
+
+  std::map<string, Item> filesystem_paths;
+  std::map<string, Item> indexed_paths;
+
+  const double filesystem_time = microSecondsPerCall(iterations, [&](size_t) {
+    for (const auto& file_name : file_names) {
+      filesystem_paths[file_name] = Path::getPathFromLocations(file_name, locations);
+    }
+  });
+
+  for (const auto& location : locations) {
+    Path::Index::write(location);
+  }
+
+  const double indexed_time = microSecondsPerCall(iterations, [&](size_t) {
+    for (const auto& file_name : file_names) {
+      indexed_paths[file_name] = Path::getPathFromLocations(file_name, locations);
+    }
+  });
+
+  report("getPathFromLocations with Path::Index", indexed_time, filesystem_time, "us");
+
+  BOOST_CHECK(indexed_paths == filesystem_paths);
+}
+
+BOOST_AUTO_TEST_CASE(SplitJoin_test) {
+
+  const string path_variable = longPathVariable();
+
+  vector<Item> items;
+  vector<Item> legacy_items;
+  size_t       token_length = 0;
+
+  const double split_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    items = Path::splitPath(path_variable);
+  });
+  const double legacy_split_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    legacy_items = legacySplitPath(path_variable);
+  });
+  const double tokenizer_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    for (const auto& token : Path::PathTokenizer{path_variable}) {
+      token_length += token.size();
+    }
+  });
+
+  report("splitPath", split_time, legacy_split_time, "us");
+  report("PathTokenizer", tokenizer_time, legacy_split_time, "us");
+
+  BOOST_CHECK(items == legacy_items);
+  BOOST_CHECK_EQUAL(items.size(), entry_number);
+  BOOST_CHECK_EQUAL(token_length, string_iterations * (path_variable.size() - entry_number + 1));
+
+  string joined;
+  string legacy_joined;
+
+  const double join_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    joined = Path::joinPath(items);
+  });
+  const double legacy_join_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    legacy_joined = legacyJoinPath(items);
+  });
+
+  report("joinPath", join_time, legacy_join_time, "us");
+
+  BOOST_CHECK_EQUAL(joined, path_variable);
+  BOOST_CHECK_EQUAL(legacy_joined, path_variable);
+}
+
+BOOST_AUTO_TEST_CASE(MultiPathAppend_test) {
+
+  const auto           locations = Path::splitPath(longPathVariable());
+  const vector<string> suffixes{"auxdir", "aux", "share/auxdir", "share/aux"};
+
+  vector<Item> paths;
+  vector<Item> legacy_paths;
+  string       joined;
+  string       legacy_joined;
+
+  const double append_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    paths = Path::multiPathAppend(locations, suffixes);
+  });
+  const double legacy_append_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    legacy_paths = legacyMultiPathAppend(locations, suffixes);
+  });
+  const double range_join_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    joined = Path::joinPath(Path::multiPathRange(locations, suffixes));
+  });
+  const double legacy_join_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    legacy_joined = legacyJoinPath(legacyMultiPathAppend(locations, suffixes));
+  });
+
+  report("multiPathAppend", append_time, legacy_append_time, "us");
+  report("joinPath(multiPathRange)", range_join_time, legacy_join_time, "us");
+
+  BOOST_CHECK(paths == legacy_paths);
+  BOOST_CHECK_EQUAL(joined, legacy_joined);
+
+  vector<Item> unique_paths;
+  vector<Item> legacy_unique_paths;
+
+  const double unique_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    unique_paths = Path::removeDuplicates(paths);
+  });
+  const double legacy_unique_time = microSecondsPerCall(string_iterations, [&](size_t) {
+    legacy_unique_paths = legacyRemoveDuplicates(paths);
+  });
+
+  report("removeDuplicates", unique_time, legacy_unique_time, "us");
+
+  BOOST_CHECK(unique_paths == legacy_unique_paths);
+  BOOST_CHECK_EQUAL(unique_paths.size(), entry_number * 3 / 4 * suffixes.size());
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,278 @@
+/**
+ * @file PathIndex_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathIndex.h"  // header to test
+
+#include <fcntl.h>     // for AT_FDCWD
+#include <sys/stat.h>  // for utimensat
+
+#include <chrono>   // for milliseconds
+#include <cstddef>  // for size_t
+#include <cstdlib>  // for system
+#include <string>   // for string
+#include <thread>   // for sleep_for
+#include <vector>   // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directories, create_directory_symlink, remove
+#include <boost/test/unit_test.hpp>         // for boost unit test macros
+
+#include "ElementsKernel/Exception.h"        // for Exception
+#include "ElementsKernel/Path.h"             // for Path::Item, getPathFromLocations
+#include "ElementsKernel/PathLookupCache.h"  // for LookupCache
+#include "ElementsKernel/PathSearch.h"       // for pathSearch
+#include "ElementsKernel/System.h"           // for getEnv
+#include "ElementsKernel/Temporary.h"        // for TempDir
+
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Path::Index;
+using Path::Item;
+
+struct PathIndex_Fixture {
+
+  TempDir m_top_dir;
+  Item    m_location;
+  Item    m_outside;
+
+  PathIndex_Fixture() : m_top_dir{"PathIndex_test-%%%%%%%"} {
+
+    m_location = m_top_dir.path() / "auxdir";
+    m_outside  = m_top_dir.path() / "outside";
+
+    boost::filesystem::create_directories(m_location / "Module" / "templates");
+    boost::filesystem::create_directories(m_outside / "sub");
+    createFile(m_location / "top.txt");
+    createFile(m_location / "Module" / "data.txt");
+    createFile(m_location / "Module" / "templates" / "data.txt");
+    createFile(m_outside / "sub" / "data.txt");
+    boost::filesystem::create_directory_symlink(m_outside, m_location / "Linked");
+    boost::filesystem::create_symlink(m_top_dir.path() / "missing", m_location / "broken.txt");
+  }
+
+  static void createFile(const Item& file_path) {
+    boost::filesystem::ofstream ofs(file_path);
+    ofs << "content" << std::endl;
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(PathIndex_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(WriteAndRead_test, PathIndex_Fixture) {
+
+  BOOST_CHECK(Index::get(m_location) == nullptr);
+  BOOST_CHECK_THROW(Index{m_location}, Exception);
+
+  BOOST_CHECK_EQUAL(Index::write(m_location), 6);
+
+  auto index = Index::get(m_location);
+
+  BOOST_REQUIRE(index != nullptr);
+  BOOST_CHECK_EQUAL(index->directory(), m_location);
+
+  const vector<string> entries{"Linked", "Module", "Module/data.txt", "Module/templates", "Module/templates/data.txt",
+                               "top.txt"};
+  BOOST_REQUIRE_EQUAL(index->size(), entries.size());
+  for (std::size_t i = 1; i < index->size(); ++i) {
+    BOOST_CHECK(index->entry(i - 1) < index->entry(i));
+  }
+  for (const auto& entry : entries) {
+    BOOST_CHECK(index->find(entry) == Index::Lookup::found);
+  }
+
+  BOOST_CHECK(index->type(0) == Index::EntryType::linked_directory);
+  BOOST_CHECK(index->type(1) == Index::EntryType::directory);
+  BOOST_CHECK(index->type(index->size() - 1) == Index::EntryType::file);
+
+  BOOST_CHECK(Index::get(m_location) == index);
+}
+
+BOOST_FIXTURE_TEST_CASE(Find_test, PathIndex_Fixture) {
+
+  Index::write(m_location);
+  Index index{m_location};
+
+  BOOST_CHECK(index.find("top.txt") == Index::Lookup::found);
+  BOOST_CHECK(index.find("Module/templates/data.txt") == Index::Lookup::found);
+  BOOST_CHECK(index.find("missing.txt") == Index::Lookup::missing);
+  BOOST_CHECK(index.find("Module/missing.txt") == Index::Lookup::missing);
+  BOOST_CHECK(index.find("Missing/data.txt") == Index::Lookup::missing);
+  BOOST_CHECK(index.find("broken.txt") == Index::Lookup::missing);
+  BOOST_CHECK(index.find(Path::INDEX_FILE_NAME) == Index::Lookup::missing);
+
+  // below a directory link or not normalized
+  BOOST_CHECK(index.find("Linked/sub/data.txt") == Index::Lookup::unknown);
+  BOOST_CHECK(index.find("Module/../top.txt") == Index::Lookup::unknown);
+  BOOST_CHECK(index.find("./top.txt") == Index::Lookup::unknown);
+  BOOST_CHECK(index.find("Module/") == Index::Lookup::unknown);
+  BOOST_CHECK(index.find("/top.txt") == Index::Lookup::unknown);
+  BOOST_CHECK(index.find("") == Index::Lookup::unknown);
+}
+
+BOOST_FIXTURE_TEST_CASE(Search_test, PathIndex_Fixture) {
+
+  Index::write(m_location);
+  Index index{m_location};
+
+  const vector<string> recursive_ref{"Module/data.txt", "Module/templates/data.txt"};
+  const auto           recursive = index.search("data.txt", true);
+  BOOST_CHECK_EQUAL_COLLECTIONS(recursive.begin(), recursive.end(), recursive_ref.begin(), recursive_ref.end());
+
+  BOOST_CHECK(index.search("data.txt", false).empty());
+  BOOST_CHECK_EQUAL(index.search("top.txt", false).size(), 1);
+  BOOST_CHECK(index.search("", true).empty());
+
+  // pathSearch doesn't follow the directory links either
+  const auto search_results = pathSearch("data.txt", m_location, SearchType::Recursive);
+  BOOST_CHECK_EQUAL(search_results.size(), 2);
+  BOOST_CHECK_EQUAL(search_results[0], m_location / "Module" / "data.txt");
+}
+
+BOOST_FIXTURE_TEST_CASE(LookupFunctions_test, PathIndex_Fixture) {
+
+  Index::write(m_location);
+  BOOST_REQUIRE(Index::get(m_location) != nullptr);
+
+  // the index is used until its next check: a file removed below the top directory is still found
+  boost::filesystem::remove(m_location / "Module" / "templates" / "data.txt");
+
+  const vector<Item> locations{m_location};
+  const Item         file_name{"Module/templates/data.txt"};
+
+  BOOST_CHECK_EQUAL(Path::getPathFromLocations(file_name, locations), m_location / file_name);
+  BOOST_CHECK_EQUAL(Path::getAllPathFromLocations(file_name, locations).size(), 1);
+  BOOST_CHECK_EQUAL(Path::LookupCache{}.getPathFromLocations(file_name, locations), m_location / file_name);
+  BOOST_CHECK_EQUAL(Path::getPathsFromLocations({file_name.string()}, locations).at(file_name.string()),
+                    m_location / file_name);
+  BOOST_CHECK_EQUAL(pathSearch("data.txt", m_location, SearchType::Recursive).size(), 2);
+
+  // the paths below a directory link are checked on the filesystem
+  BOOST_CHECK_EQUAL(Path::getPathFromLocations("Linked/sub/data.txt", locations), m_location / "Linked/sub/data.txt");
+  BOOST_CHECK(Path::getPathFromLocations("Linked/sub/missing.txt", locations).empty());
+  BOOST_CHECK(Path::getPathFromLocations("Module/missing.txt", locations).empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(AddedFile_test, PathIndex_Fixture) {
+
+  Index::write(m_location);
+  BOOST_REQUIRE(Index::get(m_location) != nullptr);
+
+  // the index describes the installed tree: a file added below the top directory is missing until it is rewritten
+  createFile(m_location / "Module" / "new.txt");
+
+  const vector<Item> locations{m_location};
+  const Item         file_name{"Module/new.txt"};
+
+  BOOST_CHECK(Index::get(m_location)->find(file_name.string()) == Index::Lookup::missing);
+  BOOST_CHECK(not Path::existsInLocation(file_name, m_location));
+  BOOST_CHECK(Path::getPathFromLocations(file_name, locations).empty());
+  BOOST_CHECK(Path::LookupCache{}.getPathFromLocations(file_name, locations).empty());
+  BOOST_CHECK(Path::getPathsFromLocations({file_name.string()}, locations).at(file_name.string()).empty());
+
+  // only the index file and the top directory are checked
+  BOOST_CHECK(Index::get(m_location)->isUpToDate());
+
+  // a rewritten index is used at once
+  Index::write(m_location);
+  BOOST_REQUIRE(Index::get(m_location) != nullptr);
+  BOOST_CHECK(Index::get(m_location)->find(file_name.string()) == Index::Lookup::found);
+  BOOST_CHECK(Path::existsInLocation(file_name, m_location));
+
+  // a file added at the top makes the index outdated
+  createFile(m_location / "new.txt");
+  BOOST_CHECK(not Index::get(m_location)->isUpToDate());
+  std::this_thread::sleep_for(Path::DEFAULT_VALIDATION_PERIOD + std::chrono::milliseconds(100));
+  BOOST_CHECK(Index::get(m_location) == nullptr);
+  BOOST_CHECK(Path::existsInLocation("new.txt", m_location));
+}
+
+BOOST_FIXTURE_TEST_CASE(ScriptWriter_test, PathIndex_Fixture) {
+
+  // the index written at install time by cmake/scripts/createPathIndex.py
+  const string command = System::getEnv("ELEMENTS_PATH_INDEX_COMMAND");
+  if (command.empty()) {
+    BOOST_TEST_MESSAGE("The ELEMENTS_PATH_INDEX_COMMAND variable is not set: the script is not tested");
+    return;
+  }
+
+  // the absence of index is checked again after the validation period
+  BOOST_CHECK(Index::get(m_location) == nullptr);
+  BOOST_REQUIRE_EQUAL(std::system((command + " --quiet " + m_location.string()).c_str()), 0);
+  BOOST_CHECK(Index::get(m_location) == nullptr);
+  std::this_thread::sleep_for(Path::DEFAULT_VALIDATION_PERIOD + std::chrono::milliseconds(100));
+
+  auto script_index = Index::get(m_location);
+  BOOST_REQUIRE(script_index != nullptr);
+  BOOST_CHECK(script_index->isUpToDate());
+
+  vector<string>           script_entries;
+  vector<Index::EntryType> script_types;
+  for (std::size_t i = 0; i < script_index->size(); ++i) {
+    script_entries.emplace_back(script_index->entry(i));
+    script_types.emplace_back(script_index->type(i));
+  }
+
+  // the same content as the one written by Index::write
+  BOOST_CHECK_EQUAL(Index::write(m_location), script_entries.size());
+  auto index = Index::get(m_location);
+  BOOST_REQUIRE(index != nullptr);
+  BOOST_REQUIRE_EQUAL(index->size(), script_entries.size());
+  for (std::size_t i = 0; i < index->size(); ++i) {
+    BOOST_CHECK_EQUAL(index->entry(i), script_entries[i]);
+    BOOST_CHECK(index->type(i) == script_types[i]);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(Outdated_test, PathIndex_Fixture) {
+
+  Index::write(m_location);
+  BOOST_CHECK(Index::get(m_location) != nullptr);
+
+  // an index older than its directory is ignored
+  const struct timespec old_times[2] = {{0, 0}, {0, 0}};
+  ::utimensat(AT_FDCWD, (m_location / Path::INDEX_FILE_NAME).c_str(), old_times, 0);
+
+  BOOST_CHECK(Index::get(m_location) != nullptr);
+  Index::clearRegistry();
+  BOOST_CHECK(Index::get(m_location) == nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(Invalid_test, PathIndex_Fixture) {
+
+  createFile(m_location / Path::INDEX_FILE_NAME);
+
+  BOOST_CHECK_THROW(Index{m_location}, Exception);
+  Index::clearRegistry();
+  BOOST_CHECK(Index::get(m_location) == nullptr);
+  BOOST_CHECK_EQUAL(Path::getPathFromLocations("top.txt", vector<Item>{m_location}), m_location / "top.txt");
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
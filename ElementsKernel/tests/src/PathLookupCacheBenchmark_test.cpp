@@ -0,0 +1,117 @@
+/**
+ * @file PathLookupCacheBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/PathLookupCache.h"
+
+#include <cstddef>   // for size_t
+#include <iostream>  // for cout
+#include <string>    // for string, to_string
+#include <vector>    // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directories
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Path.h"       // for Item, getPathFromLocations
+#include "ElementsKernel/Temporary.h"  // for TempDir
+
+#include "Benchmark.h"  // for nanoSecondsPerCall, report
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Benchmark::nanoSecondsPerCall;
+using Benchmark::report;
+
+using Path::Item;
+
+namespace {
+
+constexpr size_t location_number{16};
+constexpr size_t file_number{256};
+constexpr size_t iterations{1 << 14};
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(PathLookupCacheBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(Lookup_test) {
+
+  // the files are spread over the second half of the locations, as in a
+  // long ELEMENTS_AUX_PATH where most of the projects don't provide the file
+  TempDir      top_dir{"PathLookupCacheBenchmark_test-%%%%%%%"};
+  vector<Item> locations;
+  vector<Item> file_names;
+
+  for (size_t l = 0; l < location_number; ++l) {
+    locations.emplace_back(top_dir.path() / ("location" + std::to_string(l)));
+    boost::filesystem::create_directories(locations.back() / "Module");
+  }
+  for (size_t f = 0; f < file_number; ++f) {
+    file_names.emplace_back(Item{"Module"} / ("file" + std::to_string(f) + ".txt"));
+    boost::filesystem::ofstream ofs(locations[location_number / 2 + f % (location_number / 2)] / file_names.back());
+  }
+
+  Path::LookupCache cache;
+  size_t            mismatches = 0;
+
+  const double cached_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    const auto& file_name = file_names[i % file_number];
+    if (cache.getPathFromLocations(file_name, locations).empty()) {
+      ++mismatches;
+    }
+  });
+  const double scan_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    const auto& file_name = file_names[i % file_number];
+    if (Path::getPathFromLocations(file_name, locations).empty()) {
+      ++mismatches;
+    }
+  });
+
+  report("LookupCache::getPathFromLocations", cached_time, scan_time);
+
+  const auto statistics = cache.statistics();
+  std::cout << "hits: " << statistics.hits << ", misses: " << statistics.misses
+            << ", invalidations: " << statistics.invalidations << std::endl;
+
+  BOOST_CHECK_EQUAL(mismatches, 0);
+  BOOST_CHECK_EQUAL(statistics.misses, location_number);
+
+  for (const auto& file_name : file_names) {
+    BOOST_CHECK_EQUAL(cache.getPathFromLocations(file_name, locations),
+                      Path::getPathFromLocations(file_name, locations));
+  }
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,331 @@
+/**
+ * @file PathLookupCache_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/PathLookupCache.h"  // header to test
+
+#include <atomic>   // for atomic
+#include <chrono>   // for milliseconds, steady_clock
+#include <cstddef>  // for size_t
+#include <string>   // for string, to_string
+#include <thread>   // for sleep_for, thread
+#include <vector>   // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directories, remove
+#include <boost/test/unit_test.hpp>         // for boost unit test macros
+
+#include "ElementsKernel/Auxiliary.h"    // for getAuxiliaryPath
+#include "ElementsKernel/Path.h"         // for Path::Item, splitPath
+#include "ElementsKernel/PathWatcher.h"  // for Watcher
+#include "ElementsKernel/Temporary.h"    // for TempDir, TempEnv
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Path::Item;
+using Path::LookupCache;
+using Path::Watcher;
+
+struct PathLookupCache_Fixture {
+
+  TempDir      m_top_dir;
+  vector<Item> m_locations;
+
+  PathLookupCache_Fixture() : m_top_dir{"PathLookupCache_test-%%%%%%%"} {
+
+    for (const auto& name : {"first", "second", "third"}) {
+      m_locations.emplace_back(m_top_dir.path() / name);
+      boost::filesystem::create_directories(m_locations.back() / "Module");
+    }
+    createFile(m_locations[1] / "Module" / "data.txt");
+    createFile(m_locations[2] / "Module" / "data.txt");
+    createFile(m_locations[2] / "top.txt");
+  }
+
+  static void createFile(const Item& file_path) {
+    boost::filesystem::ofstream ofs(file_path);
+    ofs << "content" << std::endl;
+  }
+
+  /// @return true if the lookup gives the expected path within a few seconds
+  bool waitForLookup(LookupCache& cache, const Item& file_name, const Item& expected) const {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (cache.getPathFromLocations(file_name, m_locations) != expected) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(PathLookupCache_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(SameAsUncached_test, PathLookupCache_Fixture) {
+
+  LookupCache cache;
+
+  for (const auto& name : {"Module/data.txt", "top.txt", "Module", "missing.txt", "Module/missing.txt",
+                           "Missing/data.txt", "Module/../top.txt", ""}) {
+    BOOST_CHECK_EQUAL(cache.getPathFromLocations(Item{name}, m_locations),
+                      Path::getPathFromLocations(Item{name}, m_locations));
+  }
+
+  BOOST_CHECK_EQUAL(cache.getPathFromLocations(Item{"Module/data.txt"}, m_locations),
+                    m_locations[1] / "Module" / "data.txt");
+}
+
+BOOST_FIXTURE_TEST_CASE(RelativeLocation_test, PathLookupCache_Fixture) {
+
+  LookupCache cache;
+
+  const Item current_dir = boost::filesystem::current_path();
+  boost::filesystem::current_path(m_locations[2]);
+
+  // the empty location is the current directory, as for the uncached lookup
+  const vector<Item> locations{Item{}, Item{"Module"}, m_locations[1]};
+  for (const auto& name : {"top.txt", "Module/data.txt", "data.txt", "missing.txt"}) {
+    BOOST_CHECK_EQUAL(cache.getPathFromLocations(Item{name}, locations),
+                      Path::getPathFromLocations(Item{name}, locations));
+  }
+  BOOST_CHECK_EQUAL(cache.getPathFromLocations(Item{"top.txt"}, locations), Item{"top.txt"});
+  BOOST_CHECK_EQUAL(cache.getPathFromLocations(Item{"data.txt"}, locations), Item{"Module/data.txt"});
+
+  // the relative locations follow the current directory
+  boost::filesystem::current_path(m_locations[1]);
+  BOOST_CHECK(cache.getPathFromLocations(Item{"top.txt"}, locations).empty());
+
+  boost::filesystem::current_path(current_dir);
+}
+
+BOOST_FIXTURE_TEST_CASE(Statistics_test, PathLookupCache_Fixture) {
+
+  LookupCache cache;
+
+  // first lookup: the directories of the first two locations are listed
+  cache.getPathFromLocations(Item{"Module/data.txt"}, m_locations);
+  auto statistics = cache.statistics();
+  BOOST_CHECK_EQUAL(statistics.misses, 2);
+  BOOST_CHECK_EQUAL(statistics.hits, 0);
+
+  // second lookup: served from the indexes
+  cache.getPathFromLocations(Item{"Module/data.txt"}, m_locations);
+  statistics = cache.statistics();
+  BOOST_CHECK_EQUAL(statistics.misses, 2);
+  BOOST_CHECK_EQUAL(statistics.hits, 2);
+
+  cache.resetStatistics();
+  BOOST_CHECK_EQUAL(cache.statistics().hits, 0);
+  BOOST_CHECK_EQUAL(cache.statistics().misses, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(Batch_test, PathLookupCache_Fixture) {
+
+  const vector<string> file_names{"Module/data.txt", "top.txt", "missing.txt", "Module/missing.txt"};
+
+  for (const bool parallel : {false, true}) {
+
+    LookupCache cache;
+
+    const auto found_paths = cache.getPathsFromLocations(file_names, m_locations, parallel);
+    for (const auto& name : file_names) {
+      BOOST_CHECK_EQUAL(found_paths.at(name), Path::getPathFromLocations(Item{name}, m_locations));
+    }
+
+    // the single lookups share the directory indexes of the batch
+    const auto misses = cache.statistics().misses;
+    BOOST_CHECK_EQUAL(misses, 2 * m_locations.size());
+    for (const auto& name : file_names) {
+      cache.getPathFromLocations(Item{name}, m_locations);
+    }
+    BOOST_CHECK_EQUAL(cache.statistics().misses, misses);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(IndexLimit_test, PathLookupCache_Fixture) {
+
+  vector<Item> locations;
+  for (size_t l = 0; l <= Path::MAX_DIRECTORY_INDEXES; ++l) {
+    locations.emplace_back(m_top_dir.path() / "many" / std::to_string(l));
+    boost::filesystem::create_directories(locations.back());
+  }
+
+  LookupCache cache;
+  cache.setWatching(false);
+  cache.setValidationPeriod(std::chrono::hours(1));
+
+  BOOST_CHECK(cache.getPathFromLocations(Item{"missing.txt"}, locations).empty());
+  BOOST_CHECK_EQUAL(cache.statistics().misses, locations.size());
+
+  // the first index has been dropped to stay within the limit
+  cache.getPathFromLocations(Item{"missing.txt"}, {locations.front()});
+  BOOST_CHECK_EQUAL(cache.statistics().misses, locations.size() + 1);
+  cache.getPathFromLocations(Item{"missing.txt"}, {locations.back()});
+  BOOST_CHECK_EQUAL(cache.statistics().misses, locations.size() + 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(ConcurrentLookup_test, PathLookupCache_Fixture) {
+
+  const vector<string> file_names{"Module/data.txt", "top.txt", "missing.txt", "Module/missing.txt"};
+
+  LookupCache         cache;
+  std::atomic<size_t> mismatches{0};
+  vector<std::thread> threads;
+  for (size_t t = 0; t < 8; ++t) {
+    threads.emplace_back([this, &cache, &file_names, &mismatches]() {
+      for (size_t i = 0; i < 1000; ++i) {
+        const Item file_name{file_names[i % file_names.size()]};
+        if (cache.getPathFromLocations(file_name, m_locations) != Path::getPathFromLocations(file_name, m_locations)) {
+          ++mismatches;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BOOST_CHECK_EQUAL(mismatches.load(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(Invalidation_test, PathLookupCache_Fixture) {
+
+  LookupCache cache;
+  cache.setWatching(false);
+  cache.setValidationPeriod(std::chrono::hours(1));
+
+  const Item new_file{"Module/new.txt"};
+
+  BOOST_CHECK(cache.getPathFromLocations(new_file, m_locations).empty());
+
+  createFile(m_locations[0] / new_file);
+
+  // within the validation period the index is trusted
+  BOOST_CHECK(cache.getPathFromLocations(new_file, m_locations).empty());
+
+  // a null period checks the modification time of the directory at each lookup
+  cache.setValidationPeriod(std::chrono::milliseconds(0));
+  BOOST_CHECK_EQUAL(cache.getPathFromLocations(new_file, m_locations), m_locations[0] / new_file);
+  BOOST_CHECK(cache.statistics().invalidations >= 1);
+
+  boost::filesystem::remove(m_locations[0] / new_file);
+  BOOST_CHECK(cache.getPathFromLocations(new_file, m_locations).empty());
+
+  // clear drops everything
+  cache.setValidationPeriod(std::chrono::hours(1));
+  createFile(m_locations[0] / new_file);
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.getPathFromLocations(new_file, m_locations), m_locations[0] / new_file);
+}
+
+BOOST_FIXTURE_TEST_CASE(WatchedInvalidation_test, PathLookupCache_Fixture) {
+
+  if (not Watcher::instance().isAvailable()) {
+    return;
+  }
+
+  LookupCache cache;
+  cache.setValidationPeriod(std::chrono::hours(1));
+  BOOST_CHECK(cache.watching());
+
+  const Item new_file{"Module/new.txt"};
+
+  BOOST_CHECK(cache.getPathFromLocations(new_file, m_locations).empty());
+
+  // the notification is asynchronous: the file shows up without waiting for the validation period
+  createFile(m_locations[0] / new_file);
+  BOOST_CHECK(waitForLookup(cache, new_file, m_locations[0] / new_file));
+  BOOST_CHECK(cache.statistics().invalidations >= 1);
+
+  boost::filesystem::remove(m_locations[0] / new_file);
+  BOOST_CHECK(waitForLookup(cache, new_file, Item{}));
+}
+
+BOOST_FIXTURE_TEST_CASE(WatchedValidation_test, PathLookupCache_Fixture) {
+
+  LookupCache cache;
+  cache.setValidationPeriod(std::chrono::milliseconds(0));
+
+  const Item new_file{"Module/new.txt"};
+
+  BOOST_CHECK(cache.getPathFromLocations(new_file, m_locations).empty());
+
+  // the modification time is checked even if the notification has not arrived (yet)
+  createFile(m_locations[0] / new_file);
+  BOOST_CHECK_EQUAL(cache.getPathFromLocations(new_file, m_locations), m_locations[0] / new_file);
+
+  boost::filesystem::remove(m_locations[0] / new_file);
+  BOOST_CHECK(cache.getPathFromLocations(new_file, m_locations).empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(Locations_test, PathLookupCache_Fixture) {
+
+  LookupCache cache;
+  auto        env = TempEnv();
+
+  const string variable{"PATHLOOKUPCACHE_TEST_PATH"};
+  size_t       provider_calls = 0;
+
+  auto provider = [&variable, &provider_calls]() {
+    ++provider_calls;
+    return Path::getLocationsFromEnv(variable);
+  };
+
+  env[variable] = Path::join(m_locations);
+
+  auto locations = cache.getLocations(variable, provider);
+  BOOST_CHECK_EQUAL_COLLECTIONS(locations->cbegin(), locations->cend(), m_locations.cbegin(), m_locations.cend());
+
+  cache.getLocations(variable, provider);
+  BOOST_CHECK_EQUAL(provider_calls, 1);
+
+  // a new value of the variable rebuilds the locations
+  env[variable] = m_locations[2].string();
+
+  locations = cache.getLocations(variable, provider);
+  BOOST_CHECK_EQUAL(provider_calls, 2);
+  BOOST_CHECK_EQUAL(locations->size(), 1);
+  BOOST_CHECK_EQUAL(cache.getPathFromLocations(Item{"Module/data.txt"}, *locations),
+                    m_locations[2] / "Module" / "data.txt");
+}
+
+BOOST_FIXTURE_TEST_CASE(AuxiliaryPath_test, PathLookupCache_Fixture) {
+
+  auto env = TempEnv();
+
+  env["ELEMENTS_AUX_PATH"] = Path::join(m_locations);
+  BOOST_CHECK_EQUAL(getAuxiliaryPath("Module/data.txt"), m_locations[1] / "Module" / "data.txt");
+
+  env["ELEMENTS_AUX_PATH"] = Path::join(vector<Item>{m_locations[2], m_locations[1]});
+  BOOST_CHECK_EQUAL(getAuxiliaryPath("Module/data.txt"), m_locations[2] / "Module" / "data.txt");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------
+
+}  // namespace Elements
@@ -0,0 +1,128 @@
+/**
+ * @file PathPrefetch_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathPrefetch.h"  // header to test
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <string>   // for string
+#include <utility>  // for move
+#include <vector>   // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directory
+#include <boost/test/unit_test.hpp>         // for boost unit test macros
+
+#include "ElementsKernel/Path.h"       // for Path::Item
+#include "ElementsKernel/Temporary.h"  // for TempDir
+
+using std::size_t;
+using std::uint64_t;
+using std::vector;
+
+namespace Elements {
+
+using Path::Item;
+using Path::Prefetch;
+
+struct PathPrefetch_Fixture {
+
+  TempDir      m_top_dir;
+  vector<Item> m_files;
+  uint64_t     m_total_size;
+
+  PathPrefetch_Fixture() : m_top_dir{"PathPrefetch_test-%%%%%%%"}, m_total_size{0} {
+
+    // the last file spans several prefetch chunks
+    for (const size_t size : {size_t{0}, size_t{1000}, size_t{100000}, size_t{9 * 1024 * 1024 + 17}}) {
+      m_files.emplace_back(m_top_dir.path() / ("file_" + std::to_string(size) + ".bin"));
+      boost::filesystem::ofstream ofs(m_files.back(), std::ios::binary);
+      const std::string block(size, 'x');
+      ofs.write(block.data(), static_cast<std::streamsize>(block.size()));
+      m_total_size += size;
+    }
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(PathPrefetch_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(Prefetch_test, PathPrefetch_Fixture) {
+
+  for (const size_t thread_number : {size_t{0}, size_t{1}, size_t{2}, size_t{16}}) {
+
+    Prefetch prefetch(m_files, thread_number);
+    prefetch.wait();
+
+    BOOST_CHECK(prefetch.done());
+    BOOST_CHECK_EQUAL(prefetch.byteNumber(), m_total_size);
+    BOOST_CHECK_EQUAL(prefetch.errorNumber(), 0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(prefetch.files().cbegin(), prefetch.files().cend(), m_files.cbegin(),
+                                  m_files.cend());
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(Errors_test, PathPrefetch_Fixture) {
+
+  boost::filesystem::create_directory(m_top_dir.path() / "directory");
+
+  // the empty items are skipped, the missing files and the directories are errors
+  Prefetch prefetch({m_files[1], Item{}, m_top_dir.path() / "missing.bin", m_top_dir.path() / "directory"});
+  prefetch.wait();
+
+  BOOST_CHECK(prefetch.done());
+  BOOST_CHECK_EQUAL(prefetch.byteNumber(), 1000);
+  BOOST_CHECK_EQUAL(prefetch.errorNumber(), 2);
+
+  Prefetch empty_prefetch(vector<Item>{});
+  BOOST_CHECK(empty_prefetch.done());
+}
+
+BOOST_FIXTURE_TEST_CASE(Move_test, PathPrefetch_Fixture) {
+
+  Prefetch first(m_files);
+  Prefetch second(std::move(first));
+
+  // a moved-from handle is empty and done
+  BOOST_CHECK(first.files().empty());
+  BOOST_CHECK(first.done());
+  BOOST_CHECK_EQUAL(first.byteNumber(), 0);
+  BOOST_CHECK_EQUAL(first.errorNumber(), 0);
+
+  // the running prefetch is stopped and waited for before the assignment
+  Prefetch third({m_files[3]});
+  third = std::move(second);
+  third.wait();
+
+  BOOST_CHECK(third.done());
+  BOOST_CHECK_EQUAL(third.byteNumber(), m_total_size);
+
+  // the destructor waits for the threads
+  Prefetch dropped(m_files);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------
+
+}  // namespace Elements
@@ -0,0 +1,213 @@
+/**
+ * @file PathResolver_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathResolver.h"  // header to test
+
+#include <fcntl.h>     // for AT_FDCWD
+#include <sys/stat.h>  // for utimensat
+
+#include <chrono>   // for nanoseconds
+#include <cstddef>  // for size_t
+#include <sstream>  // for ostringstream
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directories
+#include <boost/test/unit_test.hpp>         // for boost unit test macros
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Path.h"       // for Path::Item
+#include "ElementsKernel/PathIndex.h"  // for Index
+#include "ElementsKernel/Temporary.h"  // for TempDir
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Path::Item;
+using Path::ResolutionStrategy;
+using Path::Resolver;
+
+namespace {
+
+void createFile(const Item& file_path, long seconds) {
+  boost::filesystem::create_directories(file_path.parent_path());
+  {
+    boost::filesystem::ofstream ofs(file_path);
+    ofs << "content" << std::endl;
+  }
+  struct timespec times[2];
+  times[0].tv_sec  = seconds;
+  times[0].tv_nsec = 0;
+  times[1]         = times[0];
+  ::utimensat(AT_FDCWD, file_path.c_str(), times, 0);
+}
+
+}  // namespace
+
+struct PathResolver_Fixture {
+
+  PathResolver_Fixture() {
+    // the file is in the 1st, 3rd and 4th locations. The 3rd one is the newest
+    for (const auto& name : {"first", "second", "third", "fourth"}) {
+      m_locations.emplace_back(m_top_dir.path() / name);
+      boost::filesystem::create_directories(m_locations.back());
+    }
+    createFile(m_locations[0] / m_file_name, 1000000000);
+    createFile(m_locations[2] / m_file_name, 1600000000);
+    createFile(m_locations[3] / m_file_name, 1200000000);
+  }
+
+  TempDir      m_top_dir{"PathResolver_test-%%%%%%%"};
+  Item         m_file_name{"test.conf"};
+  vector<Item> m_locations;
+  Resolver     m_resolver;
+};
+
+BOOST_AUTO_TEST_SUITE(PathResolver_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(StrategyName_test) {
+
+  for (const auto strategy : {ResolutionStrategy::first_match, ResolutionStrategy::all_matches,
+                              ResolutionStrategy::newest, ResolutionStrategy::priority_list}) {
+    BOOST_CHECK(Path::toResolutionStrategy(Path::toString(strategy)) == strategy);
+  }
+
+  BOOST_CHECK_EQUAL(Path::toString(ResolutionStrategy::all_matches), "all-matches");
+  BOOST_CHECK_THROW(Path::toResolutionStrategy("best-match"), Exception);
+}
+
+BOOST_FIXTURE_TEST_CASE(FirstMatch_test, PathResolver_Fixture) {
+
+  BOOST_CHECK(m_resolver.strategy() == ResolutionStrategy::first_match);
+
+  const auto matches = m_resolver.resolve(m_file_name, m_locations);
+  BOOST_REQUIRE_EQUAL(matches.size(), 1);
+  BOOST_CHECK_EQUAL(matches[0], m_locations[0] / m_file_name);
+
+  // the search stops at the first location, after the check of its missing index
+  const auto totals = m_resolver.totals();
+  BOOST_CHECK_EQUAL(totals.lookups, 1);
+  BOOST_CHECK_EQUAL(totals.probed_locations, 1);
+  BOOST_CHECK_EQUAL(totals.system_calls, 2);
+
+  BOOST_CHECK(m_resolver.resolvePath("missing.conf", m_locations).empty());
+  BOOST_CHECK_EQUAL(m_resolver.totals().probed_locations, 1 + m_locations.size());
+}
+
+BOOST_FIXTURE_TEST_CASE(IndexedLocation_test, PathResolver_Fixture) {
+
+  Path::Index::write(m_locations[0]);
+
+  // the path found in the index of the location is not checked on the filesystem. The index is checked before
+  // and after its mapping.
+  BOOST_CHECK_EQUAL(m_resolver.resolvePath(m_file_name, m_locations), m_locations[0] / m_file_name);
+  BOOST_CHECK_EQUAL(m_resolver.totals().probed_locations, 1);
+  BOOST_CHECK_EQUAL(m_resolver.totals().system_calls, 4);
+
+  // the index just checked is used as is
+  m_resolver.resetStatistics();
+  BOOST_CHECK_EQUAL(m_resolver.resolvePath(m_file_name, m_locations), m_locations[0] / m_file_name);
+  BOOST_CHECK_EQUAL(m_resolver.totals().system_calls, 0);
+
+  // the newest strategy needs the modification times
+  m_resolver.resetStatistics();
+  m_resolver.setStrategy(ResolutionStrategy::newest);
+  BOOST_CHECK_EQUAL(m_resolver.resolvePath(m_file_name, m_locations), m_locations[2] / m_file_name);
+  BOOST_CHECK_EQUAL(m_resolver.totals().system_calls, m_locations.size());
+
+  Path::Index::clearRegistry();
+}
+
+BOOST_FIXTURE_TEST_CASE(AllMatches_test, PathResolver_Fixture) {
+
+  m_resolver.setStrategy(ResolutionStrategy::all_matches);
+
+  const auto matches = m_resolver.resolve(m_file_name, m_locations);
+  BOOST_REQUIRE_EQUAL(matches.size(), 3);
+  BOOST_CHECK_EQUAL(matches[0], m_locations[0] / m_file_name);
+  BOOST_CHECK_EQUAL(matches[1], m_locations[2] / m_file_name);
+  BOOST_CHECK_EQUAL(matches[2], m_locations[3] / m_file_name);
+
+  BOOST_CHECK_EQUAL(m_resolver.totals().probed_locations, m_locations.size());
+  BOOST_CHECK_EQUAL(m_resolver.records().back().match_number, 3);
+}
+
+BOOST_FIXTURE_TEST_CASE(Newest_test, PathResolver_Fixture) {
+
+  m_resolver.setStrategy(ResolutionStrategy::newest);
+
+  BOOST_CHECK_EQUAL(m_resolver.resolvePath(m_file_name, m_locations), m_locations[2] / m_file_name);
+  BOOST_CHECK_EQUAL(m_resolver.totals().system_calls, m_locations.size());
+}
+
+BOOST_FIXTURE_TEST_CASE(PriorityList_test, PathResolver_Fixture) {
+
+  m_resolver.setStrategy(ResolutionStrategy::priority_list);
+  m_resolver.setPriorities({m_locations[3], m_locations[2]});
+
+  BOOST_CHECK_EQUAL(m_resolver.resolvePath(m_file_name, m_locations), m_locations[3] / m_file_name);
+  BOOST_CHECK_EQUAL(m_resolver.totals().probed_locations, 1);
+
+  // the locations below a prioritized prefix are ranked with it. Neither "first" nor "fourth" is below ".../f"
+  m_resolver.setPriorities({m_top_dir.path() / "f", m_top_dir.path() / "third"});
+  BOOST_CHECK_EQUAL(m_resolver.resolvePath(m_file_name, m_locations), m_locations[2] / m_file_name);
+
+  // without priorities, it behaves as the first match
+  m_resolver.setPriorities({});
+  BOOST_CHECK_EQUAL(m_resolver.resolvePath(m_file_name, m_locations), m_locations[0] / m_file_name);
+}
+
+BOOST_FIXTURE_TEST_CASE(Records_test, PathResolver_Fixture) {
+
+  const size_t lookup_number = Path::MAX_RESOLUTION_RECORD_NUMBER + 10;
+  for (size_t i = 0; i < lookup_number; ++i) {
+    m_resolver.resolve(m_file_name, m_locations);
+  }
+
+  const auto records = m_resolver.records();
+  BOOST_CHECK_EQUAL(records.size(), Path::MAX_RESOLUTION_RECORD_NUMBER);
+  BOOST_CHECK_EQUAL(m_resolver.totals().lookups, lookup_number);
+  BOOST_CHECK_EQUAL(records.front().file_name, m_file_name.string());
+  BOOST_CHECK(records.front().strategy == ResolutionStrategy::first_match);
+  BOOST_CHECK(records.front().duration >= std::chrono::nanoseconds{0});
+
+  std::ostringstream output;
+  m_resolver.dump(output);
+  BOOST_CHECK(output.str().find("lookups: " + std::to_string(lookup_number)) != string::npos);
+  BOOST_CHECK(output.str().find(m_file_name.string()) != string::npos);
+
+  m_resolver.resetStatistics();
+  BOOST_CHECK(m_resolver.records().empty());
+  BOOST_CHECK_EQUAL(m_resolver.totals().lookups, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
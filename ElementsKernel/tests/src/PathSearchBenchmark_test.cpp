@@ -0,0 +1,137 @@
+/**
+ * @file PathSearchBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/PathSearch.h"
+
+#include <algorithm>  // for max, sort
+#include <cstddef>    // for size_t
+#include <iomanip>    // for setprecision
+#include <iostream>   // for cout
+#include <string>     // for string, to_string
+#include <thread>     // for hardware_concurrency
+#include <vector>     // for vector
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directories
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Path.h"       // for Item
+#include "ElementsKernel/Temporary.h"  // for TempDir
+
+#include "Benchmark.h"  // for microSecondsPerCall
+
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace Elements {
+
+using Benchmark::microSecondsPerCall;
+
+using Path::Item;
+
+namespace {
+
+constexpr size_t branching{6};
+constexpr size_t levels{4};
+constexpr size_t files_per_directory{8};
+
+/// create a balanced tree of directories with files at every level
+void createTree(const Item& directory, size_t level) {
+  boost::filesystem::create_directories(directory);
+  for (size_t f = 0; f < files_per_directory; ++f) {
+    boost::filesystem::ofstream(directory / ("file" + std::to_string(f) + ".dat"));
+  }
+  if (level < levels) {
+    for (size_t b = 0; b < branching; ++b) {
+      createTree(directory / ("dir" + std::to_string(b)), level + 1);
+    }
+  }
+}
+
+template <typename F>
+double milliSeconds(F&& func) {
+  const double call_time = microSecondsPerCall(1, [&func](size_t) {
+    func();
+  });
+  return call_time / 1.0e3;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(PathSearchBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(TreeSearch_test) {
+
+  TempDir top_dir{"PathSearchBenchmark_test-%%%%%%%"};
+  createTree(top_dir.path(), 0);
+
+  vector<Item> expected;
+  const double serial_time = milliSeconds([&]() {
+    expected = pathSearch("file3.dat", top_dir.path(), SearchType::Recursive);
+  });
+  std::sort(expected.begin(), expected.end());
+
+  std::cout << std::fixed << std::setprecision(2) << "recursive pathSearch: " << serial_time << " ms ("
+            << expected.size() << " matches)" << std::endl;
+
+  const size_t max_threads = std::max(2U, std::thread::hardware_concurrency());
+
+  for (size_t thread_number = 1; thread_number <= max_threads; thread_number *= 2) {
+
+    PathSearchOptions options;
+    options.thread_number = thread_number;
+
+    vector<Item> actual;
+    const double parallel_time = milliSeconds([&]() {
+      actual = parallelPathSearch("file3.dat", top_dir.path(), options);
+    });
+
+    std::cout << std::fixed << std::setprecision(2) << "parallelPathSearch with " << thread_number << " threads: " << parallel_time
+              << " ms (speedup: " << serial_time / parallel_time << ")" << std::endl;
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+  }
+
+  PathSearchOptions options;
+  options.first_match_only = true;
+
+  vector<Item> first;
+  const double first_time = milliSeconds([&]() {
+    first = parallelPathSearch("file3.dat", top_dir.path(), options);
+  });
+
+  std::cout << std::fixed << std::setprecision(2) << "parallelPathSearch first match: " << first_time << " ms" << std::endl;
+
+  BOOST_CHECK_EQUAL(first.size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
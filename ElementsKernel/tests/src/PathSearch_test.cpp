@@ -21,9 +21,12 @@
 
 #include "ElementsKernel/PathSearch.h"
 
+#include <algorithm>  // for sort
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>  // for ofstream
 #include <boost/test/unit_test.hpp>
+#include <cstddef>  // for size_t
 #include <cstdlib>
 #include <string>  // for std::string
 #include <vector>  // for std::vector
@@ -237,6 +240,100 @@ BOOST_AUTO_TEST_CASE(Recursion_test) {
   createTemporaryStructure(top_dir_path);
 }
 
+//----------------------------------------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(parallel_same_as_recursive, PathSearch_Fixture) {
+
+  for (const string file_name : {"MockFile_up.conf", "MockFile_down.conf", "MockFile_replicate.conf", "ElementsKernel",
+                                 "NonExistentFile.conf"}) {
+    auto expected = pathSearch(file_name, m_full_path, SearchType::Recursive);
+    std::sort(expected.begin(), expected.end());
+    for (std::size_t thread_number = 1; thread_number <= 4; ++thread_number) {
+      PathSearchOptions options;
+      options.thread_number = thread_number;
+      auto actual           = parallelPathSearch(file_name, m_full_path, options);
+      BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(parallel_depth_and_matching, PathSearch_Fixture) {
+
+  PathSearchOptions options;
+
+  // a depth of 0 is the same as a local search
+  options.max_depth = 0;
+  BOOST_CHECK(parallelPathSearch("MockFile_replicate.conf", m_full_path, options).empty());
+  BOOST_CHECK_EQUAL(parallelPathSearch("MockFile_up.conf", m_full_path, options).size(), 1);
+  options.max_depth = 1;
+  BOOST_CHECK_EQUAL(parallelPathSearch("MockFile_replicate.conf", m_full_path, options).size(), 1);
+  options.max_depth = 2;
+  BOOST_CHECK_EQUAL(parallelPathSearch("MockFile_replicate.conf", m_full_path, options).size(), 2);
+
+  options            = PathSearchOptions{};
+  options.match_type = MatchType::Glob;
+  BOOST_CHECK_EQUAL(parallelPathSearch("MockFile_*.conf", m_full_path, options).size(), 6);
+  BOOST_CHECK_EQUAL(parallelPathSearch("*_down.conf", m_full_path, options).size(), 2);
+
+  options.match_type = MatchType::Regex;
+  BOOST_CHECK_EQUAL(parallelPathSearch("MockFile_.*ElementsKernel.*\\.conf", m_full_path, options).size(), 2);
+  BOOST_CHECK(parallelPathSearch("MockFile", m_full_path, options).empty());
+  BOOST_CHECK_THROW(parallelPathSearch("MockFile_[", m_full_path, options), Exception);
+
+  options.first_match_only = true;
+  BOOST_CHECK_EQUAL(parallelPathSearch("MockFile_.*", m_full_path, options).size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_first_match_only) {
+
+  // a match in each directory: the threads find one at the same time
+  TempDir top_dir{"PathSearch_FirstMatch_test-%%%%%%%"};
+  for (std::size_t d = 0; d < 16; ++d) {
+    const path directory = top_dir.path() / ("dir" + std::to_string(d));
+    boost::filesystem::create_directories(directory);
+    boost::filesystem::ofstream ofs(directory / "match.txt");
+  }
+
+  PathSearchOptions options;
+  options.thread_number    = 4;
+  options.first_match_only = true;
+  for (std::size_t i = 0; i < 64; ++i) {
+    BOOST_CHECK_EQUAL(parallelPathSearch("match.txt", top_dir.path(), options).size(), 1);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(parallel_search_in_env_variable, PathSearch_Fixture) {
+
+  Environment local;
+  local[m_env_variable_name] = m_multiple_path;
+
+  const auto expected = pathSearchInEnvVariable("MockFile_replicate.conf", m_env_variable_name);
+  const auto actual   = pathSearchInEnvVariable("MockFile_replicate.conf", m_env_variable_name, PathSearchOptions{});
+
+  // the order of the locations is kept
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(parallel_symlink_loop) {
+
+  TempDir top_dir{"PathSearch_Loop_test-%%%%%%%"};
+  path    top_dir_path = top_dir.path();
+  createTemporaryStructure(top_dir_path);
+  boost::filesystem::ofstream(top_dir_path / "tests" / "data" / "PathSearch" / "target.txt");
+
+  // a link to an ancestor makes an infinite tree
+  boost::filesystem::create_directory_symlink(top_dir_path / "tests", top_dir_path / "tests" / "data" / "loop");
+
+  PathSearchOptions options;
+  BOOST_CHECK_EQUAL(parallelPathSearch("target.txt", top_dir_path, options).size(), 1);
+
+  options.follow_symlinks = true;
+  BOOST_CHECK_EQUAL(parallelPathSearch("target.txt", top_dir_path, options).size(), 1);
+
+  options.max_depth = 2;
+  BOOST_CHECK(parallelPathSearch("target.txt", top_dir_path, options).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace Elements
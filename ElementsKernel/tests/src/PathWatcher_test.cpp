@@ -0,0 +1,227 @@
+/**
+ * @file PathWatcher_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PathWatcher.h"  // header to test
+
+#include <chrono>              // for steady_clock, microseconds
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <functional>          // for ref
+#include <iomanip>             // for setprecision
+#include <iostream>            // for cout
+#include <mutex>               // for mutex, unique_lock
+#include <thread>              // for sleep_for
+
+#include <boost/filesystem/fstream.hpp>     // for ofstream
+#include <boost/filesystem/operations.hpp>  // for create_directory, remove
+#include <boost/test/unit_test.hpp>         // for boost unit test macros
+
+#include "ElementsKernel/Path.h"       // for Path::Item
+#include "ElementsKernel/Temporary.h"  // for TempDir
+
+using std::size_t;
+
+namespace Elements {
+
+using Path::Item;
+using Path::Watcher;
+
+namespace {
+
+/// counter of the notifications, which can be waited for
+class Notifications {
+
+public:
+  void operator()(const Item&) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_count;
+    m_time = std::chrono::steady_clock::now();
+    m_condition.notify_all();
+  }
+
+  /// @return false if the count is not reached within a few seconds
+  bool waitFor(size_t count) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_condition.wait_for(lock, std::chrono::seconds(5), [this, count]() {
+      return m_count >= count;
+    });
+  }
+
+  size_t count() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_count;
+  }
+
+  std::chrono::steady_clock::time_point time() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_time;
+  }
+
+private:
+  std::mutex                            m_mutex;
+  std::condition_variable               m_condition;
+  size_t                                m_count{0};
+  std::chrono::steady_clock::time_point m_time;
+};
+
+void createFile(const Item& file_path) {
+  boost::filesystem::ofstream ofs(file_path);
+  ofs << "content" << std::endl;
+}
+
+double microSecondsSince(const std::chrono::steady_clock::time_point& start,
+                         const std::chrono::steady_clock::time_point& stop) {
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / 1.0e3;
+}
+
+}  // namespace
+
+struct PathWatcher_Fixture {
+
+  TempDir m_top_dir{"PathWatcher_test-%%%%%%%"};
+  Watcher m_watcher;
+};
+
+BOOST_AUTO_TEST_SUITE(PathWatcher_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_FIXTURE_TEST_CASE(Notification_test, PathWatcher_Fixture) {
+
+  if (not m_watcher.isAvailable()) {
+    return;
+  }
+
+  Notifications notifications;
+  Item          notified_directory;
+
+  const auto subscription = m_watcher.subscribe(m_top_dir.path(), [&notifications, &notified_directory](const Item& d) {
+    notified_directory = d;
+    notifications(d);
+  });
+
+  BOOST_REQUIRE(subscription != 0);
+  BOOST_CHECK_EQUAL(m_watcher.watchedDirectoryNumber(), 1);
+
+  auto start = std::chrono::steady_clock::now();
+  createFile(m_top_dir.path() / "new.txt");
+  BOOST_REQUIRE(notifications.waitFor(1));
+  const double creation_latency = microSecondsSince(start, notifications.time());
+  BOOST_CHECK_EQUAL(notified_directory, m_top_dir.path());
+
+  const size_t created_count = notifications.count();
+  start                      = std::chrono::steady_clock::now();
+  boost::filesystem::remove(m_top_dir.path() / "new.txt");
+  BOOST_REQUIRE(notifications.waitFor(created_count + 1));
+  const double deletion_latency = microSecondsSince(start, notifications.time());
+
+  std::cout << std::fixed << std::setprecision(2) << "notification latency: " << creation_latency
+            << " us (creation), " << deletion_latency << " us (deletion)" << std::endl;
+
+  // the content of the files doesn't matter
+  const size_t deleted_count = notifications.count();
+  createFile(m_top_dir.path() / "other.txt");
+  BOOST_REQUIRE(notifications.waitFor(deleted_count + 1));
+  const size_t modified_count = notifications.count();
+  createFile(m_top_dir.path() / "other.txt");
+
+  m_watcher.unsubscribe(subscription);
+  BOOST_CHECK_EQUAL(m_watcher.watchedDirectoryNumber(), 0);
+
+  createFile(m_top_dir.path() / "last.txt");
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  BOOST_CHECK_EQUAL(notifications.count(), modified_count);
+}
+
+BOOST_FIXTURE_TEST_CASE(SharedWatch_test, PathWatcher_Fixture) {
+
+  if (not m_watcher.isAvailable()) {
+    return;
+  }
+
+  Notifications first;
+  Notifications second;
+
+  const auto first_subscription  = m_watcher.subscribe(m_top_dir.path(), std::ref(first));
+  const auto second_subscription = m_watcher.subscribe(m_top_dir.path(), std::ref(second));
+
+  BOOST_CHECK(first_subscription != second_subscription);
+  BOOST_CHECK_EQUAL(m_watcher.watchedDirectoryNumber(), 1);
+
+  createFile(m_top_dir.path() / "new.txt");
+  BOOST_CHECK(first.waitFor(1));
+  BOOST_CHECK(second.waitFor(1));
+
+  m_watcher.unsubscribe(first_subscription);
+  BOOST_CHECK_EQUAL(m_watcher.watchedDirectoryNumber(), 1);
+
+  boost::filesystem::remove(m_top_dir.path() / "new.txt");
+  BOOST_CHECK(second.waitFor(2));
+
+  m_watcher.unsubscribe(second_subscription);
+  BOOST_CHECK_EQUAL(m_watcher.watchedDirectoryNumber(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(RemovedDirectory_test, PathWatcher_Fixture) {
+
+  if (not m_watcher.isAvailable()) {
+    return;
+  }
+
+  const Item directory = m_top_dir.path() / "sub";
+  boost::filesystem::create_directory(directory);
+
+  Notifications notifications;
+  const auto    subscription = m_watcher.subscribe(directory, std::ref(notifications));
+  BOOST_REQUIRE(subscription != 0);
+
+  // the subscription is dropped with the directory
+  boost::filesystem::remove(directory);
+  BOOST_CHECK(notifications.waitFor(1));
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (m_watcher.watchedDirectoryNumber() != 0 and std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  BOOST_CHECK_EQUAL(m_watcher.watchedDirectoryNumber(), 0);
+
+  m_watcher.unsubscribe(subscription);
+}
+
+BOOST_FIXTURE_TEST_CASE(MissingDirectory_test, PathWatcher_Fixture) {
+
+  Notifications notifications;
+
+  BOOST_CHECK_EQUAL(m_watcher.subscribe(m_top_dir.path() / "missing", std::ref(notifications)), 0);
+  BOOST_CHECK_EQUAL(m_watcher.subscribe(Item{}, std::ref(notifications)), 0);
+  BOOST_CHECK_EQUAL(m_watcher.watchedDirectoryNumber(), 0);
+
+  // unknown subscriptions are ignored
+  m_watcher.unsubscribe(0);
+  m_watcher.unsubscribe(42);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+//-----------------------------------------------------------------------------
+
+}  // namespace Elements
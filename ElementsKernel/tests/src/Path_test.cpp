@@ -21,9 +21,12 @@
 
 #include "ElementsKernel/Path.h"  // header to test
 
-#include <algorithm>  // for for_each, transform
-#include <string>     // for std::string
-#include <vector>     // for std::vector
+#include <algorithm>    // for for_each, transform
+#include <iterator>     // for distance, iterator_traits
+#include <string>       // for std::string
+#include <type_traits>  // for false_type, true_type, is_same
+#include <utility>      // for declval
+#include <vector>       // for std::vector
 
 #include <boost/filesystem.hpp>          // for boost::filesystem
 #include <boost/filesystem/fstream.hpp>  // for ofstream
@@ -41,6 +44,13 @@ namespace Elements {
 
 //-----------------------------------------------------------------------------
 
+template <typename T, typename U, typename = void>
+struct AcceptsRangeArguments : std::false_type {};
+
+template <typename T, typename U>
+struct AcceptsRangeArguments<T, U, decltype(void(Path::multiPathRange(std::declval<T>(), std::declval<U>())))>
+    : std::true_type {};
+
 //-----------------------------------------------------------------------------
 //
 // Begin of the Boost tests
@@ -229,6 +239,48 @@ BOOST_FIXTURE_TEST_CASE(getPathFromEnvVariable_test, Path_Fixture) {
   BOOST_CHECK_EQUAL(e1e2_path, m_top_dir.path() / "test1" / "foo" / "e1e2");
 }
 
+BOOST_FIXTURE_TEST_CASE(getPathsFromLocations_test, Path_Fixture) {
+
+  using Path::getPathFromLocations;
+  using Path::getPathsFromLocations;
+
+  create_test_file(m_top_dir.path() / "test2" / "bar");
+
+  // with a duplicate, a relative parent and an absolute path
+  const vector<string> file_names{"e1e2", "foo", "bar", "sub/d1d2", "sub/e1e2", "Bla", "foo/e1e2",
+                                  "e1e2", "../test3/e1e2", (m_top_dir.path() / "test6").string()};
+
+  for (const bool parallel : {false, true}) {
+
+    const auto found_paths = getPathsFromLocations(file_names, m_item_list, parallel);
+
+    BOOST_CHECK_EQUAL(found_paths.size(), file_names.size() - 1);
+    for (const auto& name : file_names) {
+      BOOST_CHECK_EQUAL(found_paths.at(name), getPathFromLocations(name, m_item_list));
+    }
+
+    BOOST_CHECK_EQUAL(found_paths.at("e1e2"), m_top_dir.path() / "test1" / "foo" / "e1e2");
+    BOOST_CHECK_EQUAL(found_paths.at("sub/d1d2"), m_top_dir.path() / "test1" / "sub" / "d1d2");
+    BOOST_CHECK(found_paths.at("Bla").empty());
+    BOOST_CHECK(found_paths.at("sub/e1e2").empty());
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(getPathsFromEnvVariable_test, Path_Fixture) {
+
+  using Path::getPathsFromEnvVariable;
+
+  auto env = TempEnv();
+
+  env["THAT_PATH"] = Path::join(m_directory_list);
+
+  const auto found_paths = getPathsFromEnvVariable({"foobar", "e1e2", "d1d2"}, "THAT_PATH", true);
+
+  BOOST_CHECK(found_paths.at("foobar").empty());
+  BOOST_CHECK_EQUAL(found_paths.at("e1e2"), m_top_dir.path() / "test1" / "foo" / "e1e2");
+  BOOST_CHECK_EQUAL(found_paths.at("d1d2"), m_top_dir.path() / "test1" / "sub" / "d1d2");
+}
+
 BOOST_AUTO_TEST_CASE(JoinPath_test) {
 
   using Path::joinPath;
@@ -280,6 +332,35 @@ BOOST_AUTO_TEST_CASE(SplitPath_test) {
   BOOST_CHECK(splitPath(path_string3) == path_list3);
 }
 
+BOOST_AUTO_TEST_CASE(PathTokenizer_test) {
+
+  using Path::PathTokenizer;
+
+  for (const string path_string : {"/toto:titi:./tutu", ":/toto:titi:./tutu", "/toto::titi:", "", ":"}) {
+
+    const PathTokenizer tokens{path_string};
+    const auto          path_list = Path::splitPath(path_string);
+
+    BOOST_CHECK_EQUAL(tokens.size(), path_list.size());
+    BOOST_CHECK_EQUAL(std::distance(tokens.begin(), tokens.end()), path_list.size());
+
+    auto item = path_list.cbegin();
+    for (const auto& token : tokens) {
+      BOOST_CHECK_EQUAL(token.to_string(), item->string());
+      ++item;
+    }
+  }
+
+  const string        path_string{"/toto:titi"};
+  const PathTokenizer tokens{path_string};
+  auto                it = tokens.begin();
+
+  BOOST_CHECK_EQUAL(it->size(), 5);
+  BOOST_CHECK(it++ == tokens.begin());
+  BOOST_CHECK(*it == "titi");
+  BOOST_CHECK(++it == tokens.end());
+}
+
 BOOST_AUTO_TEST_CASE(MultiPathAppend_test) {
 
   using Path::multiPathAppend;
@@ -303,6 +384,42 @@ BOOST_AUTO_TEST_CASE(MultiPathAppend_test) {
   BOOST_CHECK(ref_paths == full_path_strings);
 }
 
+BOOST_AUTO_TEST_CASE(MultiPathRange_test) {
+
+  using Path::joinPath;
+  using Path::multiPathAppend;
+  using Path::multiPathRange;
+
+  const vector<string>     locations{"loc1", "/loc2", "./loc3/", ""};
+  const vector<Path::Item> suffixes{"bin", "scripts", ""};
+
+  const auto full_paths = multiPathAppend(locations, suffixes);
+  const auto path_range = multiPathRange(locations, suffixes);
+
+  BOOST_CHECK_EQUAL(path_range.size(), full_paths.size());
+  BOOST_CHECK(not path_range.empty());
+  BOOST_CHECK(vector<Path::Item>(path_range.begin(), path_range.end()) == full_paths);
+  BOOST_CHECK_EQUAL(joinPath(path_range), joinPath(full_paths));
+  BOOST_CHECK_EQUAL(Path::join(path_range), joinPath(full_paths));
+
+  const vector<string> no_suffix;
+  const auto           empty_range = multiPathRange(locations, no_suffix);
+
+  BOOST_CHECK(empty_range.empty());
+  BOOST_CHECK(empty_range.begin() == empty_range.end());
+  BOOST_CHECK_EQUAL(joinPath(empty_range), "");
+
+  // the elements are built on the fly
+  using iterator = Path::MultiPathRange<string, Path::Item>::const_iterator;
+  BOOST_CHECK((std::is_same<std::iterator_traits<iterator>::iterator_category, std::input_iterator_tag>::value));
+
+  // the range refers to its vectors: they cannot be temporaries
+  BOOST_CHECK((AcceptsRangeArguments<const vector<string>&, const vector<string>&>::value));
+  BOOST_CHECK((not AcceptsRangeArguments<vector<string>, const vector<string>&>::value));
+  BOOST_CHECK((not AcceptsRangeArguments<const vector<string>&, vector<string>>::value));
+  BOOST_CHECK((not AcceptsRangeArguments<vector<string>, vector<string>>::value));
+}
+
 BOOST_AUTO_TEST_CASE(RemoveDuplicates_test) {
 
   using Path::removeDuplicates;
@@ -326,6 +443,12 @@ BOOST_AUTO_TEST_CASE(RemoveDuplicates_test) {
   }
 
   BOOST_CHECK(removeDuplicates(paths) == unique_paths);
+
+  // the same path in all the slots of a reserved vector
+  const vector<string> same_locations(100, "/a/location/long/enough/to/be/allocated/on/the/heap");
+
+  BOOST_CHECK(removeDuplicates(same_locations) == vector<Path::Item>{same_locations.front()});
+  BOOST_CHECK(removeDuplicates(vector<string>{}).empty());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
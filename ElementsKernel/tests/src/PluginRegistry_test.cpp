@@ -0,0 +1,162 @@
+/**
+ * @file PluginRegistry_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/PluginRegistry.h"  // header to test
+
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/System.h"     // for loadDynamicLib, unloadDynamicLib
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+using System::Plugin;
+using System::PluginBinding;
+using System::PluginRegistry;
+
+namespace {
+
+/// libraries of the C runtime, with a well known C symbol
+const string math_library{"libm.so.6"};
+const string resolv_library{"libresolv.so.2"};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PluginRegistry_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Load_test) {
+
+  auto& registry = PluginRegistry::instance();
+  BOOST_CHECK(not registry.isLoaded(math_library));
+
+  {
+    const auto plugin = registry.load(math_library, PluginBinding::Now);
+    BOOST_REQUIRE(plugin);
+    BOOST_CHECK_EQUAL(plugin.name(), math_library);
+    BOOST_CHECK_EQUAL(plugin.fileName(), math_library);
+    BOOST_CHECK(plugin.binding() == PluginBinding::Now);
+    BOOST_CHECK(plugin.handle() != nullptr);
+    BOOST_CHECK(registry.isLoaded(math_library));
+
+    // the same library is shared, with its first binding
+    const auto other = registry.load(math_library, PluginBinding::Lazy);
+    BOOST_CHECK_EQUAL(other.handle(), plugin.handle());
+    BOOST_CHECK(other.binding() == PluginBinding::Now);
+  }
+
+  // released with the last reference
+  BOOST_CHECK(not registry.isLoaded(math_library));
+
+  BOOST_CHECK_THROW(registry.load("ThisPluginDoesNotExist"), Exception);
+  BOOST_CHECK(not registry.isLoaded("ThisPluginDoesNotExist"));
+}
+
+BOOST_AUTO_TEST_CASE(Symbol_test) {
+
+  const auto plugin = PluginRegistry::instance().load(math_library);
+
+  using Function = double (*)(double);
+  const auto cosine = plugin.function<Function>("cos");
+  BOOST_CHECK_CLOSE(cosine(0.0), 1.0, 1e-12);
+
+  // looked up once
+  BOOST_CHECK_EQUAL(plugin.cachedSymbolNumber(), 1);
+  BOOST_CHECK_EQUAL(plugin.function<Function>("cos"), cosine);
+  BOOST_CHECK_EQUAL(plugin.cachedSymbolNumber(), 1);
+
+  BOOST_CHECK(plugin.address("this_symbol_does_not_exist") == nullptr);
+  BOOST_CHECK_THROW(plugin.function<Function>("this_symbol_does_not_exist"), Exception);
+  BOOST_CHECK_EQUAL(plugin.cachedSymbolNumber(), 2);
+
+  const Plugin empty;
+  BOOST_CHECK(not empty);
+  BOOST_CHECK_EQUAL(empty.name(), "");
+  BOOST_CHECK(empty.address("cos") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Preload_test) {
+
+  auto& registry = PluginRegistry::instance();
+
+  const auto plugins = registry.preload({math_library, resolv_library, math_library}, PluginBinding::Now, 3);
+  BOOST_REQUIRE_EQUAL(plugins.size(), 3);
+  BOOST_CHECK_EQUAL(plugins[0].name(), math_library);
+  BOOST_CHECK_EQUAL(plugins[1].name(), resolv_library);
+  BOOST_CHECK_EQUAL(plugins[0].handle(), plugins[2].handle());
+  BOOST_CHECK_EQUAL(registry.size(), 2);
+
+  BOOST_CHECK_THROW(registry.preload({math_library, "ThisPluginDoesNotExist"}), Exception);
+}
+
+BOOST_AUTO_TEST_CASE(Threads_test) {
+
+  auto& registry  = PluginRegistry::instance();
+  const auto kept = registry.load(math_library);
+
+  std::vector<void*>       handles(8, nullptr);
+  std::vector<std::thread> threads;
+  for (auto& h : handles) {
+    threads.emplace_back([&registry, &h]() {
+      for (size_t i = 0; i < 100; ++i) {
+        const auto plugin = registry.load(math_library);
+        h                 = plugin.address("sin");
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (const auto h : handles) {
+    BOOST_CHECK_EQUAL(h, kept.address("sin"));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(LoadDynamicLib_test) {
+
+  System::ImageHandle handle = nullptr;
+
+  BOOST_CHECK_EQUAL(System::loadDynamicLib("ThisLibraryDoesNotExist", &handle), 0xAFFEDEADUL);
+  BOOST_CHECK(handle == nullptr);
+  BOOST_CHECK(not System::getLastErrorString().empty());
+
+  // becomes libElementsKernel.so
+  BOOST_REQUIRE_EQUAL(System::loadDynamicLib("ElementsKernel", &handle), 1);
+  BOOST_CHECK(handle != nullptr);
+  BOOST_CHECK_EQUAL(System::unloadDynamicLib(handle), 1);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
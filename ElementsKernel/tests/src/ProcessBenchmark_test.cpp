@@ -0,0 +1,151 @@
+/**
+ * @file ProcessBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/Process.h"
+
+#include <sys/wait.h>  // for waitpid
+#include <unistd.h>    // for fork, execvp, _exit
+
+#include <cstddef>   // for size_t
+#include <cstdio>    // for popen, pclose
+#include <cstdlib>   // for system
+#include <iomanip>   // for setprecision
+#include <iostream>  // for cout
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Environment.h"  // for Environment
+
+#include "Benchmark.h"  // for microSecondsPerCall
+
+using std::size_t;
+
+namespace Elements {
+
+using Benchmark::microSecondsPerCall;
+
+using System::Process;
+
+namespace {
+
+constexpr size_t iterations{200};
+
+/// size of the memory touched to make the parent large
+constexpr size_t LARGE_PARENT_SIZE{256 * 1024 * 1024};
+
+template <typename F>
+double spawnsPerSecond(F&& func) {
+  const double call_time = microSecondsPerCall(iterations, [&func](size_t) {
+    func();
+  });
+  return 1.0e6 / call_time;
+}
+
+/// the classic way: the page tables of the parent are copied by fork
+int forkExec(const char* command) {
+  const pid_t pid = ::fork();
+  if (pid == 0) {
+    char* const argv[] = {const_cast<char*>(command), nullptr};
+    ::execvp(command, argv);
+    ::_exit(127);
+  }
+  int status = 0;
+  ::waitpid(pid, &status, 0);
+  return WEXITSTATUS(status);
+}
+
+void report(const std::string& name) {
+
+  size_t errors = 0;
+
+  // the environment is prepared once
+  const Environment              env{Environment::overlay};
+  const auto                     block = env.block();
+  const std::vector<std::string> arguments{"/bin/true"};
+  System::SpawnOptions           options;
+  options.environment = &block;
+
+  const double spawn_rate = spawnsPerSecond([&]() {
+    errors += static_cast<size_t>(Process::spawn(arguments, options).wait());
+  });
+  const double fork_rate = spawnsPerSecond([&]() {
+    errors += static_cast<size_t>(forkExec("/bin/true"));
+  });
+  const double system_rate = spawnsPerSecond([&]() {
+    errors += static_cast<size_t>(std::system("/bin/true"));
+  });
+  const double popen_rate = spawnsPerSecond([&]() {
+    FILE* command = ::popen("/bin/true", "r");
+    errors += static_cast<size_t>(::pclose(command));
+  });
+
+  std::cout << std::fixed << std::setprecision(0) << name << ": " << spawn_rate
+            << " spawns/s (fork+exec: " << fork_rate << ", system: " << system_rate << ", popen: " << popen_rate
+            << ")" << std::endl;
+
+  BOOST_CHECK_EQUAL(errors, 0);
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(ProcessBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(SpawnRate_test) {
+  report("small parent");
+}
+
+BOOST_AUTO_TEST_CASE(LargeParentSpawnRate_test) {
+
+  // all the pages are touched: fork has to copy their page table entries
+  std::vector<char> ballast(LARGE_PARENT_SIZE, 1);
+
+  report("large parent");
+
+  BOOST_CHECK_EQUAL(ballast[LARGE_PARENT_SIZE / 2], 1);
+}
+
+BOOST_AUTO_TEST_CASE(Capture_test) {
+
+  size_t length = 0;
+
+  const double run_rate = spawnsPerSecond([&length]() {
+    length += Process::run({"echo", "toto"}).output.size();
+  });
+
+  std::cout << std::fixed << std::setprecision(0) << "captured output: " << run_rate << " runs/s" << std::endl;
+
+  BOOST_CHECK_EQUAL(length, iterations * 5);
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,173 @@
+/**
+ * @file ProcessInfo_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/ProcessInfo.h"  // header to test
+
+#include <fcntl.h>         // for open
+#include <sys/resource.h>  // for getrlimit
+#include <unistd.h>        // for getpid, getppid, close, write
+
+#include <atomic>   // for atomic
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <cstring>  // for memset
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/Exception.h"  // for Exception
+#include "ElementsKernel/Temporary.h"  // for TempFile
+
+using std::size_t;
+using std::uint64_t;
+
+namespace Elements {
+
+using System::InfoType;
+using System::processInfo;
+
+BOOST_AUTO_TEST_SUITE(ProcessInfo_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Memory_test) {
+
+  const auto before = processInfo(InfoType::Memory).memory;
+  BOOST_CHECK(before.resident_size > 0);
+  BOOST_CHECK(before.peak_resident_size >= before.resident_size);
+  BOOST_CHECK(before.virtual_size >= before.resident_size);
+  BOOST_CHECK(before.peak_virtual_size >= before.virtual_size);
+
+  // the touched pages become resident
+  constexpr size_t  size{64 << 20};
+  std::vector<char> block(size);
+  std::memset(block.data(), 1, block.size());
+
+  const auto after = processInfo(InfoType::Memory).memory;
+  BOOST_CHECK(after.resident_size >= before.resident_size + size / 2);
+  BOOST_CHECK(after.data_size >= before.data_size + size / 2);
+  BOOST_CHECK(after.peak_resident_size >= after.resident_size);
+}
+
+BOOST_AUTO_TEST_CASE(Io_test) {
+
+  System::ProcessInfo info{};
+  if (not processInfo(InfoType::IO, info)) {
+    // /proc/self/io is not readable in some containers
+    BOOST_CHECK_THROW(processInfo(InfoType::IO), Exception);
+    return;
+  }
+  const auto before = info.io;
+
+  TempFile  file;
+  const int descriptor = ::open(file.path().c_str(), O_WRONLY | O_CREAT, 0600);
+  BOOST_REQUIRE(descriptor >= 0);
+  const char buffer[4096] = {};
+  for (size_t i = 0; i < 16; ++i) {
+    BOOST_REQUIRE_EQUAL(::write(descriptor, buffer, sizeof(buffer)), static_cast<ssize_t>(sizeof(buffer)));
+  }
+  ::close(descriptor);
+
+  BOOST_REQUIRE(processInfo(InfoType::IO, info));
+  BOOST_CHECK(info.io.written_characters >= before.written_characters + 16 * sizeof(buffer));
+  BOOST_CHECK(info.io.write_calls >= before.write_calls + 16);
+}
+
+BOOST_AUTO_TEST_CASE(Times_test) {
+
+  const auto before = processInfo(InfoType::Times).times;
+
+  // busy loop of at least 50 ms
+  volatile double value = 0.0;
+  for (size_t i = 0; processInfo(InfoType::Times).times.user_time + processInfo(InfoType::Times).times.system_time <
+                         before.user_time + before.system_time + 0.05;
+       ++i) {
+    value = value + static_cast<double>(i);
+  }
+
+  const auto after = processInfo(InfoType::Times).times;
+  BOOST_CHECK(after.user_time + after.system_time >= before.user_time + before.system_time + 0.05);
+  BOOST_CHECK(after.minor_page_faults >= before.minor_page_faults);
+  BOOST_CHECK(after.major_page_faults >= before.major_page_faults);
+}
+
+BOOST_AUTO_TEST_CASE(Basics_test) {
+
+  const auto before = processInfo(InfoType::ProcessBasics).basics;
+  BOOST_CHECK_EQUAL(before.process_id, ::getpid());
+  BOOST_CHECK_EQUAL(before.parent_process_id, ::getppid());
+  BOOST_CHECK(before.thread_number >= 1);
+  // at least the standard streams
+  BOOST_CHECK(before.open_file_descriptor_number >= 3);
+
+  std::atomic<bool> stop{false};
+  std::thread       thread([&stop]() {
+    while (not stop) {
+      std::this_thread::yield();
+    }
+  });
+  const int descriptor = ::open("/dev/null", O_RDONLY);
+
+  const auto after = processInfo(InfoType::ProcessBasics).basics;
+  BOOST_CHECK_EQUAL(after.thread_number, before.thread_number + 1);
+  BOOST_CHECK_EQUAL(after.open_file_descriptor_number, before.open_file_descriptor_number + 1);
+
+  ::close(descriptor);
+  stop = true;
+  thread.join();
+}
+
+BOOST_AUTO_TEST_CASE(Quota_test) {
+
+  const auto quota = processInfo(InfoType::Quota).quota;
+
+  struct rlimit limit;
+  BOOST_REQUIRE_EQUAL(::getrlimit(RLIMIT_NOFILE, &limit), 0);
+  if (limit.rlim_cur == RLIM_INFINITY) {
+    BOOST_CHECK_EQUAL(quota.file_descriptor_number, System::UNLIMITED);
+  } else {
+    BOOST_CHECK_EQUAL(quota.file_descriptor_number, static_cast<uint64_t>(limit.rlim_cur));
+  }
+  BOOST_CHECK(quota.control_group_memory > 0);
+
+  const auto remain_time = processInfo(InfoType::RemainTime).remain_time;
+  if (quota.cpu_time == System::UNLIMITED) {
+    BOOST_CHECK(remain_time.cpu_time < 0.0);
+  } else {
+    BOOST_CHECK(remain_time.cpu_time <= static_cast<double>(quota.cpu_time));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Unsupported_test) {
+
+  System::ProcessInfo info{};
+  BOOST_CHECK(processInfo(InfoType::NoFetch, info));
+  BOOST_CHECK(not processInfo(InfoType::Modules, info));
+  BOOST_CHECK_THROW(processInfo(InfoType::PriorityBoost), Exception);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,119 @@
+/**
+ * @file Process_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/Process.h"  // header to test
+
+#include <chrono>   // for milliseconds, steady_clock
+#include <csignal>  // for SIGTERM
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/Environment.h"  // for Environment
+#include "ElementsKernel/Exception.h"    // for Exception
+
+using std::string;
+
+namespace Elements {
+
+using System::Process;
+using System::Redirection;
+using System::SpawnOptions;
+
+BOOST_AUTO_TEST_SUITE(Process_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Run_test) {
+
+  // the arguments are not interpreted by a shell
+  const auto result = Process::run({"echo", "a  b", "$HOME"});
+
+  BOOST_CHECK_EQUAL(result.exit_code, 0);
+  BOOST_CHECK_EQUAL(result.output, "a  b $HOME\n");
+  BOOST_CHECK(result.error.empty());
+  BOOST_CHECK(not result.timed_out);
+}
+
+BOOST_AUTO_TEST_CASE(ErrorAndExitCode_test) {
+
+  const auto result = Process::run({"sh", "-c", "echo out; echo err >&2; exit 3"});
+
+  BOOST_CHECK_EQUAL(result.exit_code, 3);
+  BOOST_CHECK_EQUAL(result.output, "out\n");
+  BOOST_CHECK_EQUAL(result.error, "err\n");
+
+  BOOST_CHECK_THROW(Process::spawn({"Kd8dj3ma9s_not_a_command"}), Exception);
+  BOOST_CHECK_THROW(Process::spawn({}), Exception);
+}
+
+BOOST_AUTO_TEST_CASE(Environment_test) {
+
+  Environment local{Environment::overlay};
+  local["Ksk3mdqp8a"] = "overlay value";
+  local.unSet("PATH");
+
+  const auto block  = local.block();
+  const auto result = Process::run({"/usr/bin/env"}, std::chrono::milliseconds{0}, &block);
+
+  BOOST_CHECK(result.output.find("Ksk3mdqp8a=overlay value\n") != string::npos);
+  BOOST_CHECK(result.output.find("\nPATH=") == string::npos);
+  BOOST_CHECK(result.output.compare(0, 5, "PATH=") != 0);
+}
+
+BOOST_AUTO_TEST_CASE(Timeout_test) {
+
+  const auto start  = std::chrono::steady_clock::now();
+  const auto result = Process::run({"sleep", "10"}, std::chrono::milliseconds{100});
+
+  BOOST_CHECK(result.timed_out);
+  BOOST_CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds{5});
+}
+
+BOOST_AUTO_TEST_CASE(NonBlockingWait_test) {
+
+  SpawnOptions options;
+  options.standard_output = Redirection::null;
+
+  auto process = Process::spawn({"sleep", "10"}, options);
+  BOOST_CHECK(process.pid() > 0);
+  BOOST_CHECK_EQUAL(process.outputDescriptor(), -1);
+  BOOST_CHECK(not process.tryWait());
+  BOOST_CHECK(not process.waitFor(std::chrono::milliseconds{20}));
+  BOOST_CHECK(not process.finished());
+
+  process.kill(SIGTERM);
+  BOOST_CHECK(process.waitFor(std::chrono::seconds{5}));
+  BOOST_CHECK(process.finished());
+  BOOST_CHECK_EQUAL(process.exitCode(), 128 + SIGTERM);
+
+  auto quick = Process::spawn({"true"});
+  BOOST_CHECK_EQUAL(quick.wait(), 0);
+  BOOST_CHECK(quick.tryWait());
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,234 @@
+/**
+ * @file StackTrace_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/StackTrace.h"  // header to test
+
+#include <dlfcn.h>   // for dlopen, dlclose
+#include <unistd.h>  // for pipe, read, close
+
+#include <algorithm>  // for count
+#include <csignal>    // for raise, signal, SIGUSR1
+#include <cstddef>    // for size_t
+#include <set>        // for set
+#include <string>     // for string
+#include <vector>     // for vector
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/System.h"  // for backTrace
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+using System::StackTrace;
+
+namespace {
+
+StackTrace signal_trace;
+
+void handler(int) {
+  signal_trace.capture();
+}
+
+__attribute__((noinline)) StackTrace innerCapture() {
+  StackTrace trace;
+  trace.capture();
+  return trace;
+}
+
+__attribute__((noinline)) StackTrace outerCapture() {
+  auto trace = innerCapture();
+  // prevents the tail call
+  asm volatile("");
+  return trace;
+}
+
+bool hasFunction(const std::vector<System::StackFrame>& frames, const string& name) {
+  for (const auto& f : frames) {
+    if (f.function.find(name) != string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(StackTrace_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Capture_test) {
+
+  const auto trace = outerCapture();
+  BOOST_REQUIRE(trace.size() > 2);
+  BOOST_CHECK(trace[trace.size()] == nullptr);
+
+  const auto frames = trace.symbolize();
+  BOOST_REQUIRE_EQUAL(frames.size(), trace.size());
+  BOOST_CHECK_EQUAL(frames[0].address, trace[0]);
+  BOOST_CHECK(frames[0].library.find("StackTrace_test") != string::npos);
+  BOOST_CHECK(hasFunction(frames, "main"));
+
+  // the symbols come from the cache the second time. The recursive calls share their addresses
+  std::set<void*> addresses;
+  for (size_t i = 0; i < trace.size(); ++i) {
+    addresses.insert(trace[i]);
+  }
+  BOOST_CHECK_EQUAL(StackTrace::symbolCacheSize(), addresses.size());
+  const auto cached_frames = trace.symbolize();
+  for (size_t i = 0; i < frames.size(); ++i) {
+    BOOST_CHECK_EQUAL(cached_frames[i].function, frames[i].function);
+  }
+
+  StackTrace::clearSymbolCache();
+  BOOST_CHECK_EQUAL(StackTrace::symbolCacheSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Skip_test) {
+
+  StackTrace full;
+  full.capture();
+  StackTrace skipped;
+  skipped.capture(1);
+
+  BOOST_CHECK_EQUAL(skipped.size() + 1, full.size());
+  BOOST_CHECK_EQUAL(skipped[0], full[1]);
+
+  StackTrace empty;
+  empty.capture(1000);
+  BOOST_CHECK_EQUAL(empty.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Depth_test) {
+
+  StackTrace full;
+  full.capture();
+  BOOST_REQUIRE(full.size() > 2);
+
+  // the outer frames are dropped
+  StackTrace shallow;
+  shallow.capture(0, 2);
+  BOOST_REQUIRE_EQUAL(shallow.size(), 2);
+  BOOST_CHECK_EQUAL(shallow[1], full[1]);
+  BOOST_CHECK(shallow[2] == nullptr);
+
+  StackTrace empty;
+  empty.capture(0, 0);
+  BOOST_CHECK_EQUAL(empty.size(), 0);
+
+  BOOST_CHECK(System::backTrace(1, 0).size() <= 1);
+}
+
+BOOST_AUTO_TEST_CASE(LoaderChange_test) {
+
+  outerCapture().symbolize();
+  BOOST_REQUIRE(StackTrace::symbolCacheSize() > 0);
+
+  // an already loaded library doesn't change the loader
+  void* handle = ::dlopen("libresolv.so.2", RTLD_LAZY | RTLD_NOLOAD);
+  if (handle != nullptr) {
+    ::dlclose(handle);
+    return;
+  }
+  handle = ::dlopen("libresolv.so.2", RTLD_LAZY | RTLD_LOCAL);
+  if (handle == nullptr) {
+    return;
+  }
+  ::dlclose(handle);
+
+  // the addresses of the unloaded library can be reused: the cache is dropped
+  StackTrace().symbolize();
+  BOOST_CHECK_EQUAL(StackTrace::symbolCacheSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SignalHandler_test) {
+
+  auto previous = std::signal(SIGUSR1, handler);
+  std::raise(SIGUSR1);
+  std::signal(SIGUSR1, previous);
+
+  BOOST_REQUIRE(signal_trace.size() > 0);
+  // the handler is run on the stack of the test
+  bool in_test = false;
+  for (const auto& f : signal_trace.symbolize()) {
+    in_test = in_test or f.library.find("StackTrace_test") != string::npos;
+  }
+  BOOST_CHECK(in_test);
+
+  int descriptors[2];
+  BOOST_REQUIRE_EQUAL(::pipe(descriptors), 0);
+  signal_trace.write(descriptors[1]);
+  ::close(descriptors[1]);
+
+  string output;
+  char   buffer[256];
+  for (ssize_t count = ::read(descriptors[0], buffer, sizeof(buffer)); count > 0;
+       count         = ::read(descriptors[0], buffer, sizeof(buffer))) {
+    output.append(buffer, static_cast<size_t>(count));
+  }
+  ::close(descriptors[0]);
+
+  BOOST_CHECK_EQUAL(output.compare(0, 2, "0x"), 0);
+  BOOST_CHECK_EQUAL(static_cast<size_t>(std::count(output.begin(), output.end(), '\n')), signal_trace.size());
+}
+
+BOOST_AUTO_TEST_CASE(Lines_test) {
+
+  StackTrace trace;
+  trace.capture();
+
+  const auto frames = trace.symbolize(true);
+  BOOST_REQUIRE(not frames.empty());
+
+  // only with addr2line and the debug information
+  if (not frames[0].file.empty()) {
+    BOOST_CHECK(hasFunction(frames, "Lines_test"));
+    BOOST_CHECK(frames[0].file.find("StackTrace_test.cpp") != string::npos);
+    BOOST_CHECK(frames[0].line > 0);
+    BOOST_CHECK(System::formatStackFrame(1, frames[0]).find("StackTrace_test.cpp:") != string::npos);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Format_test) {
+
+  System::StackFrame frame{nullptr, reinterpret_cast<void*>(0x1f), "function", "library", "", 0};
+
+  BOOST_CHECK_EQUAL(System::formatStackFrame(1, frame), "#1  0x1f function  [library]");
+  BOOST_CHECK_EQUAL(System::formatStackFrame(1000, frame), "#10000x1f function  [library]");
+
+  frame.file = "file.cpp";
+  frame.line = 12;
+  BOOST_CHECK_EQUAL(System::formatStackFrame(12, frame), "#12 0x1f function  [library] file.cpp:12");
+
+  const auto trace = System::backTrace(21);
+  BOOST_REQUIRE(not trace.empty());
+  BOOST_CHECK(trace[0].find("#1  ") == 0);
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,280 @@
+/**
+ * @file StorageBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/Storage.h"
+
+#include <algorithm>  // for max
+#include <atomic>     // for atomic
+#include <cmath>      // for pow, log10
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int64_t
+#include <iomanip>    // for setprecision
+#include <iostream>   // for cout
+#include <map>        // for map
+#include <sstream>    // for ostringstream
+#include <string>     // for string
+#include <thread>     // for thread, hardware_concurrency
+#include <vector>     // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Number.h"  // for numberCast
+
+#include "Benchmark.h"  // for nanoSecondsPerCall, microSecondsPerCall, report
+
+using std::int64_t;
+using std::size_t;
+
+namespace Elements {
+
+using Benchmark::microSecondsPerCall;
+using Benchmark::nanoSecondsPerCall;
+using Benchmark::report;
+
+using Kernel::Units::StorageType;
+
+namespace {
+
+constexpr size_t iterations{1 << 20};
+
+/// the former implementation, based on map lookups and runtime pow/log10
+template <typename T>
+T legacyStorageConvert(const T& size, StorageType source_unit, StorageType target_unit) {
+
+  static std::map<StorageType, int64_t> factors{{StorageType::Byte, 1},
+                                                {StorageType::KiloByte, std::pow(2, 10)},
+                                                {StorageType::MegaByte, std::pow(2, 20)},
+                                                {StorageType::GigaByte, std::pow(2, 30)},
+                                                {StorageType::TeraByte, std::pow(2, 40)},
+                                                {StorageType::PetaByte, std::pow(2, 50)},
+                                                {StorageType::MetricKiloByte, std::pow(10, 3)},
+                                                {StorageType::MetricMegaByte, std::pow(10, 6)},
+                                                {StorageType::MetricGigaByte, std::pow(10, 9)},
+                                                {StorageType::MetricTeraByte, std::pow(10, 12)},
+                                                {StorageType::MetricPetaByte, std::pow(10, 15)}};
+
+  T converted_value = size;
+
+  if (source_unit != target_unit) {
+    T       size_in_bytes = size * T(factors[source_unit]);
+    int64_t target_factor = factors[target_unit];
+    auto    max_digits    = static_cast<size_t>(std::log10(static_cast<double>(target_factor)));
+    int64_t round_factor  = int64_t(std::pow(10, max_digits));
+    double  value         = std::round(static_cast<double>(size_in_bytes) / static_cast<double>(target_factor) *
+                                  static_cast<double>(round_factor)) /
+                   static_cast<double>(round_factor);
+    converted_value = numberCast<T>(value);
+  }
+
+  return converted_value;
+}
+
+std::vector<int64_t> fileSizes() {
+  std::vector<int64_t> sizes(1024);
+  int64_t              value = 1;
+  for (auto& s : sizes) {
+    value = (value * 6364136223846793005LL + 1442695040888963407LL) & ((int64_t{1} << 42) - 1);
+    s     = value;
+  }
+  return sizes;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(StorageBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(StorageConvertInteger_test) {
+
+  using Kernel::Units::storageConvert;
+
+  const auto sizes = fileSizes();
+  int64_t    sum   = 0;
+  int64_t    ref   = 0;
+
+  double new_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    sum += storageConvert(sizes[i % sizes.size()], StorageType::Byte, StorageType::MegaByte);
+  });
+  double old_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    ref += legacyStorageConvert(sizes[i % sizes.size()], StorageType::Byte, StorageType::MegaByte);
+  });
+
+  report("storageConvert<int64_t>", new_time, old_time);
+
+  BOOST_CHECK_EQUAL(sum, ref);
+}
+
+BOOST_AUTO_TEST_CASE(StorageConvertDouble_test) {
+
+  using Kernel::Units::storageConvert;
+
+  const auto sizes = fileSizes();
+  double     sum   = 0.0;
+  double     ref   = 0.0;
+
+  double new_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    sum += storageConvert(static_cast<double>(sizes[i % sizes.size()]), StorageType::Byte, StorageType::GigaByte);
+  });
+  double old_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    ref += legacyStorageConvert(static_cast<double>(sizes[i % sizes.size()]), StorageType::Byte,
+                                StorageType::GigaByte);
+  });
+
+  report("storageConvert<double>", new_time, old_time);
+
+  BOOST_CHECK_CLOSE(sum, ref, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(FormatParseStorage_test) {
+
+  using Kernel::Units::bestStorageUnit;
+  using Kernel::Units::formatStorage;
+  using Kernel::Units::parseStorage;
+  using Kernel::Units::storageFactor;
+  using Kernel::Units::storageShortName;
+
+  const auto sizes = fileSizes();
+  char       buffer[32];
+  size_t     length = 0;
+
+  double format_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    length += formatStorage(sizes[i % sizes.size()], buffer, sizeof(buffer));
+  });
+  double stream_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    const int64_t      size = sizes[i % sizes.size()];
+    const auto         unit = bestStorageUnit(size);
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(1) << static_cast<double>(size) / static_cast<double>(storageFactor(unit))
+         << " " << storageShortName(unit);
+    length -= text.str().size();
+  });
+
+  report("formatStorage", format_time, stream_time);
+
+  int64_t parsed = 0;
+  bool    all_ok = true;
+
+  double parse_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    int64_t value;
+    all_ok = parseStorage("3.2 GiB", 7, value) and all_ok;
+    parsed += value + static_cast<int64_t>(i % 2);
+  });
+  double istream_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    std::istringstream text("3.2 GiB");
+    double             value;
+    std::string        unit;
+    text >> value >> unit;
+    parsed -= std::llround(value * static_cast<double>(storageFactor(StorageType::GigaByte))) +
+              static_cast<int64_t>(i % 2);
+  });
+
+  report("parseStorage", parse_time, istream_time);
+
+  BOOST_CHECK(all_ok);
+  BOOST_CHECK_EQUAL(parsed, 0);
+}
+
+BOOST_AUTO_TEST_CASE(StorageParallel_test) {
+
+  using Kernel::Units::formatStorage;
+  using Kernel::Units::parseStorage;
+  using Kernel::Units::storageConvert;
+  using Kernel::Units::StorageFactor;
+  using Kernel::Units::storageFactor;
+  using Kernel::Units::StorageShortName;
+  using Kernel::Units::storageShortName;
+  using Kernel::Units::STORAGE_TYPE_NUMBER;
+
+  const auto sizes = fileSizes();
+
+  // one unit of work: conversions, formatting, parsing and table lookups
+  auto work = [&sizes](size_t loops, std::atomic<size_t>& errors) {
+    int64_t checksum = 0;
+    char    buffer[32];
+    for (size_t l = 0; l < loops; ++l) {
+      for (size_t i = 0; i < sizes.size(); ++i) {
+        const auto unit = static_cast<StorageType>(i % STORAGE_TYPE_NUMBER);
+        checksum += storageConvert(sizes[i], StorageType::Byte, unit);
+        if (StorageFactor[unit] != storageFactor(unit) or StorageShortName[unit] != storageShortName(unit)) {
+          ++errors;
+        }
+        int64_t parsed = 0;
+        size_t  length = formatStorage(sizes[i], StorageType::Byte, buffer, sizeof(buffer));
+        if (not parseStorage(buffer, length, parsed) or parsed != sizes[i]) {
+          ++errors;
+        }
+      }
+    }
+    return checksum;
+  };
+
+  constexpr size_t    loops{64};
+  std::atomic<size_t> errors{0};
+  const int64_t       reference = work(loops, errors);
+
+  const size_t max_threads = std::max(2U, std::thread::hardware_concurrency());
+  double       single_time = 0.0;
+
+  for (size_t thread_number = 1; thread_number <= max_threads; thread_number *= 2) {
+
+    std::vector<int64_t>     checksums(thread_number, 0);
+    std::vector<std::thread> threads;
+
+    // the threads are started and joined in the measured call
+    const double call_time = microSecondsPerCall(1, [&](size_t) {
+      for (size_t t = 0; t < thread_number; ++t) {
+        threads.emplace_back([&, t]() {
+          checksums[t] = work(loops, errors);
+        });
+      }
+      for (auto& t : threads) {
+        t.join();
+      }
+    });
+    const double elapsed = call_time / 1.0e6;
+
+    for (const auto c : checksums) {
+      BOOST_CHECK_EQUAL(c, reference);
+    }
+
+    if (thread_number == 1) {
+      single_time = elapsed;
+    }
+    // each thread does the same amount of work: the ideal speedup is the number of threads
+    std::cout << std::fixed << std::setprecision(2) << "storage tables with " << thread_number
+              << " threads: " << static_cast<double>(thread_number * loops * sizes.size()) / elapsed / 1.0e6
+              << " Mop/s (speedup: " << single_time * static_cast<double>(thread_number) / elapsed << ")"
+              << std::endl;
+  }
+
+  BOOST_CHECK_EQUAL(errors.load(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -22,7 +22,11 @@
 #include "ElementsKernel/Storage.h"
 
 #include <boost/test/unit_test.hpp>
+#include <cmath>
 #include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
 
 #include "ElementsKernel/MathConstants.h"  // For pi
 #include "ElementsKernel/Real.h"           // For isEqual
@@ -76,6 +80,26 @@ BOOST_AUTO_TEST_CASE(StorageShortName_test) {
   BOOST_CHECK_EQUAL(StorageShortName[StorageType::MetricPetaByte], "PB");
 }
 
+BOOST_AUTO_TEST_CASE(StorageTable_test) {
+
+  using Kernel::Units::StorageFactor;
+  using Kernel::Units::STORAGE_TYPE_NUMBER;
+
+  BOOST_CHECK_EQUAL(StorageFactor.size(), STORAGE_TYPE_NUMBER);
+  BOOST_CHECK_EQUAL(StorageFactor.count(StorageType::TeraByte), 1);
+  BOOST_CHECK_EQUAL(StorageFactor.at(StorageType::TeraByte), 1099511627776);
+  BOOST_CHECK(StorageFactor.find(StorageType::MetricMegaByte)->first == StorageType::MetricMegaByte);
+  BOOST_CHECK_EQUAL(StorageFactor.find(StorageType::MetricMegaByte)->second, 1000000);
+
+  BOOST_CHECK(StorageFactor.find(static_cast<StorageType>(STORAGE_TYPE_NUMBER)) == StorageFactor.end());
+  BOOST_CHECK_THROW(StorageFactor.at(static_cast<StorageType>(STORAGE_TYPE_NUMBER)), std::out_of_range);
+
+  std::size_t index = 0;
+  for (const auto& f : StorageFactor) {
+    BOOST_CHECK(f.first == static_cast<StorageType>(index++));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(RoundToDigits_test) {
 
   using Kernel::Units::pi;
@@ -159,6 +183,138 @@ BOOST_AUTO_TEST_CASE(StorageConvertMetric_test) {
   BOOST_CHECK_EQUAL(storageConvert<9>(size, StorageType::MetricMegaByte, StorageType::MetricKiloByte), 1000);
 }
 
+BOOST_AUTO_TEST_CASE(StorageFactorTable_test) {
+
+  using Kernel::Units::storageDigits;
+  using Kernel::Units::storageFactor;
+  using Kernel::Units::StorageFactor;
+  using Kernel::Units::storageShortName;
+  using Kernel::Units::StorageShortName;
+
+  static_assert(storageFactor(StorageType::GigaByte) == 1073741824, "wrong constexpr factor");
+
+  for (const auto& f : StorageFactor) {
+    BOOST_CHECK_EQUAL(storageFactor(f.first), f.second);
+    BOOST_CHECK_EQUAL(storageShortName(f.first), StorageShortName[f.first]);
+    BOOST_CHECK_EQUAL(storageDigits(f.first), static_cast<std::size_t>(std::log10(static_cast<double>(f.second))));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StorageConvertExact_test) {
+
+  // 2^62 bytes cannot be represented exactly through a double conversion with
+  // the rounding digits
+  int64_t size{4096};
+
+  BOOST_CHECK_EQUAL(storageConvert(size, StorageType::PetaByte, StorageType::Byte), int64_t{1} << 62);
+  BOOST_CHECK_EQUAL(storageConvert((int64_t{1} << 62) + 1, StorageType::Byte, StorageType::PetaByte), size);
+
+  BOOST_CHECK_EQUAL(storageConvert(int64_t{1536}, StorageType::Byte, StorageType::KiloByte), 2);
+  BOOST_CHECK_EQUAL(storageConvert(int64_t{1535}, StorageType::Byte, StorageType::KiloByte), 1);
+  BOOST_CHECK_EQUAL(storageConvert(int64_t{-1536}, StorageType::Byte, StorageType::KiloByte), -2);
+
+  BOOST_CHECK_EQUAL(storageConvert(int64_t{1}, StorageType::MetricMegaByte, StorageType::KiloByte), 977);
+  BOOST_CHECK_EQUAL(storageConvert(int64_t{1}, StorageType::GigaByte, StorageType::MetricKiloByte), 1073742);
+
+  // the intermediate products are beyond the mantissa of the extended precision
+  const int64_t max_size = std::numeric_limits<int64_t>::max();
+  BOOST_CHECK_EQUAL(storageConvert(max_size, StorageType::MetricKiloByte, StorageType::KiloByte),
+                    int64_t{9007199254740991999});
+  BOOST_CHECK_EQUAL(storageConvert(-max_size, StorageType::MetricKiloByte, StorageType::KiloByte),
+                    int64_t{-9007199254740991999});
+  BOOST_CHECK_EQUAL(storageConvert(max_size, StorageType::MetricKiloByte, StorageType::PetaByte), 8192000);
+  BOOST_CHECK_EQUAL(storageConvert(int64_t{8191}, StorageType::PetaByte, StorageType::MetricPetaByte), 9222);
+}
+
+BOOST_AUTO_TEST_CASE(StorageConvertOverflow_test) {
+
+  BOOST_CHECK_EQUAL(storageConvert(int64_t{8191}, StorageType::PetaByte, StorageType::Byte), int64_t{8191} << 50);
+  BOOST_CHECK_THROW(storageConvert(int64_t{8192}, StorageType::PetaByte, StorageType::Byte), std::overflow_error);
+  BOOST_CHECK_THROW(storageConvert(int64_t{-8193}, StorageType::PetaByte, StorageType::Byte), std::overflow_error);
+  BOOST_CHECK_THROW(storageConvert(int64_t{10000000}, StorageType::PetaByte, StorageType::MetricKiloByte),
+                    std::overflow_error);
+
+  // the range of the target type is checked too
+  BOOST_CHECK_EQUAL(storageConvert(std::int32_t{1}, StorageType::GigaByte, StorageType::Byte), std::int32_t{1} << 30);
+  BOOST_CHECK_THROW(storageConvert(std::int32_t{2}, StorageType::GigaByte, StorageType::Byte), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(FormatStorage_test) {
+
+  using Kernel::Units::bestStorageUnit;
+  using Kernel::Units::formatStorage;
+
+  char buffer[32];
+
+  BOOST_CHECK(bestStorageUnit(1023) == StorageType::Byte);
+  BOOST_CHECK(bestStorageUnit(1024) == StorageType::KiloByte);
+  BOOST_CHECK(bestStorageUnit(999, true) == StorageType::Byte);
+  BOOST_CHECK(bestStorageUnit(1000000, true) == StorageType::MetricMegaByte);
+
+  BOOST_CHECK_EQUAL(formatStorage(3435973837, buffer, sizeof(buffer)), 7);
+  BOOST_CHECK_EQUAL(std::string(buffer), "3.2 GiB");
+
+  formatStorage(512, buffer, sizeof(buffer));
+  BOOST_CHECK_EQUAL(std::string(buffer), "512 B");
+
+  formatStorage(1500000, buffer, sizeof(buffer), 2, true);
+  BOOST_CHECK_EQUAL(std::string(buffer), "1.50 MB");
+
+  formatStorage(-2048, buffer, sizeof(buffer));
+  BOOST_CHECK_EQUAL(std::string(buffer), "-2.0 KiB");
+
+  // rounding with carry propagation
+  formatStorage(1048535, buffer, sizeof(buffer));
+  BOOST_CHECK_EQUAL(std::string(buffer), "1024.0 KiB");
+
+  formatStorage(1048576, StorageType::KiloByte, buffer, sizeof(buffer), 0);
+  BOOST_CHECK_EQUAL(std::string(buffer), "1024 KiB");
+
+  // too small buffer
+  BOOST_CHECK_EQUAL(formatStorage(3435973837, buffer, 7), 0);
+  BOOST_CHECK_EQUAL(std::string(buffer), "");
+}
+
+BOOST_AUTO_TEST_CASE(ParseStorage_test) {
+
+  using Kernel::Units::formatStorage;
+  using Kernel::Units::parseStorage;
+
+  int64_t size{0};
+
+  BOOST_CHECK(parseStorage("3.2 GiB", size));
+  BOOST_CHECK_EQUAL(size, 3435973837);
+
+  BOOST_CHECK(parseStorage(" 12KB ", size));
+  BOOST_CHECK_EQUAL(size, 12000);
+
+  BOOST_CHECK(parseStorage("1.5", size));
+  BOOST_CHECK_EQUAL(size, 2);
+
+  BOOST_CHECK(parseStorage("-.5 KiB", size));
+  BOOST_CHECK_EQUAL(size, -512);
+
+  BOOST_CHECK(parseStorage("8191 PiB", size));
+  BOOST_CHECK_EQUAL(size, int64_t{8191} << 50);
+
+  size = 42;
+  BOOST_CHECK(not parseStorage("", size));
+  BOOST_CHECK(not parseStorage(".", size));
+  BOOST_CHECK(not parseStorage("GiB", size));
+  BOOST_CHECK(not parseStorage("1 XB", size));
+  BOOST_CHECK(not parseStorage("1 GiB trailing", size));
+  BOOST_CHECK(not parseStorage("8192 PiB", size));
+  BOOST_CHECK(not parseStorage("99999999999999999999", size));
+  BOOST_CHECK_EQUAL(size, 42);
+
+  char buffer[32];
+  for (int64_t value : {int64_t{0}, int64_t{1}, int64_t{1023}, int64_t{1} << 40, int64_t{123456789}}) {
+    formatStorage(value, StorageType::Byte, buffer, sizeof(buffer));
+    BOOST_CHECK(parseStorage(buffer, size));
+    BOOST_CHECK_EQUAL(size, value);
+  }
+}
+
 //-----------------------------------------------------------------------------
 // End of the Boost tests
 BOOST_AUTO_TEST_SUITE_END()
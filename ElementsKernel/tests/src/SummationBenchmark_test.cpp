@@ -0,0 +1,150 @@
+/**
+ * @file SummationBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/Summation.h"
+
+#include <cmath>     // for abs
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint64_t
+#include <iomanip>   // for setprecision
+#include <iostream>  // for cout
+#include <limits>    // for numeric_limits
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "Benchmark.h"  // for nanoSecondsPerCall
+
+using std::size_t;
+
+namespace Elements {
+
+using Benchmark::nanoSecondsPerCall;
+
+namespace {
+
+constexpr size_t element_number{1 << 22};
+constexpr size_t repetitions{8};
+
+/// random values spanning several orders of magnitude, with both signs
+std::vector<double> randomValues() {
+  std::vector<double> values(element_number);
+  std::uint64_t       state = 1;
+  for (auto& v : values) {
+    state                 = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    const double mantissa = static_cast<double>(state >> 11) / static_cast<double>(1ULL << 53);
+    v                     = (mantissa - 0.3) * static_cast<double>(1ULL << ((state >> 3) % 32));
+  }
+  return values;
+}
+
+/// reference sum in extended precision, merged with a compensated sum
+double referenceSum(const std::vector<double>& values) {
+  CompensatedSum<long double> sum;
+  for (const auto v : values) {
+    sum.add(static_cast<long double>(v));
+  }
+  return static_cast<double>(sum.value());
+}
+
+template <typename F>
+double nanoSecondsPerElement(F&& func, double& result) {
+  const double pass_time = nanoSecondsPerCall(repetitions, [&func, &result](size_t) {
+    result = func();
+  });
+  return pass_time / static_cast<double>(element_number);
+}
+
+void report(const std::string& name, double time, double result, double reference) {
+  std::cout << std::setprecision(3) << name << ": " << std::fixed << time << " ns/element, relative error "
+            << std::scientific << std::abs(result - reference) / std::abs(reference) << std::endl;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(SummationBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(Summation_test) {
+
+  const auto   values    = randomValues();
+  const double reference = referenceSum(values);
+  const auto   first     = values.data();
+  const auto   last      = values.data() + values.size();
+
+  double naive    = 0.0;
+  double kahan    = 0.0;
+  double pairwise = 0.0;
+  double blocked  = 0.0;
+  double parallel = 0.0;
+
+  // the timings are taken first: the results are only known afterwards
+  const double naive_time = nanoSecondsPerElement(
+      [&]() {
+        return naiveSum(first, last);
+      },
+      naive);
+  const double kahan_time = nanoSecondsPerElement(
+      [&]() {
+        return kahanSum(first, last);
+      },
+      kahan);
+  const double pairwise_time = nanoSecondsPerElement(
+      [&]() {
+        return pairwiseSum(first, last);
+      },
+      pairwise);
+  const double blocked_time = nanoSecondsPerElement(
+      [&]() {
+        return blockedKahanSum(first, last);
+      },
+      blocked);
+  const double parallel_time = nanoSecondsPerElement(
+      [&]() {
+        return parallelSum(first, values.size());
+      },
+      parallel);
+
+  report("naive loop", naive_time, naive, reference);
+  report("kahanSum", kahan_time, kahan, reference);
+  report("pairwiseSum", pairwise_time, pairwise, reference);
+  report("blockedKahanSum", blocked_time, blocked, reference);
+  report("parallelSum", parallel_time, parallel, reference);
+
+  // the compensated kernels are exact up to the final rounding
+  const double tolerance = 4.0 * std::numeric_limits<double>::epsilon() * std::abs(reference);
+  BOOST_CHECK_LE(std::abs(kahan - reference), tolerance);
+  BOOST_CHECK_LE(std::abs(blocked - reference), tolerance);
+  BOOST_CHECK_LE(std::abs(parallel - reference), tolerance);
+  BOOST_CHECK_LE(std::abs(pairwise - reference), std::abs(naive - reference) + tolerance);
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -0,0 +1,161 @@
+/**
+ * @file Summation_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "ElementsKernel/Summation.h"  // The interface to test
+
+#include <cmath>    // for abs
+#include <cstddef>  // for size_t
+#include <list>     // for list
+#include <vector>   // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Real.h"  // for isEqual
+
+using std::size_t;
+using std::vector;
+
+namespace Elements {
+
+namespace {
+
+/// one large value followed by many small ones: the naive loop drops all the small ones
+vector<double> illConditioned(size_t size) {
+  vector<double> values(size, 1.0e-16);
+  values[0] = 1.0;
+  return values;
+}
+
+double illConditionedSum(size_t size) {
+  return static_cast<double>(1.0L + static_cast<long double>(size - 1) * static_cast<long double>(1.0e-16));
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+BOOST_AUTO_TEST_SUITE(Summation_test)
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Empty_test) {
+
+  const vector<double> empty{};
+
+  BOOST_CHECK(isEqual(naiveSum(empty.cbegin(), empty.cend()), 0.0));
+  BOOST_CHECK(isEqual(kahanSum(empty.cbegin(), empty.cend()), 0.0));
+  BOOST_CHECK(isEqual(pairwiseSum(empty.cbegin(), empty.cend()), 0.0));
+  BOOST_CHECK(isEqual(blockedKahanSum(empty.cbegin(), empty.cend()), 0.0));
+  BOOST_CHECK(isEqual(parallelSum(empty.data(), empty.size()), 0.0));
+}
+
+BOOST_AUTO_TEST_CASE(Exact_test) {
+
+  // small integers are summed exactly by every kernel
+  vector<double> values(1000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<double>(i + 1);
+  }
+  const double expected = 500500.0;
+
+  BOOST_CHECK(isEqual(naiveSum(values.cbegin(), values.cend()), expected));
+  BOOST_CHECK(isEqual(kahanSum(values.cbegin(), values.cend()), expected));
+  BOOST_CHECK(isEqual(pairwiseSum(values.cbegin(), values.cend()), expected));
+  BOOST_CHECK(isEqual(blockedKahanSum(values.cbegin(), values.cend()), expected));
+  BOOST_CHECK(isEqual(parallelSum(values.data(), values.size(), 4), expected));
+
+  const vector<float> float_values(values.cbegin(), values.cend());
+  BOOST_CHECK(isEqual(blockedKahanSum(float_values.cbegin(), float_values.cend()), 500500.0f));
+  BOOST_CHECK(isEqual(parallelSum(float_values.data(), float_values.size()), 500500.0f));
+
+  // not random access
+  const std::list<double> list_values(values.cbegin(), values.cend());
+  BOOST_CHECK(isEqual(kahanSum(list_values.cbegin(), list_values.cend()), expected));
+  BOOST_CHECK(isEqual(pairwiseSum(list_values.cbegin(), list_values.cend()), expected));
+  BOOST_CHECK(isEqual(blockedKahanSum(list_values.cbegin(), list_values.cend()), expected));
+}
+
+BOOST_AUTO_TEST_CASE(Cancellation_test) {
+
+  // the large terms cancel out. The compensation term keeps track of the small ones.
+  const vector<double> values{1.0, 1.0e100, 1.0, -1.0e100};
+
+  BOOST_CHECK(isEqual(naiveSum(values.cbegin(), values.cend()), 0.0));
+  BOOST_CHECK(isEqual(kahanSum(values.cbegin(), values.cend()), 2.0));
+  BOOST_CHECK(isEqual(blockedKahanSum(values.cbegin(), values.cend()), 2.0));
+
+  // the same pattern spread over all the lanes
+  vector<double> lane_values;
+  for (size_t i = 0; i < 4 * SUMMATION_LANE_NUMBER; ++i) {
+    lane_values.insert(lane_values.end(), values.cbegin(), values.cend());
+  }
+  BOOST_CHECK(isEqual(blockedKahanSum(lane_values.cbegin(), lane_values.cend()),
+                      static_cast<double>(8 * SUMMATION_LANE_NUMBER)));
+
+  CompensatedSum<double> sum;
+  for (const auto v : values) {
+    sum += v;
+  }
+  BOOST_CHECK(isEqual(sum.value(), 2.0));
+}
+
+BOOST_AUTO_TEST_CASE(Accuracy_test) {
+
+  constexpr size_t size{1 << 20};
+  const auto       values   = illConditioned(size);
+  const double     expected = illConditionedSum(size);
+
+  const double naive_error = std::abs(naiveSum(values.cbegin(), values.cend()) - expected);
+
+  BOOST_CHECK(isEqual(kahanSum(values.cbegin(), values.cend()), expected));
+  BOOST_CHECK(isEqual(blockedKahanSum(values.cbegin(), values.cend()), expected));
+  BOOST_CHECK(isEqual(parallelSum(values.data(), values.size(), 4), expected));
+  BOOST_CHECK(std::abs(pairwiseSum(values.cbegin(), values.cend()) - expected) < naive_error);
+}
+
+BOOST_AUTO_TEST_CASE(Merge_test) {
+
+  const auto   values   = illConditioned(1000);
+  const double expected = illConditionedSum(1000);
+
+  CompensatedSum<double> first;
+  CompensatedSum<double> second;
+  for (size_t i = 0; i < values.size(); ++i) {
+    (i < 500 ? first : second).add(values[i]);
+  }
+  first.merge(second);
+
+  BOOST_CHECK(isEqual(first.value(), expected));
+}
+
+BOOST_AUTO_TEST_CASE(ParallelThreadNumber_test) {
+
+  const auto values = illConditioned(1 << 20);
+
+  for (size_t thread_number = 0; thread_number <= 32; ++thread_number) {
+    const size_t size = values.size() - thread_number;
+    BOOST_CHECK(isEqual(parallelSum(values.data(), size, thread_number), illConditionedSum(size)));
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
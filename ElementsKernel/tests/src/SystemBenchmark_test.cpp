@@ -0,0 +1,242 @@
+/**
+ * @file SystemBenchmark_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/System.h"
+
+#include <cxxabi.h>       // for __cxa_demangle
+#include <dlfcn.h>        // for dladdr
+#include <execinfo.h>     // for backtrace
+#include <sys/utsname.h>  // for uname
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <cstdlib>     // for free
+#include <fstream>     // for ifstream
+#include <functional>  // for function
+#include <iomanip>     // for setprecision
+#include <map>         // for map
+#include <memory>      // for unique_ptr
+#include <sstream>     // for ostringstream
+#include <string>      // for string
+#include <typeinfo>    // for type_info
+#include <vector>      // for vector
+
+#include <boost/test/unit_test.hpp>
+
+#include "ElementsKernel/Environment.h"  // for Environment
+#include "ElementsKernel/ProcessInfo.h"  // for processInfo
+#include "ElementsKernel/StackTrace.h"   // for StackTrace
+
+#include "Benchmark.h"  // for microSecondsPerCall, nanoSecondsPerCall, report
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+using Benchmark::microSecondsPerCall;
+using Benchmark::nanoSecondsPerCall;
+using Benchmark::report;
+
+namespace {
+
+constexpr size_t iterations{1 << 16};
+
+/// the former implementation, which demangles at each call
+string legacyTypeinfoName(const std::type_info& tinfo) {
+  int                                    status;
+  std::unique_ptr<char, decltype(free)*> realname(abi::__cxa_demangle(tinfo.name(), 0, 0, &status), free);
+  string                                 result = realname.get();
+  string::size_type                      pos    = result.find(", ");
+  while (string::npos != pos) {
+    result.replace(pos, static_cast<string::size_type>(2), ",");
+    pos = result.find(", ");
+  }
+  return result;
+}
+
+/// the former osName, which calls uname at each call
+const string& legacyOsName() {
+  static string  osname = "";
+  struct utsname ut;
+  if (::uname(&ut) == 0) {
+    osname = ut.sysname;
+  } else {
+    osname = "UNKNOWN";
+  }
+  return osname;
+}
+
+/// the usual stream based reading of the resident memory, for comparison
+std::uint64_t streamResidentSize() {
+  std::ifstream status("/proc/self/status");
+  string        line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmRSS:") == 0) {
+      std::istringstream value(line.substr(6));
+      std::uint64_t      size;
+      value >> size;
+      return size << 10;
+    }
+  }
+  return 0;
+}
+
+/// the former backTrace: dladdr, demangling and stream formatting of every frame
+std::vector<string> legacyBackTrace(const int depth) {
+  std::vector<string> trace;
+  std::vector<void*>  addresses(static_cast<size_t>(depth));
+  const int           count = ::backtrace(addresses.data(), depth);
+  for (int i = 0; i < count; ++i) {
+    Dl_info info;
+    if (::dladdr(addresses[static_cast<size_t>(i)], &info) and info.dli_fname and info.dli_fname[0] != '\0') {
+      string function = "local";
+      if (info.dli_sname and info.dli_sname[0] != '\0') {
+        int                                    status;
+        std::unique_ptr<char, decltype(free)*> dmg(abi::__cxa_demangle(info.dli_sname, 0, 0, &status), free);
+        function = (status == 0) ? dmg.get() : info.dli_sname;
+      }
+      std::ostringstream ost;
+      ost << "#" << std::setw(3) << std::setiosflags(std::ios::left) << i + 1;
+      ost << std::hex << info.dli_saddr << std::dec << " " << function << "  [" << info.dli_fname << "]";
+      trace.emplace_back(ost.str());
+    }
+  }
+  return trace;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+//
+// Begin of the Boost tests
+//
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(SystemBenchmark_test)
+
+BOOST_AUTO_TEST_CASE(TypeinfoName_test) {
+
+  const std::vector<const std::type_info*> types{&typeid(Environment), &typeid(std::map<string, std::vector<double>>),
+                                                 &typeid(Environment::Variable), &typeid(std::vector<size_t>)};
+
+  size_t length    = 0;
+  size_t reference = 0;
+
+  double cached_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    length += System::typeinfoName(*types[i % types.size()]).size();
+  });
+  double legacy_time = nanoSecondsPerCall(iterations, [&](size_t i) {
+    reference += legacyTypeinfoName(*types[i % types.size()]).size();
+  });
+
+  report("typeinfoName", cached_time, legacy_time);
+
+  BOOST_CHECK_EQUAL(length, reference);
+
+  size_t compile_length = 0;
+  double compile_time   = nanoSecondsPerCall(iterations, [&compile_length](size_t i) {
+    compile_length +=
+        (i % 2 == 0) ? System::typeName<Environment>().size() : System::typeName<std::vector<size_t>>().size();
+  });
+
+  report("typeName", compile_time, legacy_time);
+
+  BOOST_CHECK(compile_length > 0);
+}
+
+BOOST_AUTO_TEST_CASE(HostInformation_test) {
+
+  size_t length    = 0;
+  size_t reference = 0;
+
+  double cached_time = nanoSecondsPerCall(iterations, [&length](size_t) {
+    length += System::osName().size();
+  });
+  double legacy_time = nanoSecondsPerCall(iterations, [&reference](size_t) {
+    reference += legacyOsName().size();
+  });
+
+  report("osName", cached_time, legacy_time);
+
+  BOOST_CHECK_EQUAL(length, reference);
+}
+
+BOOST_AUTO_TEST_CASE(ProcessInfo_test) {
+
+  constexpr size_t sample_iterations{1 << 12};
+
+  System::ProcessInfo info{};
+  size_t              failures    = 0;
+  std::uint64_t       stream_size = 0;
+
+  const double memory_time = nanoSecondsPerCall(sample_iterations, [&info, &failures](size_t) {
+    failures += System::processInfo(System::InfoType::Memory, info) ? 0 : 1;
+  });
+  const double stream_time = nanoSecondsPerCall(sample_iterations, [&stream_size](size_t) {
+    stream_size = streamResidentSize();
+  });
+  const double basics_time = nanoSecondsPerCall(sample_iterations, [&info, &failures](size_t) {
+    failures += System::processInfo(System::InfoType::ProcessBasics, info) ? 0 : 1;
+  });
+
+  report("processInfo(Memory)", memory_time, stream_time);
+  report("processInfo(ProcessBasics)", basics_time, stream_time);
+
+  BOOST_CHECK_EQUAL(failures, 0);
+  BOOST_CHECK(info.memory.resident_size > 0);
+  BOOST_CHECK(stream_size > 0);
+}
+
+BOOST_AUTO_TEST_CASE(BackTrace_test) {
+
+  constexpr size_t trace_iterations{1024};
+
+  size_t frame_number  = 0;
+  size_t legacy_number = 0;
+
+  const double capture_time = microSecondsPerCall(trace_iterations, [&frame_number](size_t) {
+    System::StackTrace trace;
+    trace.capture();
+    frame_number += trace.size();
+  });
+  const double symbolize_time = microSecondsPerCall(trace_iterations, [&frame_number](size_t) {
+    System::StackTrace trace;
+    trace.capture();
+    frame_number -= trace.symbolize().size();
+  });
+  const double legacy_time = microSecondsPerCall(trace_iterations, [&legacy_number](size_t) {
+    legacy_number += legacyBackTrace(21).size();
+  });
+
+  report("stack capture", capture_time, legacy_time, "us");
+  report("stack capture with cached symbols", symbolize_time, legacy_time, "us");
+
+  BOOST_CHECK_EQUAL(frame_number, 0);
+  BOOST_CHECK(legacy_number > 0);
+}
+
+//-----------------------------------------------------------------------------
+// End of the Boost tests
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
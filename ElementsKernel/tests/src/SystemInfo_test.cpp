@@ -0,0 +1,123 @@
+/**
+ * @file SystemInfo_test.cpp
+ *
+ * @date Oct 19, 2026
+ * @author Hubert Degaudenzi
+ *
+ * @copyright 2012-2020 Euclid Science Ground Segment
+ *
+ * This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either version 3.0 of the License, or (at your option)
+ * any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this library; if not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+
+#include "ElementsKernel/SystemInfo.h"  // header to test
+
+#include <unistd.h>  // for sysconf
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <string>   // for string
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+#include <boost/test/unit_test.hpp>  // for boost unit test macros
+
+#include "ElementsKernel/System.h"  // for hostName, osName, osVersion, machineType
+
+using std::size_t;
+using std::string;
+
+namespace Elements {
+
+using System::SimdFeature;
+using System::systemInfo;
+
+BOOST_AUTO_TEST_SUITE(SystemInfo_test)
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Host_test) {
+
+  const auto& info = systemInfo();
+
+  BOOST_CHECK_EQUAL(info.host_name, System::hostName());
+  BOOST_CHECK_EQUAL(info.os_name, System::osName());
+  BOOST_CHECK_EQUAL(info.os_version, System::osVersion());
+  BOOST_CHECK_EQUAL(info.machine_type, System::machineType());
+
+  // the same object every time
+  BOOST_CHECK_EQUAL(&systemInfo(), &info);
+}
+
+BOOST_AUTO_TEST_CASE(Hardware_test) {
+
+  const auto& info = systemInfo();
+
+  BOOST_CHECK_EQUAL(info.cpu_number, static_cast<size_t>(::sysconf(_SC_NPROCESSORS_ONLN)));
+  BOOST_CHECK_EQUAL(info.page_size, static_cast<size_t>(::sysconf(_SC_PAGESIZE)));
+  BOOST_CHECK(info.numa_node_number >= 1);
+  BOOST_CHECK(info.physical_memory > info.page_size);
+
+  if (info.l2_cache_size != 0 and info.l1_data_cache_size != 0) {
+    BOOST_CHECK(info.l2_cache_size >= info.l1_data_cache_size);
+  }
+  if (info.cache_line_size != 0) {
+    BOOST_CHECK_EQUAL(info.cache_line_size & (info.cache_line_size - 1), 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Simd_test) {
+
+  auto info = systemInfo();
+
+  info.simd_features = 0;
+  BOOST_CHECK(not info.hasSimd(SimdFeature::AVX));
+  BOOST_CHECK_EQUAL(info.simdFeatureNames(), "");
+
+  info.simd_features = static_cast<std::uint32_t>(SimdFeature::SSE2) | static_cast<std::uint32_t>(SimdFeature::AVX2);
+  BOOST_CHECK(info.hasSimd(SimdFeature::AVX2));
+  BOOST_CHECK(not info.hasSimd(SimdFeature::AVX));
+  BOOST_CHECK_EQUAL(info.simdFeatureNames(), "sse2 avx2");
+
+#if defined(__x86_64__)
+  // part of the x86_64 baseline
+  BOOST_CHECK(systemInfo().hasSimd(SimdFeature::SSE2));
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(Threads_test) {
+
+  std::vector<const System::SystemInfo*> infos(8, nullptr);
+  std::vector<const string*>             host_names(infos.size(), nullptr);
+  std::vector<std::thread>               threads;
+  for (size_t t = 0; t < infos.size(); ++t) {
+    threads.emplace_back([&infos, &host_names, t]() {
+      infos[t]      = &systemInfo();
+      host_names[t] = &System::hostName();
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (size_t t = 0; t < infos.size(); ++t) {
+    BOOST_CHECK_EQUAL(infos[t], &systemInfo());
+    BOOST_CHECK_EQUAL(host_names[t], &System::hostName());
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Elements
@@ -23,12 +23,19 @@
 
 #include <sys/utsname.h>
 
+#include <cstddef>   // for size_t
+#include <map>       // for map
+#include <string>    // for string
+#include <thread>    // for thread
+#include <typeinfo>  // for typeid
+#include <vector>    // for vector
+
 #include <boost/test/unit_test.hpp>
-#include <string>
-#include <vector>
+#include <boost/utility/string_view.hpp>  // for string_view
 
 #include "ElementsKernel/Environment.h"
 
+using std::size_t;
 using std::string;
 
 namespace Elements {
@@ -70,6 +77,47 @@ BOOST_AUTO_TEST_CASE(osVersion_test) {
   BOOST_CHECK_EQUAL(System::osVersion(), osver);
 }
 
+BOOST_AUTO_TEST_CASE(TypeinfoName_test) {
+
+  BOOST_CHECK_EQUAL(System::typeinfoName(typeid(int)), "int");
+  BOOST_CHECK_EQUAL(System::typeinfoName(typeid(std::map<int, double>)),
+                    "std::map<int,double,std::less<int>,std::allocator<std::pair<int const,double> > >");
+
+  // the cached value is the same, from any thread
+  const string             reference = System::typeinfoName(typeid(Environment));
+  std::vector<string>      names(4);
+  std::vector<std::thread> threads;
+  for (auto& n : names) {
+    threads.emplace_back([&n]() {
+      for (size_t i = 0; i < 1000; ++i) {
+        n = System::typeinfoName(typeid(Environment));
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (const auto& n : names) {
+    BOOST_CHECK_EQUAL(n, reference);
+  }
+  BOOST_CHECK_EQUAL(reference, "Elements::Environment");
+
+  // an address passed again with another content gets the new name
+  char mangled[] = "i";
+  BOOST_CHECK_EQUAL(System::typeinfoName(mangled), "int");
+  mangled[0] = 'd';
+  BOOST_CHECK_EQUAL(System::typeinfoName(mangled), "double");
+}
+
+BOOST_AUTO_TEST_CASE(TypeName_test) {
+
+  constexpr boost::string_view name = System::typeName<int>();
+  BOOST_CHECK_EQUAL(name, "int");
+  BOOST_CHECK_EQUAL(System::typeName<Environment>(), "Elements::Environment");
+  BOOST_CHECK_EQUAL(System::typeName<const char*>(), "const char*");
+  BOOST_CHECK(System::typeName<std::vector<int>>().starts_with("std::vector<int"));
+}
+
 //-----------------------------------------------------------------------------
 
 BOOST_AUTO_TEST_SUITE_END()
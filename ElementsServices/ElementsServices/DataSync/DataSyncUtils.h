@@ -42,8 +42,27 @@ using path = Path::Item;
 
 ELEMENTS_API path confFilePath(path filename);
 
+/**
+ * @brief Run a command and check that it succeeds.
+ * @ingroup ElementsServices
+ * @details
+ *   The command is not run by a shell. It is split into words at the
+ *   blanks, except within single or double quotes and after a
+ *   backslash (e.g. "ls 'My Documents'"). There is no other
+ *   interpretation: no variable, glob or redirection. The child gets the
+ *   process environment.
+ * @return true if the command exits with 0; false if it fails or cannot be run.
+ */
 ELEMENTS_API bool checkCall(const std::string& command);
 
+/**
+ * @brief Run a command and capture its standard output and error.
+ * @ingroup ElementsServices
+ * @details
+ *   The command is split like for checkCall.
+ * @return The standard output and the standard error.
+ * @throw std::runtime_error if the command cannot be run.
+ */
 ELEMENTS_API std::pair<std::string, std::string> runCommandAndCaptureOutErr(std::string command);
 
 ELEMENTS_API bool localDirExists(path localDir);
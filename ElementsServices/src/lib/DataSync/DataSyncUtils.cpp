@@ -17,16 +17,16 @@
  */
 
 #include <algorithm>
-#include <array>
-#include <cstdio>
-#include <cstdlib>
-#include <memory>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "ElementsKernel/Configuration.h"
 #include "ElementsKernel/Environment.h"  // For Environment
+#include "ElementsKernel/Exception.h"    // For Exception
+#include "ElementsKernel/Process.h"      // For Process
 
 #include "ElementsServices/DataSync/DataSyncUtils.h"
 
@@ -40,25 +40,81 @@ path confFilePath(path filename) {
   return Configuration::getPath(filename);
 }
 
+namespace {
+
+/// the commands are split into words like a shell does, without any expansion: the blanks separate
+/// the words, except within single or double quotes and after a backslash
+std::vector<string> splitCommand(const string& command) {
+
+  std::vector<string> arguments;
+  string              argument;
+  bool                in_argument = false;
+  char                quote       = '\0';
+
+  for (std::size_t i = 0; i < command.size(); ++i) {
+    const char c = command[i];
+    if (quote == '\'') {
+      if (c == '\'') {
+        quote = '\0';
+      } else {
+        argument += c;
+      }
+    } else if (quote == '"') {
+      if (c == '"') {
+        quote = '\0';
+      } else if (c == '\\' and i + 1 < command.size() and (command[i + 1] == '"' or command[i + 1] == '\\')) {
+        argument += command[++i];
+      } else {
+        argument += c;
+      }
+    } else if (c == ' ' or c == '\t') {
+      if (in_argument) {
+        arguments.emplace_back(std::move(argument));
+        argument.clear();
+        in_argument = false;
+      }
+    } else {
+      in_argument = true;
+      if (c == '\'' or c == '"') {
+        quote = c;
+      } else if (c == '\\' and i + 1 < command.size()) {
+        argument += command[++i];
+      } else {
+        argument += c;
+      }
+    }
+  }
+
+  if (quote != '\0') {
+    throw Exception() << "Unterminated quote in the command: " << command;
+  }
+  if (in_argument) {
+    arguments.emplace_back(std::move(argument));
+  }
+
+  return arguments;
+}
+
+}  // namespace
+
 bool checkCall(const string& command) {
-  string    silent_command = command + " > /dev/null";
-  const int status         = std::system(silent_command.c_str());
-  return status == 0;
+  System::SpawnOptions options;
+  options.standard_output = System::Redirection::null;
+  try {
+    return System::Process::spawn(splitCommand(command), options).wait() == 0;
+  } catch (const Exception&) {
+    return false;
+  }
 }
 
 std::pair<string, string> runCommandAndCaptureOutErr(string command) {
-  string                   out;
-  string                   err;
-  std::array<char, BUFSIZ> buffer;
-  std::shared_ptr<FILE>    cmdpipe(popen(command.c_str(), "r"), pclose);
-  if (not cmdpipe) {
+  System::ProcessResult result;
+  try {
+    result = System::Process::run(splitCommand(command));
+  } catch (const Exception&) {
     throw std::runtime_error(string("Unable to run command: ") + command);
   }
-  if (fgets(buffer.data(), BUFSIZ, cmdpipe.get()) != nullptr) {
-    out += buffer.data();
-  }
-  // @TODO get standard error
-  return std::make_pair(out, err);
+  return std::make_pair(result.output, result.error);
 }
 
 bool localDirExists(path local_dir) {
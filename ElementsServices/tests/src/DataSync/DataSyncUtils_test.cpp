@@ -74,6 +74,14 @@ BOOST_FIXTURE_TEST_CASE(localWorkspacePrefix_test, WorkspaceFixture) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(runCommand_quoting_test) {
+  // the quoted blanks are kept, without any shell
+  const auto outerr = DataSync::runCommandAndCaptureOutErr("printf %s|%s|%s 'a  b' \"c \\\"d\\\"\" e\\ f");
+  BOOST_CHECK_EQUAL(outerr.first, "a  b|c \"d\"|e f");
+  BOOST_CHECK(not DataSync::checkCall("ls 'unterminated"));
+  BOOST_CHECK_THROW(DataSync::runCommandAndCaptureOutErr("echo \"unterminated"), std::runtime_error);
+}
+
 // @TODO runCommand_err_test
 
 BOOST_AUTO_TEST_CASE(containsInThisOrder_test) {
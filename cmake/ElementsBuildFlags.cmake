@@ -377,6 +377,10 @@ option(USE_VERSIONED_LIBRARIES
        "Generate versioned shared libraries"
        ON)
 
+option(USE_PATH_INDEX
+       "Generate the index of the installed auxiliary and configuration files at each package installation"
+       OFF)
+
 option(USE_TIMESTAMP_RPM_VERSION
        "Use timestamp for the RPM version in non-squeezed mode"
        OFF)
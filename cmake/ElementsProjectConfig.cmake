@@ -327,6 +327,11 @@ macro(elements_project project version)
     set(thismodule_cmd ${PYTHON_EXECUTABLE} ${thismodule_cmd})
   endif()
 
+  find_program(pathindex_cmd createPathIndex.py HINTS ${binary_paths})
+  if(pathindex_cmd)
+    set(pathindex_cmd ${PYTHON_EXECUTABLE} ${pathindex_cmd})
+  endif()
+
 
   find_program(thismodheader_cmd createThisModHeader.py HINTS ${binary_paths})
   if(thismodheader_cmd)
@@ -3875,6 +3880,23 @@ function(elements_install_scripts)
 
 endfunction()
 
+#---------------------------------------------------------------------------------------------------
+# elements_install_path_index(suffix)
+#
+# (Re)generate the index of the installed ${CMAKE_INSTALL_PREFIX}/<suffix> location after its
+# installation. The index is used by the ElementsKernel lookup functions instead of the filesystem.
+# Each package regenerates the index of the whole location: the last one covers all the files.
+# This is only suited to a private installation prefix (USE_PATH_INDEX is OFF by default): the
+# packages sharing a prefix (e.g. RPMs installed in /usr) would all ship the same partial index
+# file. The index of such a location is rather generated once, after the installation of all the
+# packages, with "createPathIndex.py <prefix>/<suffix>".
+#---------------------------------------------------------------------------------------------------
+function(elements_install_path_index suffix)
+  if(USE_PATH_INDEX AND pathindex_cmd)
+    install(CODE "execute_process\(COMMAND ${pathindex_cmd} --quiet \$ENV{DESTDIR}\${CMAKE_INSTALL_PREFIX}/${suffix}\)")
+  endif()
+endfunction()
+
 #---------------------------------------------------------------------------------------------------
 # elements_install_aux_files()
 #
@@ -3894,6 +3916,7 @@ function(elements_install_aux_files)
                PATTERN "CVS" EXCLUDE
                PATTERN ".svn" EXCLUDE
                PATTERN "*~" EXCLUDE)
+        elements_install_path_index(${AUX_INSTALL_SUFFIX})
         file(GLOB aux_list RELATIVE ${ad} ${ad}/*)
         foreach(af ${aux_list})
           set_property(GLOBAL APPEND PROPERTY REGULAR_AUX_OBJECTS ${af})
@@ -3919,6 +3942,7 @@ function(elements_install_conf_files)
             PATTERN "CVS" EXCLUDE
             PATTERN ".svn" EXCLUDE
             PATTERN "*~" EXCLUDE)
+    elements_install_path_index(${CONF_INSTALL_SUFFIX})
     set_property(GLOBAL APPEND PROPERTY PROJ_HAS_CONF TRUE)
     file(GLOB conf_list RELATIVE ${CMAKE_CURRENT_SOURCE_DIR}/conf ${CMAKE_CURRENT_SOURCE_DIR}/conf/*)
     foreach(cf ${conf_list})
@@ -0,0 +1,93 @@
+""" Script that generates the index of the files of an installed location (see ElementsKernel/PathIndex.h)"""
+
+import os
+import struct
+import sys
+import time
+from optparse import OptionParser
+
+INDEX_FILE_NAME = ".elements_index"
+MAGIC = b"ELPIDX01"
+
+FILE_ENTRY = 0
+DIRECTORY_ENTRY = 1
+LINKED_DIRECTORY_ENTRY = 2
+
+
+def getEntries(directory):
+    """ Collect the relative paths of the tree. The directory links are recorded but not followed """
+    entries = []
+    for root, dirnames, filenames in os.walk(directory):
+        relative_root = os.path.relpath(root, directory)
+        for name in dirnames + filenames:
+            if root == directory and name.startswith(INDEX_FILE_NAME):
+                continue
+            path = os.path.join(root, name)
+            if relative_root == os.curdir:
+                relative_path = name
+            else:
+                relative_path = "/".join([relative_root.replace(os.sep, "/"), name])
+            if os.path.isdir(path):
+                entry_type = LINKED_DIRECTORY_ENTRY if os.path.islink(path) else DIRECTORY_ENTRY
+            elif os.path.exists(path):
+                entry_type = FILE_ENTRY
+            else:
+                # broken link
+                continue
+            entries.append((relative_path.encode("utf-8", "surrogateescape"), entry_type))
+    return sorted(entries)
+
+
+def writeIndex(directory):
+    """ Write the index file at the top of the directory """
+    entries = getEntries(directory)
+
+    offsets = [0]
+    strings = b""
+    for path, _ in entries:
+        strings += path + b"\0"
+        offsets.append(len(strings))
+    types = bytes(entry_type for _, entry_type in entries)
+    types += b"\0" * (-len(types) % 8)
+
+    index_name = os.path.join(directory, INDEX_FILE_NAME)
+    tmp_name = index_name + ".tmp"
+    with open(tmp_name, "wb") as index_file:
+        index_file.write(MAGIC)
+        index_file.write(struct.pack("=QQ", len(entries), len(strings)))
+        index_file.write(struct.pack("=%dQ" % len(offsets), *offsets))
+        index_file.write(types)
+        index_file.write(strings)
+    os.replace(tmp_name, index_name)
+    # the renaming updates the directory: the index must be strictly more recent
+    # (see touchAfter in ElementsKernel/src/Lib/PathIndex.cpp)
+    os.utime(index_name)
+    while os.stat(index_name).st_mtime_ns <= os.stat(directory).st_mtime_ns:
+        time.sleep(0.001)
+        os.utime(index_name)
+
+    return len(entries)
+
+
+def main():
+    """ Main function for this module """
+    parser = OptionParser(usage="ERROR: Usage %prog <directory> [<directory> ...]")
+    parser.add_option("-q", "--quiet", action="store_true",
+                      help="Do not print messages.")
+    opts, args = parser.parse_args()
+
+    if not args:
+        parser.error("wrong number of arguments: no directory")
+
+    for directory in args:
+        if not os.path.isdir(directory):
+            continue
+        entry_number = writeIndex(directory)
+        if not opts.quiet:
+            print("Indexed %d entries in %s" % (entry_number, directory))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())